@@ -0,0 +1,122 @@
+#ifndef ADMIN_LINK_H
+#define ADMIN_LINK_H
+
+#include <Arduino.h>
+
+// 관리용 바이너리 명령 (시리얼) - 대량 발행/처리/삭제, 설정, 상태 덤프
+//
+// 프레임 = 0xA5 종류(1) 길이(2) 순번(1) 명령(1) 페이로드(길이) CRC16(2)
+//   종류: 'C' 요청 (PC → 보드), 'R' 응답 (보드 → PC)
+//   길이: 페이로드 바이트 수, 리틀 엔디언 (모든 정수 필드도 리틀 엔디언)
+//   CRC16: CCITT (다항식 0x1021, 초기값 0xFFFF), 길이부터 페이로드 끝까지
+// 응답은 요청의 순번/명령을 그대로 돌려주고 페이로드 첫 바이트가 LinkStatus
+// 0xA5 로 시작하지 않는 바이트는 기존 텍스트 명령으로 넘김 (사람이 치는 명령과 같은 포트)
+//
+// Arduino HardwareSerial 은 UART 드라이버의 수신 링을 드러내지 않으므로, fill() 이 read() 로
+// 한 번 이 링 버퍼에 옮겨 담음 (이 한 번이 유일한 복사). 그 뒤로는 링 안에서 헤더/CRC 를 확인하고
+// 명령 처리도 LinkFrame 으로 링을 직접 읽음. 처리가 끝나면 consume() 으로 자리를 비움.
+// 명령 형식은 readme 의 "관리용 바이너리 명령", PC 쪽 도구는 util/qms_link.py
+
+#define LINK_FRAME_SYNC     0xA5
+#define LINK_FRAME_REQUEST  'C'
+#define LINK_FRAME_REPLY    'R'
+#define LINK_HEADER_LEN     6
+#define LINK_CRC_LEN        2
+#define LINK_PAYLOAD_MAX    512
+#define LINK_RING_SIZE      1024   // 2의 거듭제곱, 가장 긴 프레임보다 커야 함
+#define LINK_VERSION        1
+
+static_assert((LINK_RING_SIZE & (LINK_RING_SIZE - 1)) == 0, "LINK_RING_SIZE must be a power of two");
+static_assert(LINK_RING_SIZE >= LINK_HEADER_LEN + LINK_PAYLOAD_MAX + LINK_CRC_LEN, "LINK_RING_SIZE too small");
+
+enum LinkOp : uint8_t {
+  LINK_PING = 0x01,      // → 버전(1) 최대 페이로드(2)
+  LINK_ENQUEUE = 0x10,   // 개수(1) → 발행 수(1) 첫 번호(2) 멈춘 사유 AdmissionResult(1)
+  LINK_DEQUEUE = 0x11,   // 개수(1) → 처리 수(1)
+  LINK_DELETE = 0x12,    // 번호(2) x N → 삭제 수(2)
+  LINK_SET = 0x20,       // 항목 LinkSetting(1) 값(4, 부호 있음) → 적용된 값(4)
+  LINK_DUMP = 0x30       // → 상태 (readme 참고) + 대기 번호(2) x 목록 수
+};
+
+enum LinkStatus : uint8_t {
+  LINK_OK = 0,
+  LINK_BAD_OP,       // 모르는 명령
+  LINK_BAD_LENGTH,   // 페이로드 길이가 명령과 맞지 않음
+  LINK_BAD_VALUE     // 범위를 벗어난 값
+};
+
+enum LinkSetting : uint8_t {
+  LINK_SET_PROCESS_SEC = 1,   // 1명당 처리 시간(초)
+  LINK_SET_MAX_WAIT = 2,      // 최대 허용 대기시간(초), 0 = 제한 없음
+  LINK_SET_CLOSING = 3,       // 마감 시각(자정 기준 초), -1 = 마감 없음
+  LINK_SET_CLOCK = 4          // 현재 시각(자정 기준 초)
+};
+
+uint16_t linkCrc16(uint16_t crc, uint8_t byte);
+
+// 링 버퍼 안의 요청 하나 (페이로드를 제자리에서 읽음)
+class LinkFrame {
+private:
+  const uint8_t* ring;
+  uint16_t start;   // 페이로드 첫 바이트의 링 위치
+
+  friend class AdminLink;
+
+public:
+  uint8_t seq;
+  uint8_t op;
+  uint16_t length;   // 페이로드 길이
+
+  LinkFrame() : ring(nullptr), start(0), seq(0), op(0), length(0) {}
+  uint8_t u8(uint16_t i) const { return ring[(uint16_t)(start + i) & (LINK_RING_SIZE - 1)]; }
+  uint16_t u16(uint16_t i) const { return u8(i) | (uint16_t)u8(i + 1) << 8; }
+  int32_t i32(uint16_t i) const { return (int32_t)((uint32_t)u16(i) | (uint32_t)u16(i + 2) << 16); }
+};
+
+// 응답 작성 (헤더 자리를 비워 두고 채운 뒤 send 에서 길이/CRC 를 붙임)
+class LinkReply {
+private:
+  uint8_t buffer[LINK_HEADER_LEN + LINK_PAYLOAD_MAX + LINK_CRC_LEN];
+  uint16_t used;
+
+public:
+  LinkReply() : used(0) {}
+  void begin(const LinkFrame& request, LinkStatus status);
+  void put8(uint8_t v) { if (used < LINK_HEADER_LEN + LINK_PAYLOAD_MAX) buffer[used++] = v; }
+  void put16(uint16_t v) { put8((uint8_t)v); put8((uint8_t)(v >> 8)); }
+  void put32(uint32_t v) { put16((uint16_t)v); put16((uint16_t)(v >> 16)); }
+  uint16_t room() const { return LINK_HEADER_LEN + LINK_PAYLOAD_MAX - used; }
+  void send(Print& out);
+};
+
+enum LinkItem {
+  LINK_ITEM_NONE,    // 읽을 것 없음 (또는 프레임이 아직 덜 옴)
+  LINK_ITEM_TEXT,    // 텍스트 명령 바이트 하나
+  LINK_ITEM_FRAME    // CRC 가 맞는 요청 - 처리 후 consume()
+};
+
+class AdminLink {
+private:
+  uint8_t ring[LINK_RING_SIZE];
+  uint16_t head;   // 다음에 쓸 위치 (계속 증가, 링 크기로 마스크)
+  uint16_t tail;   // 다음에 읽을 위치
+  uint32_t stallSinceMs;   // 맨 앞 프레임이 덜 온 채로 기다리기 시작한 시각
+  bool stalled;
+  uint32_t frameCount;
+  uint32_t errorCount;
+
+  uint8_t at(uint16_t offset) const { return ring[(uint16_t)(tail + offset) & (LINK_RING_SIZE - 1)]; }
+  void resync();
+
+public:
+  AdminLink();
+  // 시리얼에 와 있는 만큼 링의 빈자리로 읽어 옴 (드라이버 버퍼 → 링, 한 번 복사)
+  void fill(HardwareSerial& in);
+  LinkItem next(LinkFrame& frame, char& text);
+  void consume(const LinkFrame& frame);
+
+  uint32_t frames() const { return frameCount; }
+  uint32_t errors() const { return errorCount; }   // CRC/헤더 오류로 버린 프레임
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#include <stdint.h>
+
+// 빌드 플래그로 기본값 지정 가능 (-1 또는 0 이면 비활성)
+#ifndef QMS_MAX_WAIT_SEC
+#define QMS_MAX_WAIT_SEC 0          // 최대 허용 대기시간(초), 0 = 제한 없음
+#endif
+#ifndef QMS_CLOSING_SEC_OF_DAY
+#define QMS_CLOSING_SEC_OF_DAY -1   // 마감 시각(자정 기준 초), -1 = 마감 없음
+#endif
+
+enum AdmissionResult {
+  ADMIT_OK,
+  ADMIT_QUEUE_FULL,      // 대기열 자리 없음
+  ADMIT_WAIT_TOO_LONG,   // 예상 대기시간이 최대 허용치 초과
+  ADMIT_CLOSING          // 마감 전에 처리 불가
+};
+
+struct AdmissionDecision {
+  AdmissionResult result;
+  int predictedWaitSec;  // 지금 발행하면 예상되는 대기시간
+  int nextSlotSec;       // 다시 발행 가능해질 때까지 남은 시간(초), -1 = 오늘은 불가
+};
+
+// 발행 시점 수용 판단
+// 현재 ETA 모델(남은 처리시간 + 대기 인원 x 1인 처리시간)만 사용하므로 O(1)
+class AdmissionPolicy {
+private:
+  int capacity;
+  int maxWaitSec;
+  long closingSecOfDay;
+  long clockAnchorSec;          // setClock() 시점의 하루 중 시각(초), -1 = 모름
+  unsigned long clockAnchorMs;  // setClock() 시점의 millis()
+
+public:
+  AdmissionPolicy(int queueCapacity);
+  void setCapacity(int queueCapacity) { capacity = queueCapacity; }
+  void setMaxWait(int sec) { maxWaitSec = sec; }
+  void setClosingTime(long secOfDay) { closingSecOfDay = secOfDay; }
+  void setClock(unsigned long nowMs, long secOfDay);
+
+  int getMaxWait() const { return maxWaitSec; }
+  long getClosingTime() const { return closingSecOfDay; }
+  bool clockKnown() const { return clockAnchorSec >= 0; }
+  long secondsOfDay(unsigned long nowMs) const;
+
+  AdmissionDecision evaluate(unsigned long nowMs, int queueLength, int remainingForCurrentSec,
+                             int processTimeSec) const;
+};
+
+#endif
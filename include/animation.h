@@ -0,0 +1,68 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <Arduino.h>
+
+// 고정 틱 애니메이션 (트윈)
+// loop 마다 update() 를 부르면 ANIM_TICK_MS 마다 한 번, 진행 중인 트윈의 현재 값을 step 함수로 넘김.
+// 밀려서 여러 틱이 지났으면 중간 값은 건너뛰고 마지막 값만 그림 (드롭 수 집계).
+// paced 트윈은 앞 틱에 그린 것이 아직 전송 중이면(frameBusy) 이번 틱을 건너뜀 - 그리기는 쌓이지 않고
+// 다음 틱에 그때 값으로 한 번만 그림. 값이 앞 틱과 같으면 step 을 부르지 않음 (바뀐 픽셀만 그리도록)
+
+#ifndef ANIM_TICK_MS
+#define ANIM_TICK_MS 33  // 약 30fps
+#endif
+#define ANIM_SLOTS 4
+
+enum AnimEase : uint8_t {
+  EASE_LINEAR,
+  EASE_OUT,     // 빠르게 시작해서 천천히 멈춤
+  EASE_IN_OUT
+};
+
+// value: 이번 틱 값, done: 마지막 값 (이후 트윈은 끝남)
+typedef void (*TweenStep)(int32_t value, bool done);
+
+class Animator {
+public:
+  Animator();
+
+  // from → to 를 durationMs 동안. 같은 step 의 트윈이 있으면 대신함. 자리가 없으면 false
+  bool start(int32_t from, int32_t to, uint16_t durationMs, AnimEase ease, TweenStep step, bool paced = true);
+  // 남은 값을 그리지 않고 멈춤
+  void cancel(TweenStep step);
+  // 바로 마지막 값으로 (step(to, true))
+  void finish(TweenStep step);
+  bool running(TweenStep step) const;
+  bool idle() const { return activeCount == 0; }
+
+  void update(uint32_t nowMs, bool frameBusy);
+
+  uint32_t frames() const { return frameCount; }
+  uint32_t dropped() const { return droppedCount; }
+
+private:
+  struct Tween {
+    TweenStep step;   // nullptr = 빈 자리
+    int32_t from, to;
+    int32_t last;     // 마지막으로 그린 값
+    uint32_t startMs;
+    uint16_t durationMs;
+    AnimEase ease;
+    bool paced;
+  };
+
+  Tween tweens[ANIM_SLOTS];
+  int activeCount;
+  uint32_t lastTickMs;
+  uint32_t frameCount;
+  uint32_t droppedCount;
+
+  int find(TweenStep step) const;
+  void stop(int slot);
+};
+
+// RGB565 두 색 사이 (amount 0 = from, 256 = to). 반전된 색끼리도 그대로 섞임
+uint16_t blend565(uint16_t from, uint16_t to, uint16_t amount);
+
+#endif
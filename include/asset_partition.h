@@ -0,0 +1,73 @@
+#ifndef ASSET_PARTITION_H
+#define ASSET_PARTITION_H
+
+#include <esp_partition.h>
+#include "sprite_atlas.h"
+
+// 에셋 파티션 (util/asset_pack.py 로 만든 이미지를 assets 파티션에 올림)
+// 부팅할 때 esp_partition_mmap 으로 주소 공간에 매핑하고, 아틀라스 포인터가 매핑된 플래시를
+// 바로 가리키게 해서 복사 없이 그림 (streamSprite 가 플래시에서 줄마다 LUT 로 풀어 전송).
+// 브랜딩을 바꿀 때 펌웨어를 다시 빌드하지 않고 파티션만 다시 올리면 됨.
+// 팔레트는 픽셀마다 읽으므로 QMS_IRAM_HOT 빌드에서는 ASSET_PALETTE_RAM 색 이하면 내부 RAM 으로 복사해 둠 (hot_path.h)
+//
+// 이미지 (리틀엔디언):
+//   헤더 48바이트 - "QMSA", 버전, 스프라이트 수, 인덱스 비트, 팔레트/인덱스/사각형/이름 위치,
+//                   이미지 크기, 헤더 뒤 전체 CRC32
+//   SpriteRect[스프라이트 수]  (4바이트 정렬)
+//   char[ASSET_NAME_LEN][스프라이트 수]
+//   팔레트 uint16_t (패널 전송 순서)
+//   인덱스 (4바이트 정렬)
+
+#define ASSET_PARTITION_LABEL   "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40   // partitions.csv 의 assets 서브타입 (사용자 정의 범위)
+#define ASSET_IMAGE_VERSION     1
+#define ASSET_NAME_LEN          16
+#define ASSET_PALETTE_RAM       256    // RAM 으로 복사하는 팔레트 최대 색 수 (LUT 끝까지)
+
+struct AssetImageHeader {
+  char magic[4];  // "QMSA"
+  uint16_t version;
+  uint16_t spriteCount;
+  uint8_t bits;
+  uint8_t reserved0[3];
+  uint32_t paletteOffset;
+  uint16_t paletteCount;
+  uint16_t reserved1;
+  uint32_t pixelsOffset;
+  uint32_t pixelsSize;
+  uint32_t rectsOffset;
+  uint32_t namesOffset;
+  uint32_t imageSize;
+  uint32_t crc;   // 헤더 뒤 ~ imageSize
+  uint32_t reserved2;
+};
+
+class AssetPartition {
+public:
+  AssetPartition();
+
+  // 파티션을 찾아 매핑하고 이미지를 검사. 없거나 깨졌으면 false (내장 아틀라스 사용)
+  bool begin();
+  void end();
+
+  bool mapped() const { return base != nullptr; }
+  const SpriteAtlas* atlas() const { return mapped() ? &view : nullptr; }
+  // 이름으로 스프라이트 번호 찾기 (없으면 -1)
+  int find(const char* name) const;
+  size_t imageSize() const { return mapped() ? header()->imageSize : 0; }
+
+private:
+  const uint8_t* base;
+  spi_flash_mmap_handle_t handle;
+  SpriteAtlas view;
+#if QMS_IRAM_HOT
+  uint16_t palette[ASSET_PALETTE_RAM];
+#endif
+
+  const AssetImageHeader* header() const { return (const AssetImageHeader*)base; }
+  bool valid(const uint8_t* image, size_t size) const;
+};
+
+extern AssetPartition assetPartition;
+
+#endif
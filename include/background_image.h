@@ -0,0 +1,56 @@
+#ifndef BACKGROUND_IMAGE_H
+#define BACKGROUND_IMAGE_H
+
+#include <FS.h>
+#include "display.h"
+#include "jpeg_decoder.h"
+
+// SPIFFS 의 JPEG 를 화면 배경으로 - 프레임 버퍼 없이 띠마다 걸치는 MCU 줄만 풀어서 채움
+// 패널 프레임의 배경(setBackground)으로 쓰므로 위젯(명령)은 그 위에 합성되고,
+// 띠는 다른 화면처럼 터치 가까운 순서/시간 예산대로 나뉘어 전송됨.
+// 이미지 밖(이미지가 화면보다 작을 때)은 fillColor 로 채움.
+// 수직 스크롤이 없는 화면 전용 (메모리 줄 = 화면 줄)
+
+// 파일을 열어 둔 채 JpegDecoder 입력으로
+class JpegFileInput : public JpegInput {
+public:
+  bool open(fs::FS& fs, const char* path);
+  void close();
+  size_t readAt(uint32_t pos, uint8_t* buf, size_t len) override;
+
+private:
+  File file;
+};
+
+class BackgroundImage : public BandSource, public JpegTileSink {
+public:
+  BackgroundImage();
+
+  // 파일을 열고 헤더/MCU 줄 색인을 만듦 (패널 색 반전 적용). 실패하면 false (ready() 도 false)
+  bool begin(fs::FS& fs, const char* path, uint16_t fillColor);
+  bool ready() const { return decoder.ready(); }
+  // 파일을 닫고 배경 없음으로 (다시 begin 할 수 있음)
+  void end();
+  const JpegDecoder& image() const { return decoder; }
+
+  // 프레임 배경으로 지정 (화면 전체)
+  void attach(QmsDisplay& panel);
+  // 사각 영역만 이미지로 되돌림 (바뀌는 글자 지우기) - 프레임 underlay 로 예약
+  void restore(QmsDisplay& panel, int16_t x, int16_t y, int16_t w, int16_t h);
+
+  void fillBand(uint16_t* pixels, uint8_t* covered, int16_t top, int16_t lines, int16_t width) override;
+  void tile(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels, int16_t stride) override;
+
+private:
+  JpegFileInput input;
+  JpegDecoder decoder;
+  uint16_t fill;
+  int16_t clipX, clipY, clipW, clipH;
+
+  // fillBand 중인 띠 (tile() 이 채울 곳)
+  uint16_t* bandPixels;
+  uint8_t* bandCovered;
+  int16_t bandTop, bandBottom, bandWidth;
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef BOARD_H
+#define BOARD_H
+
+// 보드별 배선 / SPI 버스 설정
+// platformio.ini 의 build_flags 로 덮어씀 (예: -D QMS_TOUCH_BUS=TOUCH_BUS_HSPI -D TOUCH_MISO=27)
+
+// ST7789 디스플레이 (VSPI)
+#ifndef TFT_CS
+#define TFT_CS    15
+#endif
+#ifndef TFT_RST
+#define TFT_RST   4
+#endif
+#ifndef TFT_DC
+#define TFT_DC    2
+#endif
+#ifndef TFT_MOSI
+#define TFT_MOSI  23
+#endif
+#ifndef TFT_SCLK
+#define TFT_SCLK  18
+#endif
+#ifndef TFT_BL
+#define TFT_BL    32
+#endif
+
+// TFT SPI 클럭 - VSPI 기본 핀(IOMUX)이면 80MHz 까지 가능
+#ifndef TFT_SPI_HZ
+#define TFT_SPI_HZ 40000000
+#endif
+
+// 터치 컨트롤러 버스 종류
+#define TOUCH_BUS_SHARED 0   // TFT 와 같은 VSPI (기존 배선: MOSI 23 / SCLK 18 / MISO 19)
+#define TOUCH_BUS_HSPI   1   // 두 번째 하드웨어 SPI (HSPI) - TFT 와 동시에 동작
+#define TOUCH_BUS_SOFT   2   // GPIO 비트뱅 - 핀 제약이 있을 때
+
+#ifndef QMS_TOUCH_BUS
+#define QMS_TOUCH_BUS TOUCH_BUS_SHARED
+#endif
+
+// XPT2046 핀
+#ifndef TOUCH_CS
+#define TOUCH_CS  5
+#endif
+#ifndef TOUCH_IRQ
+#define TOUCH_IRQ 17
+#endif
+
+#if QMS_TOUCH_BUS == TOUCH_BUS_SHARED
+#define TOUCH_SCLK TFT_SCLK
+#define TOUCH_MOSI TFT_MOSI
+#define TOUCH_MISO 19
+#else
+// 별도 버스 기본 핀 (GPIO12 는 부팅 스트래핑 핀이라 MISO 로 쓰지 않음)
+#ifndef TOUCH_SCLK
+#define TOUCH_SCLK 14
+#endif
+#ifndef TOUCH_MOSI
+#define TOUCH_MOSI 13
+#endif
+#ifndef TOUCH_MISO
+#define TOUCH_MISO 27
+#endif
+#endif
+
+// XPT2046 최대 클럭 2.5MHz (라이브러리 기본 2MHz)
+#ifndef TOUCH_SPI_HZ
+#define TOUCH_SPI_HZ 2000000
+#endif
+
+// 별도 버스일 때 터치 샘플링 태스크 주기(ms) - 0 이면 loop() 에서 직접 읽음
+#ifndef TOUCH_TASK_PERIOD_MS
+#define TOUCH_TASK_PERIOD_MS 2
+#endif
+
+#endif
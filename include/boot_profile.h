@@ -0,0 +1,41 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <Arduino.h>
+
+// 부팅 단계별 소요 시간 (CPU 사이클 카운터 CCOUNT 로 재고 µs 로 출력)
+// setup() 단계는 begin() 부터 mark() 사이 간격, 첫 화면 뒤로 미룬 초기화는 record() 로 하나씩.
+// CCOUNT 는 240MHz 에서 약 17.9초마다 되감기므로 한 구간이 그보다 짧아야 함
+
+#define BOOT_PHASES 12
+
+class BootProfile {
+public:
+  BootProfile();
+
+  // setup() 첫 줄에서. 이때의 micros() 가 앱 시작(부트로더 이후)부터 setup 까지
+  void begin();
+  // 앞 mark (또는 begin) 이후를 이 단계로 기록
+  void mark(const char* name);
+  // 화면이 입력을 받을 수 있게 된 시점 (첫 화면 전송 + 백라이트)
+  void ready();
+  // 첫 화면 뒤로 미룬 단계 (loop 빈 시간에 실행한 만큼)
+  void record(const char* name, uint32_t cycles, bool deferred);
+
+  uint32_t readyUs() const { return readyAtUs; }
+  void print(Print& out) const;
+
+private:
+  struct Phase {
+    const char* name;
+    uint32_t cycles;
+    bool deferred;
+  };
+  Phase phases[BOOT_PHASES];
+  uint8_t count;
+  uint32_t setupAtUs;   // setup() 진입 시각 (앱 시작 기준)
+  uint32_t readyAtUs;   // 첫 화면이 켜진 시각 (앱 시작 기준)
+  uint32_t lastCycles;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef DIGIT_ROLL_H
+#define DIGIT_ROLL_H
+
+#include <Adafruit_GFX.h>
+
+// 숫자 굴림 표시 (대기시간 mm:ss 같은 고정 폭 글자열, 글자 크기 1 = 6x8 칸)
+// 글자열이 바뀌면 글리프가 바뀐 칸만 이전 글자가 위로 빠지고 새 글자가 아래에서 올라옴.
+// 굴리는 동안은 바뀐 칸들을 덮는 사각형 하나만 지우고 다시 그림 (나머지 글자는 그대로)
+
+#define DIGIT_ROLL_CELLS 8
+#define DIGIT_ROLL_LINES 8   // 굴림 단계 수 (글자 높이)
+
+// 필드 영역 지우기 (배경색 채우기 또는 배경 이미지 복원)
+typedef void (*FieldEraser)(int16_t x, int16_t y, int16_t w, int16_t h);
+
+class DigitRoll {
+public:
+  DigitRoll(int16_t x, int16_t y, uint16_t color, uint16_t background, FieldEraser erase);
+
+  // 화면을 통째로 다시 그린 뒤 지금 표시된 글자열을 기록 (굴리지 않음)
+  void reset(const char* text);
+  // 새 글자열. 길이가 같고 바뀐 칸이 있으면 굴림을 준비하고 true (render 로 진행),
+  // 길이가 다르면 바로 지우고 새로 그린 뒤 false
+  bool change(Adafruit_GFX& g, const char* text);
+  // 굴림 phase (0 ~ DIGIT_ROLL_LINES). 마지막 단계에서 새 글자열이 자리 잡음
+  void render(Adafruit_GFX& g, int16_t phase);
+  // 새 글자를 배경색에서 글자색으로 서서히 (배경이 단색일 때만 의미 있음)
+  void setFade(bool on) { fade = on; }
+
+private:
+  int16_t x, y;
+  uint16_t color, background;
+  FieldEraser erase;
+  bool fade;
+  char shown[DIGIT_ROLL_CELLS + 1];  // 패널에 자리 잡은 글자열
+  char next[DIGIT_ROLL_CELLS + 1];   // 굴려서 바꿀 글자열
+  uint8_t length;
+  int8_t first, last;                // 바뀌는 칸 범위 (-1 = 없음)
+
+  void drawCell(Adafruit_GFX& g, int16_t cell, int16_t phase);
+};
+
+#endif
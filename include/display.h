@@ -0,0 +1,164 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <Adafruit_ST7789.h>
+
+// 주소창(CASET/RASET/RAMWR) 설정 1회당 명령+데이터 바이트
+#define SPI_WINDOW_OVERHEAD 11
+
+// 디스플레이 리스트 크기 (넘으면 중간에 한 번 전송하고 계속 기록)
+#ifndef DISPLAY_LIST_OPS
+#define DISPLAY_LIST_OPS 512
+#endif
+
+// 전송할 때 한 번에 합성하는 줄 수 (띠는 이 줄 수 단위로 정렬)
+#define DISPLAY_BAND_LINES  16
+#define DISPLAY_MAX_WIDTH   240
+#define DISPLAY_MAX_HEIGHT  320
+#define DISPLAY_BANDS       ((DISPLAY_MAX_HEIGHT + DISPLAY_BAND_LINES - 1) / DISPLAY_BAND_LINES)
+
+// loop 1회에 프레임 전송에 쓰는 시간 (pumpFrame). 남은 띠는 다음 loop 에서 이어서
+#ifndef DISPLAY_FRAME_BUDGET_US
+#define DISPLAY_FRAME_BUDGET_US 2000
+#endif
+
+// SPI 전송 비용 집계
+struct SpiStats {
+  uint32_t transactions;  // startWrite() 횟수 (CS 구간)
+  uint32_t windows;       // setAddrWindow() 횟수
+  uint32_t bytes;         // 명령 + 픽셀 데이터 바이트
+
+  void reset() { transactions = windows = bytes = 0; }
+};
+
+// 기록된 그리기 명령 (점/선/사각형 모두 단색 사각형으로 기록)
+struct DrawOp {
+  int16_t x, y, w, h;
+  uint16_t color;
+};
+
+// 프레임 배경 - 띠를 합성할 때 명령보다 먼저 채움 (정적 레이어 / 모달 아래 영역 복원용)
+class BandSource {
+public:
+  virtual ~BandSource() {}
+  // 메모리 줄 top(DISPLAY_BAND_LINES 배수)부터 lines 줄 중 가진 픽셀을 pixels 에 채우고
+  // covered 에 표시 (둘 다 줄 간격 DISPLAY_MAX_WIDTH)
+  virtual void fillBand(uint16_t* pixels, uint8_t* covered, int16_t top, int16_t lines, int16_t width) = 0;
+  // 프레임이 다 전송되었거나 다른 배경으로 바뀌어 더 이상 참조하지 않음
+  virtual void release() {}
+};
+
+// ST7789 + SPI 비용 계측 + 프레임 단위 일괄 전송
+// Adafruit_SPITFT 의 그리기 함수는 모두 startWrite/setAddrWindow 를 거치므로
+// 두 함수만 가로채면 모든 draw 호출의 비용이 집계됨
+//
+// beginFrame() ~ endFrame() 사이의 fillRect/drawRect/선/글자는 패널로 바로 보내지 않고
+// 디스플레이 리스트에 기록했다가, endFrame() 에서 띠(band) 단위로 합성해서
+// 실제로 칠해진 영역을 겹치지 않는 사각형으로 나눠 사각형마다 주소창 1번에 전송
+// (트랜잭션도 전체 1번). 기존 draw*() 코드는 그대로 사용.
+//
+// pumpFrame() 은 endFrame() 대신 시간 예산 안에서 띠 몇 개만 보내고 나머지는 다음 호출로 미룸
+// (그동안 loop 는 터치 샘플링/타이머를 계속 처리). 마지막 터치 근처 띠부터 보냄.
+// 아직 안 보낸 띠가 있는 동안 새로 그린 것은 같은 프레임에 쌓이고, 화면 전체 배경이
+// 바뀌면(다음 화면) 이전 화면의 남은 띠는 보내지 않고 버림
+class QmsDisplay : public Adafruit_ST7789 {
+public:
+  QmsDisplay(int8_t cs, int8_t dc, int8_t rst);
+  void startWrite() override;
+  void endWrite() override;
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override;
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void writePixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+  // 라이브러리 init() (고정 지연 약 600ms) 대신 두 단계로 초기화
+  // resetPanel: SPI 설정과 리셋 펄스만 주고 바로 돌아옴. 리셋 후 120ms 동안은 슬립 해제를 못 하므로
+  // 그 사이 다른 초기화를 하고 wakePanel 에서 남은 시간만 기다린 뒤 화면을 켬 (회전 0 고정)
+  void resetPanel(uint32_t spiHz, uint8_t spiMode);
+  void wakePanel();
+
+  // ST7789 수직 스크롤 (VSCRDEF/VSCSAD) - 기록된 그리기를 먼저 전송한 뒤 설정
+  // 고정 상단 top 줄, 스크롤 영역 area 줄, 고정 하단 bottom 줄 (합 = 패널 높이)
+  void setScrollArea(uint16_t top, uint16_t area, uint16_t bottom);
+  // 스크롤 영역 첫 줄에 보일 메모리 줄 (top ~ top+area-1)
+  void setScrollStart(uint16_t line);
+  // 스크롤 해제 (메모리 줄 = 화면 줄)
+  void resetScroll();
+  bool scrollActive() const { return scrolled; }
+  // 화면 줄 ↔ 패널 메모리 줄 (스크롤 영역 밖이나 스크롤 해제 상태면 같음)
+  int16_t memoryLine(int16_t y) const;
+  int16_t screenLine(int16_t line) const;
+  // 화면 줄 y 부터 메모리 줄이 끊기지 않고 이어지는 끝 (limit 이하)
+  int16_t contiguousUntil(int16_t y, int16_t limit) const;
+
+  void beginFrame();
+  void endFrame();
+  void flush();  // 프레임을 유지한 채 지금까지 기록된 것만 전송
+  // 예산(us) 안에서 띠를 보냄 (최소 1개). 다 보내면 프레임을 닫고 true
+  bool pumpFrame(uint32_t budgetUs);
+  // 메모리 줄 [y0, y1) 에 걸친 안 보낸 띠만 지금 전송 (화면 슬라이드가 드러나는 순서대로 보낼 때)
+  void sendLines(int16_t y0, int16_t y1);
+  bool inFrame() const { return framing; }
+  bool framePending() const { return dirtyBands != 0; }
+
+  // 프레임 중 화면 전체를 덮는 배경 지정 (이전에 기록된 명령은 덮이므로 버림)
+  void setBackground(BandSource* source);
+  // 일부 영역만 덮는 배경 - 메모리 줄 [y0, y1) 을 다시 보냄 (배경 위, 이후 기록되는 명령 아래)
+  // 앞 프레임의 명령이나 다른 underlay 가 남아 있으면 덮이지 않도록 먼저 다 보냄
+  // (배경만 예약되어 있으면 보내지 않고 그 위에 겹침)
+  void setUnderlay(BandSource* source, int16_t y0, int16_t y1);
+  // 이 줄에 가까운 띠부터 전송 (마지막 터치 위치)
+  void setFocusLine(int16_t y) { focusLine = y; }
+
+  SpiStats stats;
+
+private:
+  bool framing;
+  bool flushing;
+  bool scrolled;
+  bool directOpen;   // 프레임 중 직접 픽셀 전송(비트맵/레이어 복원)을 위해 연 트랜잭션
+  int writeDepth;    // 프레임 중 startWrite 중첩 깊이 (패널로는 보내지 않음)
+
+  DrawOp ops[DISPLAY_LIST_OPS];
+  int opCount;
+  uint32_t dirtyBands;     // 아직 전송하지 않은 띠 (비트)
+  BandSource* background;
+  BandSource* underlay;
+  int16_t focusLine;
+  uint16_t scrollTop, scrollArea, scrollStart;
+  uint32_t resetUs;        // 패널 리셋을 푼 시각
+
+  void busBegin();
+  void busEnd();
+  void sendPanelCommand(uint8_t command, const uint8_t* data, uint8_t len);
+  void record(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void markDirty(int16_t y0, int16_t y1);
+  int nextBand() const;
+  void sendBand(int band);
+  void finishBands();
+  void flushBand(int16_t top, int16_t bottom);
+  void emitRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t bandTop);
+};
+
+// 수직 스크롤 중에도 화면 좌표로 그리는 어댑터 (모달처럼 스크롤 영역 위에 겹쳐 그릴 때)
+// 메모리 줄이 되감기는 곳에서 사각형을 나눠 패널에 그림
+class ScreenCanvas : public Adafruit_GFX {
+public:
+  ScreenCanvas(QmsDisplay& panel);
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+private:
+  QmsDisplay& panel;
+};
+
+#endif
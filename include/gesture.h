@@ -0,0 +1,86 @@
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <Arduino.h>
+
+// 터치 샘플 흐름 → 제스처 (탭, 길게 누르기, 드래그, 스와이프)
+// 고정 크기 상태 기계 + 최근 샘플 링 버퍼로 속도 추정 (힙 사용 없음)
+// 샘플마다 한 번 feed() 하면 판별 가능해진 그 샘플에서 바로 제스처를 돌려줌
+
+#ifndef GESTURE_LONG_PRESS_MS
+#define GESTURE_LONG_PRESS_MS   600   // 누른 채 slop 안에 머무르면 길게 누르기
+#endif
+#ifndef GESTURE_RELEASE_MS
+#define GESTURE_RELEASE_MS      30    // 이 시간 동안 계속 떨어져 있어야 손을 뗀 것으로 봄 (압력 튐 무시)
+#endif
+#ifndef GESTURE_SWIPE_PX_PER_S
+#define GESTURE_SWIPE_PX_PER_S  300   // 뗄 때 속도가 이 이상이면 스와이프
+#endif
+#define GESTURE_WINDOW          8     // 속도 추정에 쓰는 최근 샘플 수
+#define GESTURE_WINDOW_MS       80    // 속도 추정 구간 (이보다 오래된 샘플은 제외)
+
+enum GestureType {
+  GESTURE_NONE,
+  GESTURE_PRESS,       // 누름 확정 (기존 탭 판정과 동일한 시점)
+  GESTURE_TAP,         // 움직이지 않고 길게 누르기 전에 뗌
+  GESTURE_LONG_PRESS,  // 움직이지 않고 GESTURE_LONG_PRESS_MS 경과
+  GESTURE_DRAG,        // slop 을 벗어난 뒤 이동 (dx, dy 는 직전 이벤트 이후 이동량)
+  GESTURE_SWIPE,       // 드래그 후 빠르게 뗌 (vx, vy 는 뗄 때 속도)
+  GESTURE_RELEASE      // 드래그/길게 누르기 후 뗌
+};
+
+struct Gesture {
+  GestureType type;
+  int16_t x, y;        // 현재(또는 마지막) 화면 좌표
+  int16_t startX, startY;  // 누름이 확정된 좌표
+  int16_t dx, dy;
+  int32_t vx, vy;      // px/s
+};
+
+class GestureEngine {
+public:
+  // confirmSamples: 누름 확정에 필요한 연속 샘플 수, slopPx: 같은 지점으로 보는 오차 범위
+  GestureEngine(int confirmSamples, int slopPx);
+
+  Gesture feed(uint32_t timeUs, bool down, int x, int y);
+  void reset();
+
+  bool pressed() const { return state != GESTURE_IDLE && state != GESTURE_SETTLING; }
+  // 누름 확정 전 안정화 중인 샘플 수 (디버그 출력용)
+  int settlingCount() const { return state == GESTURE_SETTLING ? settleCount : 0; }
+
+private:
+  enum State {
+    GESTURE_IDLE,
+    GESTURE_SETTLING,  // 안정화 중 (같은 영역 연속 샘플 세는 중)
+    GESTURE_HELD,      // 확정, 아직 움직이지 않음
+    GESTURE_DRAGGING,
+    GESTURE_LONG_HELD  // 길게 누르기 발생, 뗄 때까지 무시
+  };
+
+  struct Point {
+    uint32_t timeUs;
+    int16_t x, y;
+  };
+
+  const int confirmSamples;
+  const int slopPx;
+
+  State state;
+  int settleCount;
+  int16_t anchorX, anchorY;    // 안정화 기준점 → 확정 후에는 시작 좌표
+  int16_t lastX, lastY;        // 마지막 누름 샘플 좌표
+  int16_t emittedX, emittedY;  // 마지막 드래그 이벤트 좌표
+  uint32_t pressUs;            // 누름 확정 시각
+  uint32_t lastDownUs;         // 마지막 누름 샘플 시각
+
+  Point window[GESTURE_WINDOW];
+  uint8_t windowHead;
+  uint8_t windowCount;
+
+  void push(uint32_t timeUs, int x, int y);
+  void velocity(int32_t& vx, int32_t& vy) const;
+  Gesture make(GestureType type, int x, int y) const;
+};
+
+#endif
@@ -1,266 +0,0 @@
-#ifndef GOADMINBTN_32X32_H
-#define GOADMINBTN_32X32_H
-
-#include <stdint.h>
-
-// 32x32 픽셀 goadminbtn 컬러 아이콘 (RGB565, 2048바이트)
-// 원본 크기: 89x89
-static const uint16_t PROGMEM goadminbtn_32x32[] = {
-    0xC082, 0xD208, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,  // Row 0
-
-    0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,
-
-    0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,
-
-    0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD208, 0xC082,
-
-    0xD208, 0xFF1C, 0xFEBA, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB,  // Row 1
-
-    0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB,
-
-    0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB,
-
-    0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEBA, 0xFF1C, 0xD208,
-
-    0xD1E7, 0xFEBA, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79,  // Row 2
-
-    0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFEBA, 0xFEBA, 0xFEBA,
-
-    0xFEBA, 0xFEBA, 0xFEBA, 0xFE9A, 0xFE79, 0xFE79, 0xFE79, 0xFE79,
-
-    0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFEBA, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A,  // Row 3
-
-    0xFE79, 0xFE79, 0xFE9A, 0xFE9A, 0xFEBA, 0xC514, 0x41C7, 0x4A08,
-
-    0x5228, 0x49E8, 0x8BAE, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE79, 0xFE79,
-
-    0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A,  // Row 4
-
-    0xFEFB, 0xFF1C, 0xFEBA, 0xFEBA, 0xDD96, 0x41C7, 0x8CB3, 0xADB8,
-
-    0xA556, 0xB5F9, 0x6B6E, 0x93CF, 0xFEDB, 0xFE9A, 0xFEFB, 0xFF1C,
-
-    0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFEDB,  // Row 5
-
-    0xAC51, 0x93AE, 0xDD96, 0xFF1C, 0xDD96, 0x4A69, 0xCEBC, 0xAE1A,
-
-    0xADD9, 0xCEDD, 0x73F0, 0x93AE, 0xFF3C, 0xF659, 0xA430, 0x93AE,
-
-    0xEE18, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE9A, 0xFEDB, 0x9BEF,  // Row 6
-
-    0x6B6E, 0x3A09, 0x20C3, 0xE5F7, 0x7B2C, 0x31A7, 0xC67B, 0xA598,
-
-    0x9D97, 0xC67B, 0x73D0, 0x3144, 0xE638, 0x6AAA, 0x18E3, 0x73AF,
-
-    0x730C, 0xF638, 0xFEBA, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFEDB, 0x9C10, 0x6B6E,  // Row 7
-
-    0xC6BC, 0xBE1A, 0x8C93, 0x62CB, 0x7BCF, 0x9D36, 0xADF9, 0xA5B8,
-
-    0xA5B8, 0xADF9, 0xAD97, 0x8C72, 0x5AAB, 0x7C11, 0xAD97, 0xCEFD,
-
-    0x8CD4, 0x6AEB, 0xF659, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE79, 0xFEFB, 0xAC71, 0x5B0C, 0xC69B,  // Row 8
-
-    0xA598, 0xA5B8, 0xC69C, 0xADB8, 0xBE3A, 0xB63A, 0xA598, 0xA5B8,
-
-    0xA5B8, 0xA598, 0xADF9, 0xC67B, 0xAD98, 0xBE5A, 0xB61A, 0x9D77,
-
-    0xBE7B, 0x8CB3, 0x6AEB, 0xFEBA, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE79, 0xFF1C, 0x8B8D, 0x6B8F, 0xCEDD,  // Row 9
-
-    0x9D77, 0xADD8, 0xA598, 0xADF9, 0xA5B8, 0x9D77, 0x9557, 0x9557,
-
-    0x9557, 0x9557, 0x9D77, 0x9D77, 0xADF9, 0xA5B8, 0xA5B8, 0xA5B8,
-
-    0xBE3A, 0xA577, 0x49E7, 0xFEBA, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFEBA, 0xCD75, 0x62CB, 0xADB8,  // Row 10
-
-    0xB61A, 0xA5B8, 0xADD9, 0xA598, 0x9557, 0x9D98, 0x9DB9, 0x9DB8,
-
-    0x9DB8, 0x9DB8, 0x9D98, 0x9557, 0x9D77, 0xADD8, 0xA5B8, 0xA5B8,
-
-    0xCE9C, 0x630C, 0x9BEF, 0xFEBA, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFEBA, 0xFF3C, 0xDDB6, 0x5AAB,  // Row 11
-
-    0xADB8, 0xADF9, 0xA598, 0x9557, 0xA5D9, 0x7C73, 0x31E8, 0x3A08,
-
-    0x3A09, 0x31C8, 0x5B2E, 0xA5D9, 0x9557, 0x9D77, 0xA5B8, 0xBE5B,
-
-    0x6B4E, 0xA430, 0xFF3C, 0xFEBA, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFEBA, 0xDD96, 0xD596, 0x7B2C, 0x7BD0,  // Row 12
-
-    0xBE3A, 0xA5B8, 0x9557, 0xA5D9, 0x7453, 0x62AA, 0xCD34, 0xC514,
-
-    0xC4F3, 0xCD55, 0x8B8E, 0x530D, 0x9DB9, 0x9557, 0x9D77, 0xB61A,
-
-    0x9D35, 0x5A8A, 0xCD34, 0xDD96, 0xFE9A, 0xFE9A, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFEBA, 0xC514, 0x39C7, 0x4A69, 0x31A7, 0x9D36,  // Row 13
-
-    0xB63A, 0x9D77, 0x9D78, 0x7C73, 0x5AAA, 0xEDF7, 0xFEFB, 0xFEDB,
-
-    0xFEDB, 0xFEDB, 0xFEDB, 0x8B8E, 0x634E, 0x9D77, 0x9D77, 0xA5B8,
-
-    0xC65B, 0x4A49, 0x4A69, 0x2104, 0x7B2C, 0xFE9A, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFEBA, 0x41C7, 0x8CB3, 0xCEBC, 0xC69B, 0xADF9,  // Row 14
-
-    0xA598, 0x9557, 0x9DB8, 0x31C8, 0xCD34, 0xFEFB, 0xFE79, 0xFE79,
-
-    0xFE79, 0xFE79, 0xFE9A, 0xFEBA, 0x49E7, 0x7C94, 0x9D98, 0x9D78,
-
-    0xA5B8, 0xC65B, 0xCEBC, 0x94F4, 0x10A3, 0xD575, 0xFF1C, 0xC9E7,
-
-    0xD1E7, 0xFEDB, 0xFEBA, 0x4A08, 0xADB7, 0xAE19, 0xA598, 0xA5B8,  // Row 15
-
-    0xA5B8, 0x9557, 0x9DB8, 0x3A08, 0xC514, 0xFEDB, 0xFE79, 0xFE9A,
-
-    0xFE9A, 0xFE9A, 0xFE9A, 0xFE79, 0x4A08, 0x7C94, 0x9D98, 0x9D97,
-
-    0xADD8, 0xA5B8, 0x9D98, 0xCEDD, 0x4A6A, 0xCD34, 0xFF1C, 0xC9E7,
-
-    0xD1E7, 0xFEDB, 0xFEBA, 0x5228, 0xA556, 0xADD9, 0x9D77, 0xA5B8,  // Row 16
-
-    0xADD9, 0xB619, 0xBE7B, 0x4249, 0xC4F3, 0xFEDB, 0xFE79, 0xFE9A,
-
-    0xFE9A, 0xFE9A, 0xFE9A, 0xFE79, 0x4A28, 0x9D36, 0xBE5B, 0xADD9,
-
-    0xA5B8, 0xA598, 0x9D77, 0xC67B, 0x4A49, 0xCD34, 0xFF1C, 0xC9E7,
-
-    0xD1E7, 0xFEDB, 0xFEBA, 0x41C7, 0xB5F9, 0xCEDD, 0xC67B, 0xADD9,  // Row 17
-
-    0xADB8, 0xBE5A, 0xCEBC, 0x4208, 0xD554, 0xFEDB, 0xFE79, 0xFE9A,
-
-    0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0x4A08, 0x9D56, 0xCEBC, 0xB5F9,
-
-    0xA5B8, 0xBE7B, 0xBE7B, 0xDF3E, 0x4229, 0xCD14, 0xFF3C, 0xC9E7,
-
-    0xD1E7, 0xFEDB, 0xFEBA, 0x8BAE, 0x6B6E, 0x73F0, 0x73D0, 0xA597,  // Row 18
-
-    0xADF9, 0xB5F9, 0xC69B, 0x6BAF, 0x8B8E, 0xFEDB, 0xFE9A, 0xFE9A,
-
-    0xFE9A, 0xFE7A, 0xFEFB, 0xC4F3, 0x5ACB, 0xB5F9, 0xBE5A, 0xADD9,
-
-    0xB5F9, 0x8452, 0x73AF, 0x73AF, 0x62CB, 0xE5F7, 0xFEFB, 0xC9E7,
-
-    0xD1E7, 0xFEDB, 0xFE9A, 0xFE9A, 0x93CF, 0x8BAE, 0x3144, 0x8C73,  // Row 19
-
-    0xBE5B, 0xA5B8, 0xBE5A, 0xCEBC, 0x6BAF, 0x8B8E, 0xFEBA, 0xFE79,
-
-    0xFE79, 0xFEDB, 0xC4F3, 0x52AB, 0xB619, 0xC67B, 0xB5F9, 0xA5D9,
-
-    0xBE3A, 0x2945, 0x7B2C, 0x836D, 0xE5D7, 0xFEBA, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFEDB, 0xFF3C, 0xEE38, 0x5AAB,  // Row 20
-
-    0xAD98, 0xADF9, 0xB5F9, 0xBE3A, 0xC6BC, 0x73D0, 0x4A08, 0x4A28,
-
-    0x4A28, 0x4A08, 0x5ACB, 0xB619, 0xC69B, 0xB619, 0xA5D8, 0xBE5B,
-
-    0x632D, 0xB4B2, 0xFF5D, 0xFEFB, 0xFEBA, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE79, 0xF659, 0x6AAA, 0x7C11,  // Row 21
-
-    0xBE3A, 0xA5B8, 0xA5B8, 0xB5F9, 0xBE5B, 0xBE5B, 0x9D56, 0x9D57,
-
-    0xA577, 0x9D36, 0xB5F9, 0xC67B, 0xB619, 0xADD9, 0xA5B8, 0xB63A,
-
-    0xAD97, 0x49E8, 0xCD55, 0xFE9A, 0xFE79, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE79, 0xFEFB, 0xA430, 0x18E3, 0xAD98,  // Row 22
-
-    0xB61A, 0xA5B8, 0xA5B8, 0xA5B8, 0xADF9, 0xB61A, 0xC69C, 0xC69B,
-
-    0xC69B, 0xCE9C, 0xBE5A, 0xB5F9, 0xADB8, 0xA5B8, 0xADB8, 0xA5B8,
-
-    0xC67B, 0x3A29, 0x4A08, 0xFEDB, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE79, 0xFF1C, 0x93AE, 0x73AF, 0xCEFD,  // Row 23
-
-    0x9D77, 0xA5B8, 0xA5B8, 0xBE5B, 0xADF9, 0xA5B8, 0xADF9, 0xADF9,
-
-    0xADF9, 0xADF9, 0xADD9, 0xA5D9, 0xBE5B, 0xADF9, 0xA598, 0xA597,
-
-    0xB63A, 0xADD8, 0x5228, 0xFEBA, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xE618, 0x730C, 0x8CD4,  // Row 24
-
-    0xBE7B, 0xBE5A, 0xCEBC, 0x6B4E, 0x9D35, 0xBE5B, 0xA598, 0xA5B8,
-
-    0xA5B8, 0xA5B8, 0xB5F9, 0xBE3A, 0x632D, 0xAD97, 0xBE7B, 0xB63A,
-
-    0xB5F9, 0x62EC, 0xC514, 0xFEBA, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE79, 0xFEBA, 0xF638, 0x6AEB,  // Row 25
-
-    0x8C93, 0xB5D8, 0x738F, 0xA410, 0x5A8A, 0x4A49, 0xC65B, 0xA5B8,
-
-    0xA598, 0xBE5B, 0x8452, 0x3165, 0xAC51, 0x6B2C, 0x9D36, 0xA577,
-
-    0x62EC, 0xC4F3, 0xFEFB, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE79, 0xFEBA, 0xF659,  // Row 26
-
-    0x6ACB, 0x49E7, 0x9C10, 0xFF3C, 0xCD34, 0x4A49, 0xCEBC, 0x9D98,
-
-    0x9D77, 0xC67B, 0x73AF, 0x7B2C, 0xFF5D, 0xD575, 0x5A49, 0x5228,
-
-    0xC514, 0xFEFB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A,  // Row 27
-
-    0xFEBA, 0xFEBA, 0xFEBA, 0xFEDB, 0xDD96, 0x2104, 0x94F4, 0xCEDD,
-
-    0xC67B, 0xDF3E, 0x73AF, 0x836D, 0xFEFB, 0xFE9A, 0xFEBA, 0xFEBA,
-
-    0xFEBA, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEDB, 0xFE79, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A,  // Row 28
-
-    0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0x7B0C, 0x10A2, 0x4A8A,
-
-    0x4A49, 0x4229, 0x62CB, 0xDDD7, 0xFEBA, 0xFE9A, 0xFE9A, 0xFE9A,
-
-    0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE9A, 0xFE79, 0xFEDB, 0xD1E7,
-
-    0xD1E7, 0xFEBA, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79,  // Row 29
-
-    0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE9A, 0xFE9A, 0xD575, 0xCD34,
-
-    0xCD34, 0xCD34, 0xEDF7, 0xFEBA, 0xFE79, 0xFE79, 0xFE79, 0xFE79,
-
-    0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFE79, 0xFEBA, 0xD1E7,
-
-    0xD208, 0xFF1C, 0xFEBA, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB,  // Row 30
-
-    0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFF1C, 0xFF1C,
-
-    0xFF1C, 0xFF1C, 0xFEFB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB,
-
-    0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEDB, 0xFEBA, 0xFF1C, 0xD208,
-
-    0xC082, 0xD208, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,  // Row 31
-
-    0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xC9E7, 0xC9E7,
-
-    0xC9E7, 0xC9E7, 0xC9E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7,
-
-    0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD1E7, 0xD208, 0xC082   // Row 31
-};
-
-#endif // GOADMINBTN_32X32_H
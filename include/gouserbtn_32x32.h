@@ -1,266 +0,0 @@
-#ifndef GOUSERBTN_32X32_H
-#define GOUSERBTN_32X32_H
-
-#include <stdint.h>
-
-// 32x32 픽셀 gouserbtn 컬러 아이콘 (RGB565, 2048바이트)
-// 원본 크기: 89x89
-static const uint16_t PROGMEM gouserbtn_32x32[] = {
-    0x3B13, 0x6416, 0x63F6, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416,  // Row 0
-
-    0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416,
-
-    0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416,
-
-    0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x63F6, 0x6416, 0x3B13,
-
-    0x6416, 0xEF7F, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E,  // Row 1
-
-    0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E,
-
-    0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E,
-
-    0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xEF7F, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 2
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 3
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 4
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 5
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xD71E, 0x9E9F, 0x8E7F,
-
-    0xD6FE, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 6
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E, 0xAEBF, 0x7E5F, 0x6E1F, 0x763F,
-
-    0xCEFE, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 7
-
-    0xDF1E, 0xDF3E, 0xE73E, 0xAEBF, 0x6E3F, 0x6DFF, 0x65DF, 0x761F,
-
-    0xCEFE, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 8
-
-    0xDF3E, 0xC6DE, 0xA69F, 0x763F, 0x6DFF, 0x65DF, 0x65DF, 0x761F,
-
-    0xCEFE, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E,  // Row 9
-
-    0xBEDE, 0x7E5F, 0x6E3F, 0x6DFF, 0x65DF, 0x65BF, 0x65BF, 0x6DFF,
-
-    0xD6FE, 0xE73E, 0xDF3E, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xBEDE,  // Row 10
-
-    0x763F, 0x6E1F, 0x6DDF, 0x65DF, 0x65BF, 0x65BF, 0x5DBF, 0x65BF,
-
-    0x861F, 0x8E3F, 0x861F, 0xBEBE, 0xDF3E, 0xDF3E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF3E, 0xCEFE, 0x8E7F, 0x7E3F,  // Row 11
-
-    0x6E1F, 0x6DDF, 0x65DF, 0x65BF, 0x65BF, 0x5DBF, 0x5D9F, 0x5D7F,
-
-    0x557F, 0x557F, 0x4D7F, 0x659F, 0x7DDF, 0xC6BE, 0xDF1E, 0xDF3E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF3E, 0xCEFE, 0x865F, 0x6E1F, 0x6DFF,  // Row 12
-
-    0x6DDF, 0x65DF, 0x65BF, 0x65BF, 0x5DBF, 0x5D9F, 0x5D7F, 0x557F,
-
-    0x555F, 0x555F, 0x553F, 0x4D3F, 0x4D3F, 0x555F, 0x75BF, 0xD6FE,
-
-    0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xCEFE, 0x865F, 0x6E1F, 0x6DFF, 0x6DDF,  // Row 13
-
-    0x65DF, 0x65BF, 0x65BF, 0x5DBF, 0x5D9F, 0x5D9F, 0x557F, 0x555F,
-
-    0x555F, 0x4D5F, 0x4D3F, 0x4D1F, 0x4D1F, 0x451F, 0x3CFF, 0x75BF,
-
-    0xD71E, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0x969F, 0x6E3F, 0x6DDF, 0x6DDF, 0x65DF,  // Row 14
-
-    0x65BF, 0x65BF, 0x5D9F, 0x5D9F, 0x5D7F, 0x557F, 0x555F, 0x555F,
-
-    0x4D3F, 0x4D3F, 0x4D1F, 0x4D1F, 0x44FF, 0x44FF, 0x44FF, 0x3CDF,
-
-    0x6D9F, 0xD71E, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xBEDE, 0x761F, 0x65FF, 0x65DF, 0x65BF,  // Row 15
-
-    0x65BF, 0x5D9F, 0x5D9F, 0x5D7F, 0x557F, 0x555F, 0x555F, 0x4D3F,
-
-    0x4D3F, 0x4D3F, 0x4D1F, 0x44FF, 0x44FF, 0x3CDF, 0x3CDF, 0x3CDF,
-
-    0x34BF, 0x6D7F, 0xD6FE, 0xDF3E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xE73E, 0xBEBE, 0x761F, 0x65FF, 0x65BF,  // Row 16
-
-    0x5D9F, 0x5D9F, 0x5D7F, 0x557F, 0x555F, 0x555F, 0x4D3F, 0x4D3F,
-
-    0x4D1F, 0x4D1F, 0x44FF, 0x44FF, 0x44FF, 0x3CDF, 0x3CDF, 0x3CBF,
-
-    0x34BF, 0x34BF, 0xBE9E, 0xDF3E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xCEFE, 0xAE9F, 0x65DF,  // Row 17
-
-    0x5D9F, 0x5D7F, 0x557F, 0x555F, 0x555F, 0x4D3F, 0x4D3F, 0x4D1F,
-
-    0x451F, 0x3CFF, 0x44FF, 0x44DF, 0x3CDF, 0x3CBF, 0x3CBF, 0x349F,
-
-    0x349F, 0x347F, 0x5D5F, 0xD71E, 0xDF3E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E, 0xDF3E, 0xA67F,  // Row 18
-
-    0x5DBF, 0x557F, 0x555F, 0x555F, 0x4D3F, 0x4D3F, 0x4D1F, 0x4D1F,
-
-    0x5D7F, 0x657F, 0x4D1F, 0x34DF, 0x34BF, 0x3CBF, 0x349F, 0x349F,
-
-    0x347F, 0x2C7F, 0x3CBF, 0xBE9E, 0xDF3E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE73E,  // Row 19
-
-    0xA67F, 0x75FF, 0x557F, 0x4D3F, 0x4D3F, 0x4D1F, 0x451F, 0x555F,
-
-    0xC6DE, 0xE73E, 0xA65E, 0x659F, 0x6D7F, 0x34BF, 0x2C9F, 0x347F,
-
-    0x2C7F, 0x2C5F, 0x245F, 0x551F, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 20
-
-    0xDF3E, 0xDF1E, 0x8E1F, 0x4D3F, 0x4D1F, 0x4D1F, 0x44FF, 0x553F,
-
-    0xCEFE, 0xDF3E, 0xDF1E, 0xDF3E, 0xD71E, 0x8DFF, 0x5D5F, 0x2C7F,
-
-    0x2C7F, 0x2C5F, 0x1C3F, 0x551F, 0xE73E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 21
-
-    0xDF1E, 0xDF3E, 0xDF3E, 0x8E1F, 0x453F, 0x451F, 0x44FF, 0x4D3F,
-
-    0xCEDE, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0xD6FE, 0x5D3F,
-
-    0x245F, 0x2C5F, 0x243F, 0x2C7F, 0x9E1E, 0xDF3E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 22
-
-    0xDF1E, 0xDF1E, 0xDF3E, 0xD71E, 0xB69E, 0x75BF, 0x34DF, 0x4D1F,
-
-    0xCEDE, 0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xD71E, 0xDF3E, 0xD6FE,
-
-    0x5D1F, 0x1C3F, 0x243F, 0x13FF, 0x5D1F, 0xE73E, 0xDF5E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 23
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE73E, 0xD71E, 0x657F, 0x9E3F,
-
-    0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E,
-
-    0xD6FE, 0x551F, 0x1C1F, 0x13FF, 0x653F, 0xE73E, 0xDF5E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 24
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E, 0xD6FE, 0xDF1E,
-
-    0xDF3E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF3E, 0xD6FE, 0x54DF, 0x03BF, 0x5D1F, 0xE73E, 0xDF5E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 25
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF3E, 0xCEDE, 0x54FF, 0x85BF, 0xDF3E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 26
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF3E, 0xDF3E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 27
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 28
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xE75E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,  // Row 29
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E,
-
-    0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xDF1E, 0xE75E, 0x6416,
-
-    0x6416, 0xEF7F, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E,  // Row 30
-
-    0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E,
-
-    0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E,
-
-    0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xE75E, 0xEF7F, 0x6416,
-
-    0x3B13, 0x6416, 0x63F6, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416,  // Row 31
-
-    0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416,
-
-    0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x6416,
-
-    0x6416, 0x6416, 0x6416, 0x6416, 0x6416, 0x63F6, 0x6416, 0x3B13   // Row 31
-};
-
-#endif // GOUSERBTN_32X32_H
@@ -0,0 +1,34 @@
+#ifndef HOT_PATH_H
+#define HOT_PATH_H
+
+// 핫 경로 배치 - 플래시 캐시를 거치지 않도록 코드는 IRAM, 상수 표는 DRAM 에 올림
+// (와이파이/플래시 쓰기로 캐시가 밀리면 플래시에서 도는 코드는 미스 한 번에 수백 사이클)
+// 후보는 플래시 코드를 부르지 않는 픽셀 루프(레이어 띠 채우기, 스프라이트 줄 풀기)와 픽셀마다 읽는 표뿐.
+// 기본은 꺼짐(0, 모두 플래시) - 보드에서 0/1 을 prof 로 비교해 (util/prof_ab.py, readme "핫 경로 배치")
+// 나아진 자리만 남기고 켬. 호스트는 가상 시계라 사이클을 잴 수 없음
+// Arduino 런타임 없이도 컴파일되어야 함 (util/qsim 이 대기열 코드를 그대로 씀)
+
+#ifndef QMS_IRAM_HOT
+#define QMS_IRAM_HOT 0
+#endif
+
+#if defined(ESP_PLATFORM)
+#include <esp_attr.h>
+#endif
+
+// 실제 배치 (prof 출력용): 보드에서 IRAM/flash, 호스트 빌드는 host
+#if QMS_IRAM_HOT && defined(ESP_PLATFORM)
+#define QMS_HOT IRAM_ATTR
+#define QMS_HOT_DATA DRAM_ATTR
+#define QMS_HOT_PLACEMENT "IRAM"
+#else
+#define QMS_HOT
+#define QMS_HOT_DATA
+#if defined(ESP_PLATFORM)
+#define QMS_HOT_PLACEMENT "flash"
+#else
+#define QMS_HOT_PLACEMENT "host"
+#endif
+#endif
+
+#endif
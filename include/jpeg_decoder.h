@@ -0,0 +1,108 @@
+#ifndef JPEG_DECODER_H
+#define JPEG_DECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 작은 RAM 으로 도는 baseline JPEG 디코더 (배경 이미지용)
+// - 8비트 baseline 허프만, 흑백 또는 YCbCr 4:4:4 / 4:2:2 / 4:2:0, 재시작 마커(DRI) 지원
+// - 프레임 버퍼 없이 MCU(8x8 ~ 16x16) 타일 단위로 RGB565 를 만들어 JpegTileSink 로 넘김
+// - begin() 에서 엔트로피 부호만 한 번 훑어 MCU 줄마다 비트 위치/DC 값을 기록해 두므로
+//   어느 MCU 줄이든 바로 풀 수 있음 (패널이 띠를 터치 가까운 순서로 보내도 처음부터 다시 풀지 않음)
+// - 입력은 JpegInput::readAt 으로 JPEG_INPUT_BYTES 씩 읽음 (SPIFFS 파일 / 매핑된 플래시)
+// progressive, 12비트, 산술 부호는 지원하지 않음 (begin() 이 false)
+
+#define JPEG_MAX_ROWS    40    // MCU 줄 수 상한 (8줄 MCU 기준 320줄)
+#define JPEG_INPUT_BYTES 512
+
+class JpegInput {
+public:
+  virtual ~JpegInput() {}
+  // pos 부터 최대 len 바이트. 읽은 바이트 수 (끝이면 0)
+  virtual size_t readAt(uint32_t pos, uint8_t* buf, size_t len) = 0;
+};
+
+class JpegTileSink {
+public:
+  virtual ~JpegTileSink() {}
+  // 이미지 좌표 (x, y) 의 w x h 타일 (이미지 가장자리에서 잘림). pixels 줄 간격은 stride
+  virtual void tile(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels, int16_t stride) = 0;
+};
+
+class JpegDecoder {
+public:
+  JpegDecoder();
+
+  // 헤더를 읽고 MCU 줄 색인을 만듦. invert 면 RGB565 를 뒤집어서 (패널 색 반전)
+  bool begin(JpegInput* source, bool invert);
+  bool ready() const { return rowCount > 0; }
+  // 입력을 놓음 (ready() 가 false)
+  void end() { rowCount = 0; input = nullptr; }
+
+  int16_t width() const { return imageWidth; }
+  int16_t height() const { return imageHeight; }
+  int16_t mcuWidth() const { return mcuW; }
+  int16_t mcuHeight() const { return mcuH; }
+  int rows() const { return rowCount; }
+
+  // MCU 줄 하나를 풀어서 타일마다 sink 로 넘김
+  bool decodeRow(int row, JpegTileSink& sink);
+
+private:
+  struct Huffman {
+    uint8_t values[256];
+    int32_t maxcode[17];  // 길이별 마지막 부호 (-1 = 없음)
+    uint16_t mincode[17];
+    uint8_t valptr[17];
+  };
+  struct Component {
+    uint8_t id, h, v, quant, dcTable, acTable;
+  };
+  // MCU 줄 시작의 엔트로피 디코더 상태
+  struct ScanState {
+    uint32_t pos;
+    uint32_t bits;
+    int8_t count;
+    int16_t dc[3];
+    uint16_t restartLeft;
+  };
+
+  JpegInput* input;
+  bool invert;
+  int16_t imageWidth, imageHeight;
+  int16_t mcuW, mcuH, mcusPerRow;
+  int rowCount;
+  uint8_t componentCount;
+  Component components[3];
+  uint16_t quant[4][64];  // 지그재그 순서
+  Huffman dcTables[2], acTables[2];
+  uint16_t restartInterval;
+  ScanState rowStart[JPEG_MAX_ROWS];
+  ScanState state;
+
+  // 입력 버퍼
+  uint8_t buffer[JPEG_INPUT_BYTES];
+  uint32_t bufferStart;
+  uint16_t bufferLength;
+
+  // MCU 작업 버퍼
+  int16_t coef[64];
+  uint8_t luma[16 * 16];
+  uint8_t chroma[2][64];
+  uint16_t tileOut[16 * 16];
+
+  int byteAt(uint32_t pos);
+  uint16_t read16(uint32_t pos);
+  bool parseHeaders();
+  bool parseHuffman(uint32_t pos, uint16_t length);
+
+  void fillBits();
+  uint32_t getBits(int n);
+  int decodeSymbol(const Huffman& table);
+  bool restart();
+  bool decodeBlock(const Component& c, int index, uint8_t* out, int stride, bool output);
+  bool decodeMcu(bool output);
+  void emitMcu(int mcuX, int row, JpegTileSink& sink);
+};
+
+#endif
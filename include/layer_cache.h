@@ -0,0 +1,137 @@
+#ifndef LAYER_CACHE_H
+#define LAYER_CACHE_H
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SPITFT.h>
+#include "display.h"
+
+// 화면 정적 레이어(배경, 제목, 고정 라벨, 키패드, 버튼) 캐시
+// 처음 방문할 때 한 번 래스터화해서 RLE(RGB565 런)로 RAM 에 보관하고,
+// 다시 그릴 때는 주소창 1개 + 런 단위 writeColor 로 바로 전송
+// (프레임 중이면 패널의 프레임 배경으로 지정해서 띠 단위로 나눠 전송)
+
+#define LAYER_SLOTS        16   // 캐시 가능한 레이어 수 (ScreenState 값을 그대로 id 로 사용)
+#define LAYER_STRIP_LINES  16   // 래스터화할 때 한 번에 메모리에 두는 줄 수
+#define LAYER_MAX_WIDTH    240
+#define LAYER_MAX_HEIGHT   320
+
+// 캐시 전체 RAM 상한 - 넘으면 가장 오래 안 쓴 레이어부터 버림
+#ifndef LAYER_CACHE_BYTES
+#define LAYER_CACHE_BYTES  (64 * 1024)
+#endif
+
+// 정적 레이어를 그리는 함수 (패널이나 캔버스 어느 쪽에도 그릴 수 있도록 GFX 를 받음)
+typedef void (*LayerPainter)(Adafruit_GFX& gfx);
+
+struct LayerRun {
+  uint16_t length;
+  uint16_t color;
+};
+
+// LAYER_STRIP_LINES 줄만 버퍼에 두는 캔버스 - 범위 밖 픽셀은 버림
+// 같은 painter 를 띠마다 다시 호출해서 전체 화면을 작은 RAM 으로 래스터화
+class StripCanvas : public Adafruit_GFX {
+public:
+  StripCanvas(int16_t w, int16_t h);
+  void setStrip(int16_t top);
+  int16_t stripTop() const { return top; }
+  const uint16_t* line(int16_t y) const { return &buffer[(y - top) * LAYER_MAX_WIDTH]; }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+private:
+  int16_t top;
+  uint16_t buffer[LAYER_MAX_WIDTH * LAYER_STRIP_LINES];
+};
+
+class LayerCache;
+
+// 캐시된 레이어를 프레임 배경으로 - 띠 시작마다 런 위치를 기억해 두고 띠 단위로 풀어 줌
+// keyed 면 key 색 픽셀은 채우지 않음 (아래 배경 이미지가 보이는 투명 영역)
+class LayerBandSource : public BandSource {
+public:
+  LayerBandSource() : id(LAYER_SLOTS), panel(nullptr), keyed(false), key(0) {}
+  void attach(uint8_t layerId, const LayerRun* layerRuns, uint32_t count, QmsDisplay& target,
+              bool keyed = false, uint16_t key = 0);
+  void fillBand(uint16_t* pixels, uint8_t* covered, int16_t top, int16_t lines, int16_t width) override;
+  void release() override { id = LAYER_SLOTS; }
+  uint8_t layer() const { return id; }
+  QmsDisplay* target() const { return panel; }
+
+private:
+  uint8_t id;  // LAYER_SLOTS = 사용 안 함
+  QmsDisplay* panel;
+  bool keyed;
+  uint16_t key;
+  const LayerRun* runs;
+  uint32_t bandRun[DISPLAY_BANDS];    // 띠 첫 픽셀이 있는 런
+  uint16_t bandSkip[DISPLAY_BANDS];   // 그 런에서 이미 지난 픽셀 수
+};
+
+class LayerCache {
+public:
+  LayerCache();
+
+  // 캐시에 있으면 그대로 전송, 없으면 래스터화해서 저장한 뒤 전송
+  // (RAM 이 부족하면 캐시하지 않고 painter 로 패널에 직접 그림)
+  void draw(uint8_t id, LayerPainter painter, QmsDisplay& panel);
+  // 사각 영역(화면 좌표)만 전송 (invert 면 색을 뒤집어서 - 버튼 누름 표시/복원용)
+  // 캐시가 없으면 먼저 래스터화하고, RAM 이 부족하면 아무것도 그리지 않고 false
+  bool drawRegion(uint8_t id, LayerPainter painter, QmsDisplay& panel,
+                  int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false);
+  // 프레임 배경(이미지) 위에 key 색을 뺀 픽셀만 겹침 - 패널 프레임의 underlay 로 화면 전체 예약
+  // 프레임 밖이거나 캐시할 RAM 이 없으면 아무것도 하지 않고 false
+  bool drawOver(uint8_t id, LayerPainter painter, QmsDisplay& panel, uint16_t key);
+
+  // 유휴 시간 선행 래스터화 - 호출마다 LAYER_STRIP_LINES 줄씩 진행하고 끝나면 true
+  // 다른 레이어를 버리지 않고 남은 RAM 안에서만 (모자라면 포기하고 true)
+  // 도중에 draw() 가 같은 레이어를 요청하면 남은 띠부터 이어서 래스터화
+  bool prefetch(uint8_t id, LayerPainter painter, int16_t w, int16_t h);
+
+  void invalidate(uint8_t id);
+  void clear();
+  bool cached(uint8_t id) const { return id < LAYER_SLOTS && runs[id] != nullptr; }
+  bool prefetchable(uint8_t id) const {
+    return id < LAYER_SLOTS && runs[id] == nullptr && !(prefetchBlocked & (1u << id));
+  }
+  size_t bytesUsed() const { return used; }
+
+private:
+  LayerRun* runs[LAYER_SLOTS];
+  uint32_t runCount[LAYER_SLOTS];
+  uint32_t lastUse[LAYER_SLOTS];
+  uint32_t useClock;
+  size_t used;
+  uint16_t prefetchBlocked;  // RAM 부족으로 선행 래스터화를 포기한 레이어 (비트)
+
+  // 진행 중인 래스터화 (prefetch 로 띠 단위로 나눠서 진행할 수 있음)
+  struct PendingRaster {
+    uint8_t id;        // LAYER_SLOTS = 없음
+    int16_t top;       // 다음 띠 시작 줄
+    LayerRun* out;
+    uint32_t count;
+    uint32_t capacity;
+  };
+  PendingRaster pending;
+  LayerBandSource background;  // 프레임 배경으로 쓰이는 동안 이 레이어는 버리지 않음
+  LayerBandSource overlay;     // drawOver() 로 배경 위에 겹치는 중인 레이어 (마찬가지)
+
+  void beginRaster(uint8_t id);
+  void abandonRaster();
+  bool rasterStrip(LayerPainter painter, int16_t w, int16_t h, bool evict);
+  void commitRaster();
+
+  bool rasterize(uint8_t id, LayerPainter painter, int16_t w, int16_t h);
+  bool makeRoom(size_t bytes, uint8_t keep);
+  void blit(uint8_t id, Adafruit_SPITFT& panel);
+  void blitRegion(uint8_t id, QmsDisplay& panel, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t mask);
+};
+
+extern LayerCache layerCache;
+// 래스터화용 띠 캔버스 (레이어 캐시와 모달 영역 저장이 함께 씀 - 한 번에 하나)
+extern StripCanvas stripCanvas;
+
+#endif
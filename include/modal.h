@@ -0,0 +1,61 @@
+#ifndef MODAL_H
+#define MODAL_H
+
+#include <Adafruit_GFX.h>
+#include "display.h"
+#include "layer_cache.h"
+
+// 모달 오버레이 (호출 창, 삭제 확인 창) 아래 영역 저장/복원
+// 패널에서 픽셀을 읽어 오지 않고(MISO 는 터치와 공유) 열 때 아래 화면 painter 로
+// 가려지는 사각형만 다시 래스터화해서 RLE 로 RAM 에 보관하고, 닫을 때 그 영역만 복원.
+// 복원은 패널 프레임의 underlay 로 띠 단위로 나눠 전송 (수직 스크롤 중이면 메모리 줄로 옮겨서).
+// 저장하지 못했으면 (painter 없음, RAM 부족, 아래 내용이 바뀜) close() 가 false →
+// 호출 측이 아래 화면 전체를 다시 그림
+
+// 저장 RLE 버퍼 상한
+#ifndef MODAL_SAVE_BYTES
+#define MODAL_SAVE_BYTES (32 * 1024)
+#endif
+
+class ModalOverlay : public BandSource {
+public:
+  ModalOverlay();
+
+  // 화면 좌표 사각형을 가리는 모달을 엶. under 가 nullptr 이거나 RAM 이 모자라면 저장 없이 열고 false
+  bool open(QmsDisplay& panel, int16_t x, int16_t y, int16_t w, int16_t h, LayerPainter under);
+  // 저장한 영역을 복원하도록 패널 프레임에 예약하고 닫음. 저장분이 없으면 false
+  bool close();
+  // 저장분을 버림 (모달 아래 내용이 바뀌었거나 아래 화면을 통째로 다시 그릴 때)
+  void discard();
+  // 복원하지 않고 닫음 (아래 화면을 통째로 다시 그릴 때)
+  void cancel() {
+    discard();
+    opened = false;
+  }
+
+  bool active() const { return opened; }
+  bool saved() const { return runs != nullptr; }
+  bool contains(int x, int y) const {
+    return opened && x >= boxX && x < boxX + boxW && y >= boxY && y < boxY + boxH;
+  }
+  size_t bytesUsed() const { return capacity * sizeof(LayerRun); }
+
+  void fillBand(uint16_t* pixels, uint8_t* covered, int16_t top, int16_t lines, int16_t width) override;
+  void release() override;
+
+private:
+  QmsDisplay* panel;
+  bool opened;
+  bool restoring;  // close() 후 패널이 아직 복원 띠를 보내는 중
+  int16_t boxX, boxY, boxW, boxH;
+
+  LayerRun* runs;        // 줄 경계에서 끊긴 런 (줄마다 boxW 픽셀)
+  uint32_t count;
+  uint32_t capacity;
+  uint16_t rowStart[LAYER_MAX_HEIGHT + 1];  // 줄마다 첫 런 번호
+
+  bool save(LayerPainter under);
+  void freeRuns();
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdint.h>
+#include "hot_path.h"
+
+// 구간별 CPU 사이클 측정 (Xtensa CCOUNT 레지스터)
+//
+//   void drawUserMode() {
+//     QMS_PROFILE_FUNCTION();          // 함수 전체, 이름은 __func__
+//     ...
+//     { QMS_PROFILE_SCOPE("fields"); ... }
+//   }
+//
+// 자리마다 static 기록(이름 포인터, 횟수, 합계, 최소, 최대)이 하나씩 생기고, 구간을 벗어날 때 더함.
+// 이름은 빌드 때 정해진 문자열을 가리키기만 하고 출력할 때까지 건드리지 않음.
+// 처음 지날 때 목록에 한 번 이어 붙인 뒤로는 인라인 코드만 돌아서 IRAM 핫 경로 안에서도 씀.
+// 한 자리를 두 코어에서 동시에 지나면 값이 조금 틀릴 수 있음 (잠금 없음).
+// CCOUNT 는 240MHz 에서 약 17.9초마다 되감기므로 그보다 긴 구간은 재지 말 것.
+//
+// -D QMS_PROFILE=0 이면 매크로가 아무것도 만들지 않음 (코드에 계속 두어도 됨).
+// 보드 빌드는 기본 1, 호스트/시뮬레이터 빌드는 기본 0 (대기열 코드는 Arduino 없이도 컴파일)
+
+#ifndef QMS_PROFILE
+#if defined(ESP_PLATFORM)
+#define QMS_PROFILE 1
+#else
+#define QMS_PROFILE 0
+#endif
+#endif
+
+// 재는 코드는 항상 부르는 쪽에 펼침 - 함수 호출로 남으면 IRAM 핫 경로에서 플래시로 뛰게 됨
+#define QMS_PROFILE_INLINE inline __attribute__((always_inline))
+
+struct ProfileSite {
+  const char* name;
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  ProfileSite* next;
+  uint32_t linked;  // 목록에 붙었는지 (원자적으로 바꾸므로 32비트)
+};
+
+#if defined(__XTENSA__)
+static QMS_PROFILE_INLINE uint32_t profileCycles() {
+  uint32_t cycles;
+  asm volatile("rsr %0, ccount" : "=a"(cycles));
+  return cycles;
+}
+#else
+uint32_t profileCycles();  // 호스트: 가상 시계를 240MHz 로 환산
+#endif
+
+class Print;
+
+// 처음 지난 자리를 목록에 이어 붙임
+void profileLink(ProfileSite* site);
+// 지나간 자리들의 표 (시리얼 prof, 재생 끝) / 값만 지움
+void printProfile(Print& out);
+void resetProfile();
+
+class ProfileScope {
+public:
+  QMS_PROFILE_INLINE explicit ProfileScope(ProfileSite& site) : site(site), start(profileCycles()) {}
+  QMS_PROFILE_INLINE ~ProfileScope() {
+    uint32_t cycles = profileCycles() - start;
+    if (!site.linked) profileLink(&site);
+    site.count++;
+    site.totalCycles += cycles;
+    if (cycles < site.minCycles) site.minCycles = cycles;
+    if (cycles > site.maxCycles) site.maxCycles = cycles;
+  }
+
+private:
+  ProfileSite& site;
+  uint32_t start;
+};
+
+#if QMS_PROFILE
+#define QMS_PROFILE_JOIN2(a, b) a##b
+#define QMS_PROFILE_JOIN(a, b) QMS_PROFILE_JOIN2(a, b)
+#define QMS_PROFILE_SCOPE(label)                                                                        \
+  static ProfileSite QMS_PROFILE_JOIN(profileSite, __LINE__) = {label, 0, UINT32_MAX, 0, 0, nullptr, 0}; \
+  ProfileScope QMS_PROFILE_JOIN(profileScope, __LINE__)(QMS_PROFILE_JOIN(profileSite, __LINE__))
+#define QMS_PROFILE_FUNCTION() QMS_PROFILE_SCOPE(__func__)
+#else
+#define QMS_PROFILE_SCOPE(label)
+#define QMS_PROFILE_FUNCTION()
+#endif
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef QMS_QUEUE_H
+#define QMS_QUEUE_H
+
+#include "ticket_log.h"
+
+// 대기열 관리 및 대기시간(ETA) 계산
+// Arduino 런타임에 의존하지 않음 - 시각은 호출하는 쪽에서 넘겨줌
+// (펌웨어는 millis(), 호스트 시뮬레이터는 가상 시계)
+
+#ifndef QUEUE_CAPACITY
+#define QUEUE_CAPACITY 200
+#endif
+
+extern int queueList[QUEUE_CAPACITY];  // 대기열 번호 목록
+extern int queueCount;                 // 현재 대기열 개수
+extern int waitingCount;               // 현재 대기 인원
+extern int waitingTimeSec;             // 예상 대기시간(초)
+extern int userProcessTimeSec;         // 1명당 처리 시간(초)
+extern unsigned long lastProcessTime;  // 마지막 처리 완료 시각
+extern TicketLog ticketLog;            // 티켓별 발행/호출/처리 시각 기록
+
+void addToQueue(int ticketNum, unsigned long nowMs, uint8_t ticketClass = TICKET_CLASS_KIOSK);
+void removeFromQueue(int index, unsigned long nowMs);
+
+// 맨 앞 티켓 처리 완료. 실제 대기시간(초)을 반환 (처리할 티켓이 없으면 -1)
+int serveQueueHead(unsigned long nowMs);
+
+// 자동 처리 시점 도달 여부 (맨 앞 사람의 처리 시간이 지났는지)
+bool queueHeadDue(unsigned long nowMs);
+
+// 현재 처리 중인 사람의 남은 시간(초)
+int remainingForCurrentSec(unsigned long nowMs);
+
+// 대기열 전체가 끝날 때까지의 예상 시간(초) - 사용자 화면 표시용
+int expectedWaitSec(unsigned long nowMs);
+
+#endif
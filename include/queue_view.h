@@ -0,0 +1,75 @@
+#ifndef QUEUE_VIEW_H
+#define QUEUE_VIEW_H
+
+#include <Adafruit_GFX.h>
+#include "display.h"
+
+// 대기열 목록 가상화 뷰
+// 목록 전체(콘텐츠 좌표)를 그리지 않고 보이는 줄만 그린다.
+// 스크롤은 ST7789 수직 스크롤로 기존 픽셀을 밀고, 새로 드러난 줄만 그림
+// (콘텐츠 y 는 패널 메모리 줄 top + (y % area) 에 대응)
+
+// 한 항목을 그리는 함수 - 콘텐츠 좌표 (x, y) 에 w x h 크기로
+typedef void (*QueueItemPainter)(Adafruit_GFX& gfx, int index, int16_t x, int16_t y, int16_t w, int16_t h);
+
+struct QueueViewLayout {
+  int16_t top;         // 고정 상단 높이 (= 목록 시작 화면 y)
+  int16_t bottom;      // 고정 하단 높이
+  int16_t left;        // 첫 열 x
+  int16_t columns;
+  int16_t itemWidth;
+  int16_t itemHeight;
+  int16_t gap;         // 항목 사이 간격 (가로/세로)
+  uint16_t background;
+};
+
+class QueueListView {
+public:
+  QueueListView(const QueueViewLayout& layout);
+
+  // 화면 진입: 스크롤 영역 설정 후 현재 위치의 보이는 줄 전체를 그림
+  // (보기 영역이 이미 배경색이면 backgroundReady 로 배경 채우기를 생략)
+  void show(QmsDisplay& panel, int itemCount, QueueItemPainter painter, bool backgroundReady = false);
+  // 화면 이탈: 스크롤 해제 (다음 화면은 일반 좌표로 그림)
+  void hide(QmsDisplay& panel);
+
+  // 스크롤 (px, 양수 = 아래쪽 항목으로). 실제로 움직인 px 반환
+  int scrollBy(QmsDisplay& panel, int deltaPx);
+  int scrollTo(QmsDisplay& panel, int offsetPx);
+
+  // 항목 수가 바뀐 뒤 fromIndex 이후 항목이 있는 보이는 줄을 다시 그리도록 예약 (제자리 삭제)
+  // 여러 줄의 글자를 한 번에 기록하면 표시 목록이 넘쳐 동기 전송이 되므로 pump() 에서 한 줄씩 그림
+  void refresh(QmsDisplay& panel, int itemCount, int fromIndex);
+  // 예약된 줄 중 지금 보이는 첫 항목 줄 하나를 그림. 남은 것이 있으면 true
+  bool pump(QmsDisplay& panel);
+  bool pending() const { return pendingTop < pendingBottom; }
+
+  // 보이는 항목을 화면 좌표로 그림 (스크롤 반영 - 화면 일부를 다시 래스터화할 때)
+  void paintVisible(Adafruit_GFX& gfx) const;
+
+  // 화면 좌표 → 항목 인덱스 (없으면 -1)
+  int itemAt(int x, int y) const;
+  bool contains(int x, int y) const;
+
+  int offset() const { return scrollOffset; }
+  int maxOffset() const;
+  int rowPitch() const { return layout.itemHeight + layout.gap; }
+  int viewHeight() const { return area; }
+  bool visible() const { return shown; }
+
+private:
+  QueueViewLayout layout;
+  int16_t area;        // 스크롤 영역 높이
+  int scrollOffset;    // 보이는 첫 콘텐츠 줄
+  int count;
+  bool shown;
+  QueueItemPainter paint;
+  int pendingTop, pendingBottom;  // 다시 그릴 콘텐츠 구간 [top, bottom)
+
+  uint16_t memoryLine(int contentY) const { return layout.top + contentY % area; }
+  // 콘텐츠 [y0, y1) 구간을 해당 메모리 줄에 다시 그림 (y1 - y0 <= area)
+  void drawContent(QmsDisplay& panel, int y0, int y1, bool fillBackground = true);
+  void invalidate(int y0, int y1);
+};
+
+#endif
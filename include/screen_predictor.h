@@ -0,0 +1,26 @@
+#ifndef SCREEN_PREDICTOR_H
+#define SCREEN_PREDICTOR_H
+
+#include <stdint.h>
+
+// 화면 전환 빈도표 → 지금 화면 다음에 올 가능성이 높은 화면
+// 유휴 시간에 그 화면의 정적 레이어를 미리 래스터화하는 데 사용 (layerCache.prefetch)
+
+#define PREDICT_SCREENS 16   // LAYER_SLOTS 와 같음 (ScreenState 값을 그대로 사용)
+
+class ScreenPredictor {
+public:
+  ScreenPredictor();
+
+  // from → to 전환 기록 (한 줄이 넘칠 것 같으면 그 줄 전체를 절반으로)
+  void record(uint8_t from, uint8_t to, uint16_t weight = 1);
+  // from 다음 후보를 빈도순으로 최대 n 개 out 에 (한 번도 없었던 화면은 제외). 개수 반환
+  int likely(uint8_t from, uint8_t* out, int n) const;
+
+private:
+  uint16_t counts[PREDICT_SCREENS][PREDICT_SCREENS];
+};
+
+extern ScreenPredictor screenPredictor;
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef SCREEN_SLIDE_H
+#define SCREEN_SLIDE_H
+
+#include "display.h"
+
+// 화면 전환 슬라이드 (하드웨어 수직 스크롤)
+// 새 화면을 평소처럼 패널 프레임에 그려 둔 뒤(아직 안 보낸 띠) 스크롤 시작 줄을 옮겨 이전 화면을 밀어내고,
+// 화면 밖에서 들어오는 쪽 띠를 드러나는 순서대로 보냄. 이전 화면은 다시 그리지 않으므로
+// 전송량은 하드 컷과 같고(+ 스크롤 명령), 새 화면 픽셀은 한 번씩만 나감.
+// 트윈이 목표 줄 수를 정하고, loop 마다 pump() 가 예산 안에서 목표까지 띠 단위(16줄)로 보내며 스크롤함.
+// 전송이 밀리면 스크롤도 보낸 띠까지만 가서 찢어짐 없이 늦어짐.
+// 슬라이드 중에는 pumpFrame 대신 pump() (띠 순서가 바뀌면 안 됨)
+
+class ScreenSlide {
+public:
+  ScreenSlide();
+
+  // 새 화면을 프레임에 다 그린 직후. up 이면 새 화면이 아래에서 올라오고, 아니면 위에서 내려옴
+  // 프레임 밖이거나 다른 스크롤 중인 화면이면 false (그냥 보통 전송)
+  // 앞 슬라이드가 아직 진행 중이면 남은 띠를 보내지 않고 버림 (새 화면이 프레임을 덮었으므로)
+  bool begin(QmsDisplay& panel, bool up);
+  // 드러낼 줄 수 (0 ~ 화면 높이)
+  void setTarget(int16_t lines) { target = lines; }
+  // budgetUs 안에서 목표까지 띠를 보내고 보낸 만큼 스크롤. 화면 높이까지 다 드러나면 스크롤 해제하고 false
+  bool pump(uint32_t budgetUs);
+  bool active() const { return panel != nullptr; }
+
+private:
+  QmsDisplay* panel;
+  bool up;
+  int16_t target;
+  int16_t revealed;  // 보내고 스크롤까지 옮긴 줄 수 (띠 배수)
+
+  void reveal(int16_t lines);
+  void end();
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef SPI_BUS_H
+#define SPI_BUS_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// SPI 버스 중재
+// 한 버스를 여러 장치가 나눠 쓸 때 트랜잭션이 섞이지 않도록 잠그고,
+// 장치가 바뀐 횟수(= SPISettings 클럭/모드 재설정 횟수)를 집계
+// 트랜잭션 자체는 각 라이브러리(Adafruit_SPITFT, XPT2046)가 장치 설정으로 염
+// 장치가 버스를 혼자 쓰면 전환은 0 으로 유지됨
+
+struct SpiDevice {
+  const char* name;
+  SPISettings settings;
+  uint32_t clockHz;  // 표시용 (SPISettings 는 값을 읽을 수 없음)
+};
+
+class SpiBus {
+public:
+  SpiBus(const char* name, SPIClass& spi);
+  void begin();
+
+  // 장치가 버스를 쓰는 동안 잠금 (같은 장치의 중첩 호출은 하지 않음)
+  void acquire(const SpiDevice& device);
+  void release();
+
+  SPIClass& spi() { return bus; }
+  const char* name() const { return busName; }
+  const SpiDevice* owner() const { return lastOwner; }
+  uint32_t ownerSwitches() const { return switches; }
+
+private:
+  const char* busName;
+  SPIClass& bus;
+  const SpiDevice* lastOwner;
+  uint32_t switches;
+#ifdef ARDUINO_ARCH_ESP32
+  SemaphoreHandle_t mutex;
+#endif
+};
+
+extern SpiDevice tftDevice;
+extern SpiDevice touchDevice;
+extern SpiBus tftBus;
+extern SpiBus& touchBus;  // 공유 배선이면 tftBus 와 같은 객체
+
+#endif
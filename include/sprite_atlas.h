@@ -0,0 +1,41 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SPITFT.h>
+#include "hot_path.h"
+
+// 팔레트 인덱스 스프라이트 아틀라스 (util/sprite_atlas.py 로 생성)
+// 모든 스프라이트의 인덱스를 배열 하나에 이어 붙이고, 사각형 표로 각 스프라이트 위치를 찾음.
+// 그릴 때 한 줄씩 팔레트(LUT)로 RGB565 줄 버퍼에 풀어서 전송.
+// 팔레트는 반전/패널 전송 순서가 미리 적용되어 있어 줄 버퍼를 그대로 writePixels 로 보냄.
+// 4비트 인덱스는 앞 픽셀이 상위 니블, 줄마다 바이트 경계에 맞춤
+
+#define SPRITE_MAX_WIDTH 240
+
+// 0 이면 생성된 아틀라스 헤더의 픽셀 데이터를 펌웨어에 넣지 않음 (에셋 파티션에서만 읽음)
+#ifndef QMS_ASSET_BUILTIN
+#define QMS_ASSET_BUILTIN 1
+#endif
+
+struct SpriteRect {
+  uint32_t offset;   // 인덱스 배열에서 시작 바이트
+  uint16_t width;
+  uint16_t height;
+  uint16_t palette;  // 팔레트에서 시작 (공유 팔레트면 0)
+};
+
+struct SpriteAtlas {
+  uint8_t bits;             // 픽셀당 인덱스 비트 (4 / 8)
+  const uint16_t* palette;  // 내장 아틀라스는 DRAM (QMS_HOT_DATA), 에셋 파티션은 매핑된 플래시
+  const uint8_t* pixels;    // PROGMEM
+  const SpriteRect* rects;  // PROGMEM
+  uint8_t count;
+};
+
+// 패널에 주소창 하나를 열고 줄마다 LUT 로 풀어서 전송
+void streamSprite(Adafruit_SPITFT& panel, int16_t x, int16_t y, const SpriteAtlas& atlas, uint8_t id);
+// 캔버스(레이어 래스터화 등)에 그림 - 풀어 낸 줄에서 같은 색 구간마다 가로선 하나
+void drawSprite(Adafruit_GFX& g, int16_t x, int16_t y, const SpriteAtlas& atlas, uint8_t id);
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef STATUS_JSON_H
+#define STATUS_JSON_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 외부 안내판용 대기열 상태 JSON (시리얼 status 명령, HTTP GET /status)
+//
+// 전체: {"seq":12,"serving":41,"waiting":5,"eta":240,"issued":45,"process":60,"next":[42,43,44,45],"recent":[38,39,40]}
+// 변화분: {"seq":14,"since":12,"eta":230} - since 이후에 바뀐 필드만 (since 가 있으면 변화분)
+//   serving 지금 처리 중인 번호 (0 = 없음), waiting 대기 인원, eta 대기열이 끝날 때까지 초,
+//   issued 마지막 발행 번호, process 1명당 처리 시간(초), next 다음 차례, recent 최근 처리 완료
+// 필드마다 마지막으로 바뀐 순번을 기억하므로 아무리 오래된 since 도 정확한 변화분이 나옴.
+// since 가 지금 순번보다 크면 (재부팅 등) 전체를 보냄.
+// 고정 버퍼에 바로 써 넣음 (힙/문서 객체 없음). Arduino 런타임 없이도 컴파일됨
+
+#define STATUS_NEXT       4     // next 목록 길이
+#define STATUS_RECENT     3     // recent 목록 길이
+#define STATUS_JSON_MAX   256   // 가장 긴 전체 문서(모든 값이 10자리)보다 큼
+
+// 고정 버퍼에 JSON 을 이어 씀. 정수 값과 이스케이프가 필요 없는 키만
+class JsonWriter {
+private:
+  char* out;
+  size_t size;
+  size_t used;
+  bool overflow;
+  bool first;   // 지금 객체/배열에서 아직 쓴 항목이 없음
+
+  void put(char c);
+  void putNumber(int32_t value);
+  void separator();
+
+public:
+  JsonWriter(char* buffer, size_t capacity);
+  void beginObject();
+  void endObject();
+  void beginArray(const char* key);
+  void endArray();
+  void field(const char* key, int32_t value);
+  void item(int32_t value);
+  // 쓴 길이 (넘쳤으면 0), 버퍼는 항상 '\0' 으로 끝남
+  size_t finish();
+};
+
+struct QueueStatus {
+  int32_t serving;
+  int32_t waiting;
+  int32_t etaSec;
+  int32_t issued;
+  int32_t processSec;
+  uint8_t nextCount;
+  int32_t next[STATUS_NEXT];
+};
+
+enum StatusField {
+  STATUS_SERVING,
+  STATUS_WAITING,
+  STATUS_ETA,
+  STATUS_ISSUED,
+  STATUS_PROCESS,
+  STATUS_NEXT_LIST,
+  STATUS_RECENT_LIST,
+  STATUS_FIELD_COUNT
+};
+
+// 상태 스냅샷을 받아 필드별 변경 순번을 관리하고 전체/변화분 문서를 씀
+class StatusFeed {
+private:
+  QueueStatus current;
+  int32_t recent[STATUS_RECENT];   // 최근 처리 완료 (오래된 것부터)
+  uint8_t recentCount;
+  bool recentChanged;
+  uint32_t seq;
+  uint32_t fieldSeq[STATUS_FIELD_COUNT];
+
+public:
+  StatusFeed();
+  void noteServed(int32_t ticket);
+  // 바뀐 필드가 있으면 순번을 올림. 지금 순번을 반환
+  uint32_t update(const QueueStatus& now);
+  // since = 0 이면 전체. 쓴 길이 (넘치면 0)
+  size_t write(char* out, size_t size, uint32_t since) const;
+  uint32_t sequence() const { return seq; }
+};
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef THROUGHPUT_SERIES_H
+#define THROUGHPUT_SERIES_H
+
+#include <stdint.h>
+
+// 해상도별 버킷 개수
+#define SERIES_MINUTE_BUCKETS 60    // 최근 1시간 (1분 단위)
+#define SERIES_HOUR_BUCKETS   168   // 최근 1주 (1시간 단위)
+#define SERIES_DAY_BUCKETS    365   // 최근 1년 (1일 단위)
+
+// 시계열 전체가 차지할 수 있는 최대 RAM (바이트)
+#define SERIES_RAM_CAP 8192
+
+// 플래시(SPIFFS) 저장 파일 - QMS_SERIES_SPILL 빌드 플래그가 있을 때만 사용
+#define SERIES_SPILL_PATH "/series_day.bin"
+
+enum SeriesResolution {
+  SERIES_MINUTE,
+  SERIES_HOUR,
+  SERIES_DAY
+};
+
+enum SeriesMetric {
+  METRIC_SERVED,       // 처리 인원
+  METRIC_ISSUED,       // 발행 인원
+  METRIC_QUEUE,        // 평균 대기열 길이
+  METRIC_WAIT          // 실제 대기시간 (예상 대기시간은 마커로 표시)
+};
+
+// 버킷 1개 (10바이트)
+struct SeriesBucket {
+  uint16_t issued;
+  uint16_t served;
+  uint8_t queueAvg;
+  uint8_t queueMax;
+  uint16_t estWaitSec;     // 발행 시점 예상 대기시간 평균
+  uint16_t actualWaitSec;  // 처리 시점 실제 대기시간 평균
+};
+
+// 상위 해상도로 내려보내기 위한 누적값
+struct SeriesAccum {
+  uint32_t issued;
+  uint32_t served;
+  uint32_t queueSum;
+  uint32_t queueSamples;
+  uint32_t estWaitSum;
+  uint32_t estWaitCount;
+  uint32_t actualWaitSum;
+  uint32_t actualWaitCount;
+  uint8_t queueMax;
+
+  void reset();
+  void merge(const SeriesAccum& other);
+  SeriesBucket toBucket() const;
+};
+
+// 다중 해상도 링 버퍼 시계열
+// 1분이 끝나면 분 버킷을 기록하고 시간 누적값에 합산, 60분이 차면 시간 버킷으로,
+// 24시간이 차면 일 버킷으로 내려보냄 (각 단계 O(1))
+class ThroughputSeries {
+private:
+  SeriesBucket minutes[SERIES_MINUTE_BUCKETS];
+  SeriesBucket hours[SERIES_HOUR_BUCKETS];
+  SeriesBucket days[SERIES_DAY_BUCKETS];
+  uint16_t minuteHead, minuteFilled;
+  uint16_t hourHead, hourFilled;
+  uint16_t dayHead, dayFilled;
+
+  SeriesAccum minuteAcc;
+  SeriesAccum hourAcc;
+  SeriesAccum dayAcc;
+  uint8_t minutesInHour;
+  uint8_t hoursInDay;
+
+  unsigned long minuteStartMs;
+  unsigned long lastSampleMs;
+
+  void closeMinute();
+  void closeHour();
+  void closeDay();
+  void spillDay(const SeriesBucket& bucket);
+
+public:
+  ThroughputSeries();
+  void begin(unsigned long nowMs);
+  // 플래시에 저장된 일 버킷 복원 (QMS_SERIES_SPILL). 부팅 때 첫 화면을 늦추지 않도록 begin 과 따로,
+  // 첫 일 마감 전에 한 번만 부름
+  void loadSpilledDays();
+  void update(unsigned long nowMs, int queueLength);
+  void recordIssue(int estimatedWaitSec);
+  void recordServe(int actualWaitSec);
+
+  int bucketCount(SeriesResolution res) const;
+  // 오래된 순서로 index번째 버킷
+  const SeriesBucket& bucketAt(SeriesResolution res, int index) const;
+
+  // 차트용 막대 높이 계산 (여러 버킷을 한 열로 묶어 maxCols 이하로 맞춤)
+  // markers 가 있으면 METRIC_WAIT 의 예상 대기시간 높이를 채움
+  // 반환값: 열 개수, peak: 스케일 기준 최대값
+  int buildColumns(SeriesResolution res, SeriesMetric metric, uint8_t* heights, uint8_t* markers,
+                   int maxCols, uint8_t maxHeight, uint16_t& peak) const;
+};
+
+#endif
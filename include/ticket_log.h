@@ -0,0 +1,80 @@
+#ifndef TICKET_LOG_H
+#define TICKET_LOG_H
+
+#include <stdint.h>
+
+// 티켓 레코드 아레나 크기 (번호 % 크기로 슬롯 직접 매핑)
+// 대기열 최대 인원보다 커야 대기 중인 티켓이 덮어써지지 않음
+#ifndef TICKET_ARENA_SIZE
+#define TICKET_ARENA_SIZE 256
+#endif
+
+// 아직 기록되지 않은 시각
+#define TICKET_TIME_NONE 0xFFFFFFFFUL
+
+// 티켓 종류 (레코드의 class 바이트)
+enum TicketClass : uint8_t {
+  TICKET_CLASS_KIOSK = 0,    // 키오스크에서 직접 발행
+  TICKET_CLASS_REMOTE = 1    // 외부(시리얼 등)에서 발행
+};
+
+// P² 알고리즘 기반 스트리밍 분위수 추정기
+// 과거 값을 저장하지 않고 마커 5개만으로 분위수를 근사
+class StreamingQuantile {
+private:
+  float p;          // 목표 분위 (0.5 = 중앙값)
+  float q[5];       // 마커 높이
+  float n[5];       // 마커 실제 위치
+  float np[5];      // 마커 목표 위치
+  float dn[5];      // 목표 위치 증가량
+  uint32_t count;
+
+public:
+  StreamingQuantile(float quantile);
+  void reset();
+  void add(float x);
+  float value() const;
+  uint32_t samples() const { return count; }
+};
+
+// 티켓 생애주기 기록 (발행 → 호출 → 처리 완료)
+// struct-of-arrays 로 배치해 한 필드만 훑는 스캔이 캐시에 연속으로 올라가게 함
+// 시각은 begin() 기준 32비트 밀리초 오프셋
+class TicketLog {
+private:
+  uint16_t ids[TICKET_ARENA_SIZE];
+  uint32_t issueMs[TICKET_ARENA_SIZE];
+  uint32_t callMs[TICKET_ARENA_SIZE];
+  uint32_t serveMs[TICKET_ARENA_SIZE];
+  uint8_t classes[TICKET_ARENA_SIZE];
+  uint32_t baseMs;
+
+  StreamingQuantile waitP50;
+  StreamingQuantile waitP90;
+  StreamingQuantile serviceP50;
+  StreamingQuantile serviceP90;
+
+  int findSlot(uint16_t id) const;
+
+public:
+  TicketLog();
+  void begin(unsigned long nowMs);
+  void issue(uint16_t id, uint8_t ticketClass, unsigned long nowMs);
+  void call(uint16_t id, unsigned long nowMs);
+  bool serve(uint16_t id, unsigned long nowMs);
+  void cancel(uint16_t id);
+
+  // 레코드 조회 (없거나 기록 전이면 TICKET_TIME_NONE)
+  uint32_t issuedAt(uint16_t id) const;
+  uint32_t calledAt(uint16_t id) const;
+  uint32_t servedAt(uint16_t id) const;
+
+  // 처리 완료 시점마다 갱신되는 통계 (초 단위)
+  float waitSecP50() const { return waitP50.value() / 1000.0f; }
+  float waitSecP90() const { return waitP90.value() / 1000.0f; }
+  float serviceSecP50() const { return serviceP50.value() / 1000.0f; }
+  float serviceSecP90() const { return serviceP90.value() / 1000.0f; }
+  uint32_t servedCount() const { return waitP50.samples(); }
+};
+
+#endif
@@ -2,10 +2,18 @@
 #define TOUCH_H
 
 #include <XPT2046_Touchscreen.h>
+#include "board.h"
+#include "touch_trace.h"
 
-// 터치스크린 핀 설정 (main.cpp와 동일하게)
-#define TOUCH_CS 5
-#define TOUCH_IRQ 17
+// 터치 컨트롤러 드라이버 (핀/버스는 board.h)
+// 공유 버스는 기존 라이브러리, 별도 버스(HSPI/비트뱅)는 Xpt2046Bus
+#if QMS_TOUCH_BUS == TOUCH_BUS_SHARED
+typedef XPT2046_Touchscreen TouchController;
+#else
+#include "xpt2046_bus.h"
+typedef Xpt2046Bus TouchController;
+#define TOUCH_HAS_OWN_BUS 1
+#endif
 
 // 터치 보정값 (실측 좌표계 기준 - 90도 회전)
 // Raw X: 3800(LT) ~ 250(RB)
@@ -17,19 +25,49 @@
 
 class TouchModule {
 private:
-    XPT2046_Touchscreen ts;
+    TouchController ts;
     int screenWidth;
     int screenHeight;
+    
+    // 기록/재생
+    TouchTraceWriter recorder;
+    TouchTraceReader player;
+    bool replaying;
+    uint32_t replayStartUs;
+    
+    // 별도 버스일 때 백그라운드 샘플링 (TFT 전송과 병렬)
+    bool samplingTask;
+    TouchSample latest;
+    TouchSample readLive();
+    static void samplingLoop(void* arg);
 
 public:
     TouchModule(int width, int height);
     void begin();
+    // 터치가 별도 버스면 다른 코어에서 주기적으로 샘플링 (공유 버스면 false)
+    bool startSamplingTask(uint32_t periodMs);
     bool isTouched();
     TS_Point getRawPoint();
     int mapX(int rawX);
     int mapY(int rawY);
     void getScreenCoordinates(int& screenX, int& screenY);
     void printRawCoordinates();
+    
+    // loop() 1회당 1번 호출하는 샘플링 입구 (기록/재생이 여기서 처리됨)
+    TouchSample sample();
+    void toScreen(const TouchSample& s, int& screenX, int& screenY);
+    
+    // 샘플 기록 (프레임으로 감싸서 output 으로 내보냄)
+    void startRecording(Print& output);
+    uint32_t stopRecording();
+    bool isRecording() const { return recorder.active(); }
+    
+    // 기록된 샘플 재생 (buffer 는 재생이 끝날 때까지 유지되어야 함)
+    bool startReplay(const uint8_t* buffer, size_t len);
+    void stopReplay() { replaying = false; }
+    bool isReplaying() const { return replaying; }
+    // 다음 샘플 시각 (재생 시작 기준 us)
+    bool nextReplayTime(uint32_t& offsetUs) const { return player.peekTime(offsetUs); }
 };
 
 #endif
@@ -0,0 +1,69 @@
+#ifndef TOUCH_TRACE_H
+#define TOUCH_TRACE_H
+
+#include <Arduino.h>
+
+// 터치 샘플 기록 포맷 (.qtt)
+//
+// 파일 = "QTT1" + 레코드 반복
+// 레코드 = varint((이전 샘플과의 시간차 us) << 1 | 펜다운)
+//          + 펜다운이면 x/y/z 각 12비트를 5바이트로 묶은 값
+// 펜업 샘플은 1~2바이트, 펜다운 샘플은 보통 6~7바이트
+//
+// 시리얼로 내보낼 때는 디버그 출력과 섞여도 분리할 수 있게 프레임으로 감쌈
+// 프레임 = 0xA5 'T' 길이(1) 페이로드 CRC8(페이로드)
+
+#define TRACE_MAGIC       "QTT1"
+#define TRACE_MAGIC_LEN   4
+#define TRACE_FRAME_SYNC  0xA5
+#define TRACE_FRAME_TYPE  'T'
+#define TRACE_FRAME_MAX   64
+
+// loop() 한 번에 읽은 터치 샘플
+struct TouchSample {
+  uint32_t timeUs;   // micros() 기준
+  bool down;
+  int16_t x, y, z;   // Raw 좌표 (XPT2046)
+};
+
+uint8_t traceCrc8(const uint8_t* data, size_t len);
+
+// 샘플을 인코딩해서 프레임 단위로 내보냄
+class TouchTraceWriter {
+private:
+  Print* out;
+  uint8_t frame[TRACE_FRAME_MAX];
+  uint8_t used;
+  uint32_t lastUs;
+  uint32_t sampleCount;
+
+  void put(const uint8_t* data, uint8_t len);
+  void flush();
+
+public:
+  TouchTraceWriter();
+  void begin(Print& output, uint32_t nowUs);
+  void add(const TouchSample& sample);
+  void end();
+  bool active() const { return out != nullptr; }
+  uint32_t samples() const { return sampleCount; }
+};
+
+// 메모리에 올린 .qtt 파일을 순서대로 디코딩
+class TouchTraceReader {
+private:
+  const uint8_t* data;
+  size_t length;
+  size_t pos;
+  uint32_t timeUs;
+
+public:
+  TouchTraceReader();
+  bool begin(const uint8_t* buffer, size_t len);
+  bool next(TouchSample& sample);
+  bool atEnd() const { return data == nullptr || pos >= length; }
+  // 다음 샘플의 시각 (트레이스 시작 기준 us)
+  bool peekTime(uint32_t& nextUs) const;
+};
+
+#endif
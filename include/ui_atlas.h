@@ -0,0 +1,199 @@
+#ifndef UI_ATLAS_H
+#define UI_ATLAS_H
+
+#include "sprite_atlas.h"
+
+// UI 스프라이트 아틀라스 (8비트 인덱스, 공유 팔레트 254색, 반전 적용)
+// 인덱스 2048바이트 + 팔레트 508바이트 + 사각형 표 24바이트 = 2580바이트 / RGB565 원본 4096바이트
+// util/sprite_atlas.py 로 생성 - 직접 수정하지 말 것
+
+enum {
+  SPRITE_GOADMINBTN = 0,
+  SPRITE_GOUSERBTN,
+  UI_ATLAS_COUNT
+};
+
+// 스프라이트 이름 (에셋 파티션에서 같은 이름을 찾을 때)
+static const char* const ui_atlas_names[] = {
+    "goadminbtn",
+    "gouserbtn",
+};
+
+#if QMS_ASSET_BUILTIN
+// 팔레트 (패널 전송 순서, 픽셀마다 읽으므로 내부 RAM)
+static const uint16_t QMS_HOT_DATA ui_atlas_palette[] = {
+    0xE120, 0xE99B, 0x6501, 0x2401, 0xA118, 0x8601, 0x182E, 0xC120,
+    0x4501, 0x475A, 0xC0B2, 0x0652, 0x409A, 0xA0AA, 0xE300, 0x8862,
+    0xE0B2, 0x064A, 0x675A, 0x0401, 0xA86A, 0x209A, 0x60A2, 0x00BB,
+    0x1836, 0x80AA, 0xC118, 0x8439, 0xA441, 0x2652, 0xCB32, 0x0129,
+    0xE128, 0x0131, 0x4331, 0xF72D, 0x4752, 0x80A2, 0x20C3, 0xF7B5,
+    0xC541, 0x0092, 0x2092, 0x508C, 0x6922, 0x6762, 0xC300, 0xEB3A,
+    0x6439, 0x8441, 0xA541, 0x265A, 0x40A2, 0x4762, 0xC962, 0xD384,
+    0x0C3B, 0x2231, 0x40CB, 0x40C3, 0x80D3, 0xB6B5, 0xC549, 0xE091,
+    0xE549, 0xE649, 0x099C, 0x2752, 0x38BE, 0x516C, 0x6852, 0x7174,
+    0x8010, 0x9194, 0xE0BA, 0xECC4, 0x349D, 0x60CB, 0x7D3F, 0xA609,
+    0xD7AD, 0xE089, 0x18B6, 0x2F8C, 0x408A, 0x5174, 0x6752, 0x885A,
+    0x8A2A, 0xA120, 0xE0AA, 0xE0A2, 0x1495, 0x2141, 0x2131, 0x4C73,
+    0x54A5, 0x80CB, 0x96B5, 0xA0D3, 0xA439, 0xC089, 0xC091, 0xCF5B,
+    0xD7B5, 0x009A, 0xF7C5, 0x00EC, 0x081A, 0x0812, 0x0F8C, 0x1064,
+    0x17B6, 0x306C, 0x37CE, 0x4662, 0x5094, 0x58CE, 0x609A, 0x6862,
+    0x685A, 0x8092, 0x809A, 0x8762, 0x927C, 0xA200, 0xA0A2, 0xA95A,
+    0xAA32, 0xA962, 0xB194, 0xBBCE, 0xC0AA, 0xCA62, 0xD29C, 0xF38C,
+    0xFBDE, 0x00C3, 0x0231, 0x0B6B, 0x139D, 0x1CE7, 0x2139, 0x20CB,
+    0x2B73, 0x34A5, 0x4051, 0x4141, 0x4339, 0x5595, 0x6339, 0x6331,
+    0x6141, 0x6B83, 0x6C73, 0x75A5, 0x8071, 0x8059, 0x8C83, 0xC0DB,
+    0xA081, 0xA079, 0xA0DB, 0xAD7B, 0xAE53, 0xC709, 0xD6BD, 0xC0E3,
+    0xE079, 0xE071, 0xEE83, 0xEF63, 0xF6C5, 0x008A, 0x0072, 0x17CE,
+    0x2082, 0x281A, 0x275A, 0x274A, 0x2822, 0x3084, 0x2F84, 0x38C6,
+    0x40FC, 0x407A, 0x4922, 0x4852, 0x6092, 0x692A, 0x7094, 0x7274,
+    0x708C, 0x80B2, 0xE0E3, 0x8A32, 0x9ACE, 0xA0B2, 0xAB2A, 0xA862,
+    0xB19C, 0xBAD6, 0xC0BA, 0xC0A2, 0xC09A, 0xD1A4, 0xD394, 0xEB32,
+    0xF2AC, 0xF3A4, 0xF39C, 0xF384, 0x00AB, 0x20BB, 0x20AB, 0x3495,
+    0x3CDF, 0x4139, 0x4D4B, 0x559D, 0x55A5, 0x54AD, 0x5CEF, 0x5DEF,
+    0x6061, 0x6059, 0x6069, 0x6051, 0x6149, 0x75B5, 0x60D3, 0x8501,
+    0x8D73, 0x8E53, 0x8C73, 0x95B5, 0xA159, 0xAC8B, 0xB6BD, 0xB6A5,
+    0xC071, 0xF7BD, 0xC081, 0xC719, 0xC711, 0xC061, 0xD6C5, 0xE161,
+    0xE551, 0xE711, 0xE541, 0xE651, 0xE719, 0xEF5B
+};
+
+static const uint8_t PROGMEM ui_atlas_pixels[] = {
+    0x4E, 0x23, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x23, 0x4E,
+    0x23, 0x0E, 0x08, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x0E, 0x23,
+    0x06, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x08, 0x2F, 0x44, 0x27,
+    0x50, 0x70, 0x55, 0x02, 0x02, 0x02, 0x05, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x13, 0x0E, 0x08, 0x08, 0x2C, 0x44, 0x5F, 0x24,
+    0x7F, 0x11, 0x49, 0x71, 0x03, 0x02, 0x13, 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x03, 0xA4, 0x45, 0x2C, 0x0E, 0x2C, 0x62, 0x22, 0xF8,
+    0x1D, 0x39, 0x6E, 0x45, 0x2E, 0x4F, 0x67, 0x45, 0xF9, 0x03, 0x05, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x02, 0x03, 0x6F, 0x49, 0xAC, 0xD8, 0x6C, 0x37, 0x75, 0x1B, 0x12,
+    0x77, 0x1B, 0x53, 0x83, 0xF3, 0x95, 0x8D, 0x2B, 0x87, 0xA5, 0x08, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x03, 0xAB, 0x49, 0x94, 0xFA, 0x9A, 0x4C, 0xB5, 0x36, 0x0B, 0x09,
+    0x09, 0x0B, 0x46, 0xE8, 0x60, 0xAA, 0x46, 0x8A, 0x90, 0x5C, 0x4F, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x05, 0x13, 0xE9, 0xD1, 0x30, 0x12, 0x09, 0x96, 0x24, 0x28, 0x3E, 0x12, 0x09,
+    0x09, 0x12, 0x0B, 0x1B, 0x56, 0x32, 0x40, 0x0F, 0x31, 0x5F, 0x5C, 0x08, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x05, 0x0E, 0xBF, 0xBE, 0x39, 0x0F, 0x43, 0x12, 0x0B, 0x09, 0x0F, 0x14, 0x14,
+    0x14, 0x14, 0x0F, 0x0F, 0x0B, 0x09, 0x09, 0x09, 0x28, 0x57, 0x52, 0x08, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x08, 0xC3, 0x4C, 0x24, 0x40, 0x09, 0x1D, 0x12, 0x14, 0x2D, 0x73, 0x35,
+    0x35, 0x35, 0x2D, 0x14, 0x0F, 0x43, 0x09, 0x09, 0x97, 0xD2, 0x6F, 0x08, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x08, 0x2E, 0xBA, 0x60, 0x24, 0x0B, 0x12, 0x14, 0x33, 0x9E, 0xAF, 0x6A,
+    0xAC, 0x72, 0xCD, 0x33, 0x14, 0x0F, 0x09, 0x1C, 0x82, 0x67, 0x2E, 0x08, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x08, 0x2C, 0xBD, 0x37, 0xB6, 0x28, 0x09, 0x14, 0x33, 0xED, 0xDB, 0x1E, 0x2F,
+    0x38, 0x80, 0x47, 0xD0, 0x73, 0x14, 0x0F, 0x40, 0x85, 0x9B, 0x1E, 0x2C, 0x02, 0x02, 0x03, 0x06,
+    0x06, 0x03, 0x08, 0x2F, 0xB7, 0x62, 0x75, 0x36, 0x3E, 0x0F, 0x7B, 0x9E, 0xDC, 0x6D, 0x13, 0x03,
+    0x03, 0x03, 0x03, 0x47, 0xC8, 0x0F, 0x0F, 0x09, 0x64, 0x3D, 0x62, 0x88, 0x37, 0x02, 0x03, 0x06,
+    0x06, 0x03, 0x08, 0x44, 0x5F, 0x22, 0x30, 0x0B, 0x12, 0x14, 0x35, 0x72, 0x1E, 0x13, 0x05, 0x05,
+    0x05, 0x05, 0x02, 0x08, 0x52, 0x99, 0x2D, 0x7B, 0x09, 0x64, 0x22, 0x8B, 0xDE, 0x58, 0x0E, 0x18,
+    0x06, 0x03, 0x08, 0x27, 0xBB, 0xFB, 0x12, 0x09, 0x09, 0x14, 0x35, 0x6A, 0x2F, 0x03, 0x05, 0x02,
+    0x02, 0x02, 0x02, 0x05, 0x27, 0x99, 0x2D, 0x77, 0x43, 0x09, 0x2D, 0x39, 0xEB, 0x1E, 0x0E, 0x18,
+    0x06, 0x03, 0x08, 0x50, 0x7F, 0x1D, 0x0F, 0x09, 0x1D, 0x41, 0x31, 0xEE, 0x38, 0x03, 0x05, 0x02,
+    0x02, 0x02, 0x02, 0x05, 0x68, 0x36, 0x1C, 0x1D, 0x09, 0x12, 0x0F, 0x1B, 0x3D, 0x1E, 0x0E, 0x18,
+    0x06, 0x03, 0x08, 0x44, 0x11, 0x39, 0x1B, 0x1D, 0x24, 0x32, 0x22, 0xF1, 0xC6, 0x03, 0x05, 0x02,
+    0x02, 0x02, 0x05, 0x03, 0x27, 0x81, 0x22, 0x11, 0x09, 0x31, 0x31, 0x07, 0xA6, 0xCF, 0x2E, 0x18,
+    0x06, 0x03, 0x08, 0x55, 0x49, 0x6E, 0x53, 0x78, 0x0B, 0x11, 0x30, 0x74, 0x47, 0x03, 0x02, 0x02,
+    0x02, 0xE7, 0x13, 0x38, 0x91, 0x11, 0x32, 0x1D, 0x11, 0xA3, 0x2B, 0x2B, 0x4C, 0x6C, 0x13, 0x18,
+    0x06, 0x03, 0x02, 0x02, 0x71, 0x55, 0x83, 0xEA, 0x1C, 0x09, 0x32, 0x22, 0x74, 0x47, 0x08, 0x05,
+    0x05, 0x03, 0x38, 0xDD, 0x41, 0x1B, 0x11, 0x33, 0x28, 0xC9, 0x37, 0x7C, 0xB1, 0x08, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x03, 0x2E, 0xF4, 0x60, 0x56, 0x0B, 0x11, 0x28, 0x94, 0x53, 0x27, 0x68,
+    0x68, 0x27, 0x91, 0x41, 0x30, 0x41, 0xB2, 0x1C, 0x86, 0xDA, 0x7D, 0x13, 0x08, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x05, 0x4F, 0x95, 0xAA, 0x28, 0x09, 0x09, 0x11, 0x1C, 0x1C, 0x81, 0xC7,
+    0x57, 0x36, 0x11, 0x1B, 0x41, 0x1D, 0x09, 0x3E, 0x46, 0x70, 0x80, 0x02, 0x05, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x05, 0x13, 0x67, 0x8D, 0x56, 0x40, 0x09, 0x09, 0x09, 0x0B, 0x40, 0x96, 0x30,
+    0x30, 0x97, 0x32, 0x11, 0x24, 0x09, 0x24, 0x09, 0x1B, 0xF6, 0x27, 0x03, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x05, 0x0E, 0x45, 0x2B, 0x8A, 0x0F, 0x09, 0x09, 0x1C, 0x0B, 0x09, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x1D, 0x33, 0x1C, 0x0B, 0x12, 0x78, 0x3E, 0x43, 0x50, 0x08, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0xFC, 0x87, 0x90, 0x31, 0x32, 0x22, 0x82, 0x85, 0x1C, 0x12, 0x09,
+    0x09, 0x09, 0x11, 0x28, 0x86, 0x46, 0x31, 0x3E, 0x11, 0x8C, 0x2F, 0x08, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x05, 0x08, 0xA5, 0x5C, 0x9A, 0xB3, 0xC0, 0xFD, 0x9B, 0x3D, 0x64, 0x09,
+    0x12, 0x1C, 0xA3, 0xC4, 0xA4, 0xCE, 0x36, 0x57, 0x8C, 0x38, 0x13, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x05, 0x08, 0x4F, 0xD7, 0x52, 0xAB, 0x2E, 0x1E, 0x3D, 0x22, 0x2D,
+    0x0F, 0x1B, 0x2B, 0x37, 0x7D, 0x58, 0xEF, 0x50, 0x2F, 0x13, 0x05, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x08, 0x08, 0x08, 0x03, 0x2C, 0x88, 0x8B, 0x39,
+    0x1B, 0x07, 0x2B, 0x7C, 0x13, 0x02, 0x08, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xD3, 0xDF, 0xE5,
+    0x3D, 0xA6, 0x4C, 0xB4, 0x08, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x05, 0x03, 0x06,
+    0x06, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x58, 0x1E,
+    0x1E, 0x1E, 0x6D, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x06,
+    0x23, 0x0E, 0x08, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0E, 0x0E,
+    0x0E, 0x0E, 0x13, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x0E, 0x23,
+    0x4E, 0x23, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x18, 0x18,
+    0x18, 0x18, 0x18, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x23, 0x4E,
+    0x4B, 0x01, 0x42, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x01, 0x4B,
+    0x01, 0x48, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x48, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE0, 0x9C,
+    0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x92, 0xA0, 0x3F, 0x65,
+    0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1A, 0x92, 0x66, 0x29, 0x15, 0x51,
+    0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8E, 0xE1, 0x65, 0x29, 0x15, 0x15, 0x51,
+    0x21, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5D, 0xA0, 0x66, 0x29, 0x15, 0x0C, 0x0C, 0x29,
+    0x1F, 0x1A, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x65, 0x3F, 0x2A, 0x15, 0x0C, 0x0C, 0x34, 0x0C,
+    0xA8, 0xF0, 0xA8, 0x93, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x07, 0x21, 0x9C, 0xF2, 0x3F, 0x2A, 0x15, 0x0C, 0x0C, 0x34, 0x16, 0x25,
+    0x19, 0x19, 0xC1, 0x76, 0xB0, 0xD9, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x07, 0x21, 0xA1, 0x3F, 0x29, 0x2A, 0x15, 0x0C, 0x0C, 0x34, 0x16, 0x25, 0x19,
+    0x0D, 0x0D, 0x84, 0x0A, 0x0A, 0x0D, 0x54, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x21, 0xA1, 0x3F, 0x29, 0x2A, 0x15, 0x0C, 0x0C, 0x34, 0x16, 0x16, 0x19, 0x0D,
+    0x0D, 0xC5, 0x0A, 0x10, 0x10, 0x4A, 0x89, 0x54, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0xE2, 0x66, 0x2A, 0x2A, 0x15, 0x0C, 0x0C, 0x16, 0x16, 0x25, 0x19, 0x0D, 0x0D,
+    0x0A, 0x0A, 0x10, 0x10, 0x17, 0x17, 0x17, 0x26, 0xBC, 0x20, 0x07, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x5D, 0x51, 0x69, 0x15, 0x0C, 0x0C, 0x16, 0x16, 0x25, 0x19, 0x0D, 0x0D, 0x0A,
+    0x0A, 0x0A, 0x10, 0x17, 0x17, 0x26, 0x26, 0x26, 0x3A, 0x79, 0x1F, 0x07, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x1A, 0x93, 0x51, 0x69, 0x0C, 0x16, 0x16, 0x25, 0x19, 0x0D, 0x0D, 0x0A, 0x0A,
+    0x10, 0x10, 0x17, 0x17, 0x17, 0x26, 0x26, 0x3B, 0x3A, 0x3A, 0x98, 0x07, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x21, 0xE3, 0x15, 0x16, 0x25, 0x19, 0x0D, 0x0D, 0x0A, 0x0A, 0x10,
+    0x4A, 0x89, 0x17, 0xD5, 0x26, 0x3B, 0x3B, 0x4D, 0x4D, 0x61, 0x7E, 0x20, 0x07, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x07, 0x07, 0x9D, 0x34, 0x19, 0x0D, 0x0D, 0x0A, 0x0A, 0x10, 0x10,
+    0x25, 0x7A, 0x10, 0x8F, 0x3A, 0x3B, 0x4D, 0x4D, 0x61, 0x3C, 0x3B, 0x98, 0x07, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x9D, 0xAD, 0x19, 0x0A, 0x0A, 0x10, 0x4A, 0x0D,
+    0x8E, 0x1A, 0xEC, 0x76, 0x79, 0x3A, 0xE6, 0x61, 0x3C, 0x63, 0xA2, 0x5A, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xA9, 0x0A, 0x10, 0x10, 0x17, 0x84,
+    0x21, 0x07, 0x00, 0x07, 0x20, 0xAE, 0x7E, 0x3C, 0x3C, 0x63, 0xA7, 0x5A, 0x1A, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0xA9, 0xCA, 0x4A, 0x17, 0x0A,
+    0x5E, 0x07, 0x00, 0x00, 0x00, 0x04, 0x1F, 0xCB, 0xA2, 0x63, 0x9F, 0x3C, 0xF7, 0x07, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x20, 0xE4, 0x54, 0x8F, 0x10,
+    0x5E, 0x07, 0x00, 0x00, 0x00, 0x20, 0x07, 0x1F, 0x5B, 0xA7, 0x9F, 0x6B, 0x5B, 0x1A, 0x59, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x20, 0x7A, 0xF5,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x5A, 0xC2, 0x6B, 0xCC, 0x1A, 0x59, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0xD6, 0xB8, 0x5B, 0x1A, 0x59, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5E, 0xD4, 0xB9, 0x07, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x01, 0x48, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x48, 0x01,
+    0x4B, 0x01, 0x42, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x42, 0x01, 0x4B
+};
+
+// 스프라이트 사각형 (인덱스 시작, 너비, 높이, 팔레트 시작)
+static const SpriteRect PROGMEM ui_atlas_rects[] = {
+    {0, 32, 32, 0},  // goadminbtn
+    {1024, 32, 32, 0},  // gouserbtn
+};
+
+static const SpriteAtlas ui_atlas = {8, ui_atlas_palette, ui_atlas_pixels, ui_atlas_rects, UI_ATLAS_COUNT};
+#endif
+
+#endif // UI_ATLAS_H
@@ -0,0 +1,32 @@
+#ifndef XPT2046_BUS_H
+#define XPT2046_BUS_H
+
+#include <XPT2046_Touchscreen.h>
+#include "spi_bus.h"
+
+// TFT 와 분리된 버스(HSPI 또는 GPIO 비트뱅)에서 XPT2046 을 읽는 드라이버
+// XPT2046_Touchscreen 과 같은 측정 순서/필터(Z 임계값, 3회 중 가까운 2회 평균)를 쓰고
+// 좌표계도 라이브러리 기본 회전(1)과 같아서 기존 보정값을 그대로 사용
+// 하드웨어 버스는 touchDevice.settings 로 트랜잭션을 열고, 비트뱅은 같은 클럭을 흉내 냄
+
+class Xpt2046Bus {
+public:
+  Xpt2046Bus(uint8_t cs, uint8_t irq);
+  bool begin();
+  bool touched();
+  TS_Point getPoint();
+
+private:
+  uint8_t csPin;
+  uint8_t irqPin;
+  int16_t xraw, yraw, zraw;
+  uint32_t msraw;
+
+  void update();
+  uint16_t transfer16(uint16_t data);
+  uint8_t transfer(uint8_t data);
+  void select();
+  void deselect();
+};
+
+#endif
@@ -0,0 +1,116 @@
+#include "admin_link.h"
+
+// 헤더까지 왔는데 나머지가 이 시간 안에 안 오면 버리고 다음 프레임을 찾음 (보내다 끊긴 프레임)
+#define LINK_STALL_MS 200
+
+uint16_t linkCrc16(uint16_t crc, uint8_t byte) {
+  // CRC-16/CCITT (다항식 0x1021)
+  crc ^= (uint16_t)byte << 8;
+  for (int b = 0; b < 8; b++) {
+    crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+  }
+  return crc;
+}
+
+// ===== LinkReply =====
+
+void LinkReply::begin(const LinkFrame& request, LinkStatus status) {
+  buffer[0] = LINK_FRAME_SYNC;
+  buffer[1] = LINK_FRAME_REPLY;
+  buffer[4] = request.seq;
+  buffer[5] = request.op;
+  used = LINK_HEADER_LEN;
+  put8(status);
+}
+
+void LinkReply::send(Print& out) {
+  uint16_t length = used - LINK_HEADER_LEN;
+  buffer[2] = (uint8_t)length;
+  buffer[3] = (uint8_t)(length >> 8);
+  uint16_t crc = 0xFFFF;
+  for (uint16_t i = 2; i < used; i++) crc = linkCrc16(crc, buffer[i]);
+  buffer[used] = (uint8_t)crc;
+  buffer[used + 1] = (uint8_t)(crc >> 8);
+  out.write(buffer, used + LINK_CRC_LEN);
+}
+
+// ===== AdminLink =====
+
+AdminLink::AdminLink() : head(0), tail(0), stallSinceMs(0), stalled(false), frameCount(0), errorCount(0) {}
+
+void AdminLink::fill(HardwareSerial& in) {
+  int pending = in.available();
+  while (pending > 0) {
+    uint16_t space = LINK_RING_SIZE - (uint16_t)(head - tail);
+    if (space == 0) break;
+    // 링 끝에서 끊어 두 번에 나눠 읽음
+    uint16_t pos = head & (LINK_RING_SIZE - 1);
+    size_t chunk = min((size_t)pending, (size_t)min(space, (uint16_t)(LINK_RING_SIZE - pos)));
+    size_t n = in.read(ring + pos, chunk);
+    if (n == 0) break;
+    head += n;
+    pending -= n;
+  }
+}
+
+// 맨 앞 0xA5 를 버리고 다음 0xA5 나 줄 끝까지 건너뜀 (깨진 프레임의 나머지를 텍스트 명령으로 넘기지 않음)
+void AdminLink::resync() {
+  stalled = false;
+  tail++;
+  while (head != tail && at(0) != LINK_FRAME_SYNC && at(0) != '\n' && at(0) != '\r') tail++;
+}
+
+LinkItem AdminLink::next(LinkFrame& frame, char& text) {
+  while (head != tail) {
+    uint16_t available = head - tail;
+    if (at(0) != LINK_FRAME_SYNC) {
+      text = (char)at(0);
+      tail++;
+      return LINK_ITEM_TEXT;
+    }
+
+    // 종류와 길이는 앞 4바이트가 오는 대로 확인 (프레임이 다 왔는지와 상관없이)
+    uint16_t length = available >= 4 ? (uint16_t)(at(2) | at(3) << 8) : 0;
+    if ((available >= 2 && at(1) != LINK_FRAME_REQUEST) || length > LINK_PAYLOAD_MAX) {
+      errorCount++;
+      resync();
+      continue;
+    }
+
+    // 덜 온 프레임 - 오래 멈춰 있으면 버림
+    if (available < LINK_HEADER_LEN + length + LINK_CRC_LEN) {
+      if (!stalled) {
+        stalled = true;
+        stallSinceMs = millis();
+        return LINK_ITEM_NONE;
+      }
+      if (millis() - stallSinceMs < LINK_STALL_MS) return LINK_ITEM_NONE;
+      errorCount++;
+      resync();
+      continue;
+    }
+    stalled = false;
+
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 2; i < LINK_HEADER_LEN + length; i++) crc = linkCrc16(crc, at(i));
+    uint16_t sent = at(LINK_HEADER_LEN + length) | (uint16_t)at(LINK_HEADER_LEN + length + 1) << 8;
+    if (crc != sent) {
+      errorCount++;
+      resync();
+      continue;
+    }
+
+    frame.ring = ring;
+    frame.start = tail + LINK_HEADER_LEN;
+    frame.seq = at(4);
+    frame.op = at(5);
+    frame.length = length;
+    frameCount++;
+    return LINK_ITEM_FRAME;
+  }
+  return LINK_ITEM_NONE;
+}
+
+void AdminLink::consume(const LinkFrame& frame) {
+  tail = frame.start + frame.length + LINK_CRC_LEN;
+}
@@ -0,0 +1,54 @@
+#include "admission.h"
+
+#define SECONDS_PER_DAY 86400L
+
+AdmissionPolicy::AdmissionPolicy(int queueCapacity)
+    : capacity(queueCapacity), maxWaitSec(QMS_MAX_WAIT_SEC), closingSecOfDay(QMS_CLOSING_SEC_OF_DAY),
+      clockAnchorSec(-1), clockAnchorMs(0) {}
+
+void AdmissionPolicy::setClock(unsigned long nowMs, long secOfDay) {
+  clockAnchorMs = nowMs;
+  clockAnchorSec = secOfDay % SECONDS_PER_DAY;
+}
+
+long AdmissionPolicy::secondsOfDay(unsigned long nowMs) const {
+  if (clockAnchorSec < 0) return -1;
+  return (clockAnchorSec + (long)((nowMs - clockAnchorMs) / 1000)) % SECONDS_PER_DAY;
+}
+
+AdmissionDecision AdmissionPolicy::evaluate(unsigned long nowMs, int queueLength, int remainingForCurrentSec,
+                                            int processTimeSec) const {
+  AdmissionDecision d;
+  d.result = ADMIT_OK;
+  d.predictedWaitSec = (queueLength > 0) ? (remainingForCurrentSec + queueLength * processTimeSec) : 0;
+  d.nextSlotSec = 0;
+
+  // 마감 시각: 본인 처리까지 마감 전에 끝나야 함
+  // 맨 앞 남은 시간 + 앞사람(맨 앞 제외)과 본인 처리 - 대기열이 있으면 predictedWaitSec 와 같음
+  // (predictedWaitSec 가 이미 본인 처리 몫을 포함하므로 processTimeSec 를 또 더하지 않음)
+  long nowSec = secondsOfDay(nowMs);
+  if (closingSecOfDay >= 0 && nowSec >= 0) {
+    long finishSec = nowSec + remainingForCurrentSec + (long)queueLength * processTimeSec;
+    if (nowSec >= closingSecOfDay || finishSec > closingSecOfDay) {
+      d.result = ADMIT_CLOSING;
+      d.nextSlotSec = -1;
+      return d;
+    }
+  }
+
+  // 대기열 자리: 맨 앞 처리가 끝나면 한 자리가 빔
+  if (queueLength >= capacity) {
+    d.result = ADMIT_QUEUE_FULL;
+    d.nextSlotSec = remainingForCurrentSec;
+    return d;
+  }
+
+  // 최대 대기시간: 예상 대기는 1초에 1초씩 줄어듦
+  if (maxWaitSec > 0 && d.predictedWaitSec > maxWaitSec) {
+    d.result = ADMIT_WAIT_TOO_LONG;
+    d.nextSlotSec = d.predictedWaitSec - maxWaitSec;
+    return d;
+  }
+
+  return d;
+}
@@ -0,0 +1,114 @@
+#include "animation.h"
+
+Animator::Animator() : activeCount(0), lastTickMs(0), frameCount(0), droppedCount(0) {
+  for (int i = 0; i < ANIM_SLOTS; i++) tweens[i].step = nullptr;
+}
+
+int Animator::find(TweenStep step) const {
+  for (int i = 0; i < ANIM_SLOTS; i++) {
+    if (tweens[i].step == step) return i;
+  }
+  return -1;
+}
+
+void Animator::stop(int slot) {
+  tweens[slot].step = nullptr;
+  activeCount--;
+}
+
+bool Animator::start(int32_t from, int32_t to, uint16_t durationMs, AnimEase ease, TweenStep step, bool paced) {
+  int slot = find(step);
+  if (slot < 0) slot = find(nullptr);
+  if (slot < 0) return false;
+  if (activeCount == 0) lastTickMs = millis();  // 쉬고 있었으면 지금부터 틱
+  if (tweens[slot].step == nullptr) activeCount++;
+
+  Tween& t = tweens[slot];
+  t.step = step;
+  t.from = from;
+  t.to = to;
+  t.last = from;
+  t.startMs = millis();
+  t.durationMs = durationMs;
+  t.ease = ease;
+  t.paced = paced;
+  return true;
+}
+
+void Animator::cancel(TweenStep step) {
+  int slot = find(step);
+  if (slot >= 0 && step != nullptr) stop(slot);
+}
+
+void Animator::finish(TweenStep step) {
+  int slot = find(step);
+  if (slot < 0 || step == nullptr) return;
+  int32_t to = tweens[slot].to;
+  stop(slot);
+  step(to, true);
+}
+
+bool Animator::running(TweenStep step) const {
+  return step != nullptr && find(step) >= 0;
+}
+
+// 진행률 (Q16) → 곡선 적용한 진행률 (Q16)
+static uint32_t applyEase(AnimEase ease, uint32_t p) {
+  switch (ease) {
+    case EASE_OUT: {
+      uint32_t q = 65536 - p;
+      return 65536 - (uint32_t)(((uint64_t)q * q) >> 16);
+    }
+    case EASE_IN_OUT: {
+      uint64_t p2 = ((uint64_t)p * p) >> 16;
+      return (uint32_t)((p2 * (3 * 65536 - 2 * p)) >> 16);
+    }
+    default:
+      return p;
+  }
+}
+
+void Animator::update(uint32_t nowMs, bool frameBusy) {
+  if (activeCount == 0) {
+    lastTickMs = nowMs;
+    return;
+  }
+  uint32_t ticks = (nowMs - lastTickMs) / ANIM_TICK_MS;
+  if (ticks == 0) return;
+  lastTickMs += ticks * ANIM_TICK_MS;
+  droppedCount += ticks - 1;  // 밀린 틱은 그리지 않고 건너뜀
+  frameCount++;
+
+  for (int i = 0; i < ANIM_SLOTS; i++) {
+    Tween& t = tweens[i];
+    if (t.step == nullptr) continue;
+    uint32_t elapsed = nowMs - t.startMs;
+    if (elapsed >= t.durationMs) {
+      // 마지막 값은 전송이 밀려도 그림 (step 안에서 다시 start 할 수 있으므로 자리를 먼저 비움)
+      TweenStep step = t.step;
+      int32_t to = t.to;
+      stop(i);
+      step(to, true);
+      continue;
+    }
+    if (t.paced && frameBusy) {
+      droppedCount++;
+      continue;
+    }
+    uint32_t p = applyEase(t.ease, (uint32_t)(((uint64_t)elapsed << 16) / t.durationMs));
+    int32_t value = t.from + (int32_t)(((int64_t)(t.to - t.from) * p) >> 16);
+    if (value == t.last) continue;
+    t.last = value;
+    t.step(value, false);
+  }
+}
+
+uint16_t blend565(uint16_t from, uint16_t to, uint16_t amount) {
+  if (amount >= 256) return to;
+  int r0 = from >> 11, g0 = (from >> 5) & 0x3F, b0 = from & 0x1F;
+  int r1 = to >> 11, g1 = (to >> 5) & 0x3F, b1 = to & 0x1F;
+  int r = r0 + (((r1 - r0) * amount) >> 8);
+  int g = g0 + (((g1 - g0) * amount) >> 8);
+  int b = b0 + (((b1 - b0) * amount) >> 8);
+  return (uint16_t)(r << 11 | g << 5 | b);
+}
@@ -0,0 +1,102 @@
+#include "asset_partition.h"
+#include <string.h>
+
+AssetPartition assetPartition;
+
+// 이미지 안의 구조체를 그대로 가리키므로 레이아웃이 util/asset_pack.py 와 같아야 함
+static_assert(sizeof(AssetImageHeader) == 48, "asset image header layout");
+static_assert(sizeof(SpriteRect) == 12, "asset image rect layout");
+
+// zlib 과 같은 CRC32 (부팅 때 한 번, 수 KB)
+static uint32_t crc32(const uint8_t* data, size_t len) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+  }
+  return ~crc;
+}
+
+AssetPartition::AssetPartition() : base(nullptr), handle(0) {
+  memset(&view, 0, sizeof(view));
+}
+
+bool AssetPartition::begin() {
+  end();
+  const esp_partition_t* partition = esp_partition_find_first(
+    ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL);
+  if (partition == nullptr) return false;
+
+  const void* mappedPtr = nullptr;
+  if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &mappedPtr, &handle) != ESP_OK) {
+    return false;
+  }
+  const uint8_t* image = (const uint8_t*)mappedPtr;
+  if (!valid(image, partition->size)) {
+    spi_flash_munmap(handle);
+    return false;
+  }
+
+  base = image;
+  const AssetImageHeader* h = header();
+  view.bits = h->bits;
+  view.palette = (const uint16_t*)(base + h->paletteOffset);
+#if QMS_IRAM_HOT
+  // 스프라이트가 쓰는 LUT 끝까지 RAM 에 들어가면 복사 (플래시 캐시 미스 없이 풀기)
+  uint32_t lutEnd = 0;
+  const SpriteRect* rects = (const SpriteRect*)(base + h->rectsOffset);
+  for (uint16_t i = 0; i < h->spriteCount; i++) lutEnd = max(lutEnd, (uint32_t)rects[i].palette + (1u << h->bits));
+  if (lutEnd <= ASSET_PALETTE_RAM) {
+    memcpy(palette, view.palette, lutEnd * 2);
+    view.palette = palette;
+  }
+#endif
+  view.pixels = base + h->pixelsOffset;
+  view.rects = (const SpriteRect*)(base + h->rectsOffset);
+  view.count = h->spriteCount;
+  return true;
+}
+
+void AssetPartition::end() {
+  if (!mapped()) return;
+  spi_flash_munmap(handle);
+  base = nullptr;
+  memset(&view, 0, sizeof(view));
+}
+
+// 지워진 파티션(0xFF), 덜 올라간 이미지, 다른 버전을 걸러냄
+bool AssetPartition::valid(const uint8_t* image, size_t size) const {
+  const AssetImageHeader* h = (const AssetImageHeader*)image;
+  if (size < sizeof(AssetImageHeader) || memcmp(h->magic, "QMSA", 4) != 0) return false;
+  if (h->version != ASSET_IMAGE_VERSION || (h->bits != 4 && h->bits != 8)) return false;
+  if (h->spriteCount == 0 || h->spriteCount > 255) return false;
+  if (h->imageSize > size || h->imageSize < sizeof(AssetImageHeader)) return false;
+  if (h->rectsOffset % 4 != 0 || h->paletteOffset % 2 != 0) return false;
+  if (h->rectsOffset + (uint32_t)h->spriteCount * sizeof(SpriteRect) > h->imageSize) return false;
+  if (h->namesOffset + (uint32_t)h->spriteCount * ASSET_NAME_LEN > h->imageSize) return false;
+  if (h->paletteOffset + (uint32_t)h->paletteCount * 2 > h->imageSize) return false;
+  if (h->pixelsOffset + h->pixelsSize > h->imageSize) return false;
+  if (crc32(image + sizeof(AssetImageHeader), h->imageSize - sizeof(AssetImageHeader)) != h->crc) return false;
+
+  // 스프라이트가 인덱스/팔레트 밖을 가리키지 않는지
+  const SpriteRect* rects = (const SpriteRect*)(image + h->rectsOffset);
+  for (uint16_t i = 0; i < h->spriteCount; i++) {
+    uint32_t stride = h->bits == 8 ? rects[i].width : (rects[i].width + 1) / 2;
+    if (rects[i].width == 0 || rects[i].width > SPRITE_MAX_WIDTH) return false;
+    if (rects[i].offset + stride * rects[i].height > h->pixelsSize) return false;
+    // 인덱스 값은 검사하지 않으므로 LUT 최대 범위가 매핑 안에 있어야 함
+    if (rects[i].palette >= h->paletteCount) return false;
+    if (h->paletteOffset + (rects[i].palette + (1u << h->bits)) * 2 > size) return false;
+  }
+  return true;
+}
+
+int AssetPartition::find(const char* name) const {
+  if (!mapped()) return -1;
+  const AssetImageHeader* h = header();
+  const char* names = (const char*)(base + h->namesOffset);
+  for (uint16_t i = 0; i < h->spriteCount; i++) {
+    if (strncmp(&names[i * ASSET_NAME_LEN], name, ASSET_NAME_LEN) == 0) return i;
+  }
+  return -1;
+}
@@ -0,0 +1,96 @@
+#include "background_image.h"
+#include <string.h>
+
+// ===== JpegFileInput =====
+
+bool JpegFileInput::open(fs::FS& fs, const char* path) {
+  if (file) file.close();
+  file = fs.open(path, FILE_READ);
+  return (bool)file;
+}
+
+void JpegFileInput::close() {
+  if (file) file.close();
+}
+
+size_t JpegFileInput::readAt(uint32_t pos, uint8_t* buf, size_t len) {
+  if (!file || !file.seek(pos)) return 0;
+  return file.read(buf, len);
+}
+
+// ===== BackgroundImage =====
+
+BackgroundImage::BackgroundImage()
+  : fill(0), clipX(0), clipY(0), clipW(0), clipH(0),
+    bandPixels(nullptr), bandCovered(nullptr), bandTop(0), bandBottom(0), bandWidth(0) {}
+
+bool BackgroundImage::begin(fs::FS& fs, const char* path, uint16_t fillColor) {
+  fill = fillColor;
+  end();
+  if (!input.open(fs, path)) return false;
+  if (decoder.begin(&input, true)) return true;
+  end();
+  return false;
+}
+
+void BackgroundImage::end() {
+  decoder.end();
+  input.close();
+}
+
+void BackgroundImage::attach(QmsDisplay& panel) {
+  clipX = clipY = 0;
+  clipW = panel.width();
+  clipH = panel.height();
+  panel.setBackground(this);
+}
+
+void BackgroundImage::restore(QmsDisplay& panel, int16_t x, int16_t y, int16_t w, int16_t h) {
+  // 앞서 예약된 띠가 남아 있으면 (이 이미지가 배경인 프레임 포함) 먼저 보낸 뒤 영역을 좁힘
+  if (panel.framePending()) panel.flush();
+  clipX = x;
+  clipY = y;
+  clipW = w;
+  clipH = h;
+  panel.setUnderlay(this, y, y + h);
+}
+
+void BackgroundImage::fillBand(uint16_t* pixels, uint8_t* covered, int16_t top, int16_t lines, int16_t width) {
+  int16_t y0 = max(top, clipY);
+  int16_t y1 = min((int16_t)(top + lines), (int16_t)(clipY + clipH));
+  int16_t x0 = max(clipX, (int16_t)0);
+  int16_t x1 = min((int16_t)(clipX + clipW), width);
+  if (y0 >= y1 || x0 >= x1) return;
+
+  // 이미지 밖은 채움색, 안은 아래에서 타일로 덮어씀
+  for (int16_t y = y0; y < y1; y++) {
+    uint16_t* row = &pixels[(y - top) * DISPLAY_MAX_WIDTH];
+    for (int16_t x = x0; x < x1; x++) row[x] = fill;
+    memset(&covered[(y - top) * DISPLAY_MAX_WIDTH + x0], 1, x1 - x0);
+  }
+
+  if (!decoder.ready() || y0 >= decoder.height()) return;
+  bandPixels = pixels;
+  bandCovered = covered;
+  bandTop = top;
+  bandBottom = y1;
+  bandWidth = x1;
+  int lastRow = min((int)y1, (int)decoder.height()) - 1;
+  for (int row = y0 / decoder.mcuHeight(); row <= lastRow / decoder.mcuHeight(); row++) {
+    if (!decoder.decodeRow(row, *this)) break;  // 깨진 데이터 - 남은 곳은 채움색
+  }
+  bandPixels = nullptr;
+}
+
+// 디코더가 넘긴 타일에서 띠와 클립 사각형이 겹치는 부분만 복사
+void BackgroundImage::tile(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t* pixels, int16_t stride) {
+  int16_t x0 = max(x, max(clipX, (int16_t)0));
+  int16_t x1 = min((int16_t)(x + w), bandWidth);
+  int16_t y0 = max(y, max(bandTop, clipY));
+  int16_t y1 = min((int16_t)(y + h), bandBottom);
+  if (x0 >= x1) return;
+  for (int16_t row = y0; row < y1; row++) {
+    memcpy(&bandPixels[(row - bandTop) * DISPLAY_MAX_WIDTH + x0], &pixels[(row - y) * stride + (x0 - x)],
+           (x1 - x0) * sizeof(uint16_t));
+  }
+}
@@ -0,0 +1,101 @@
+#include "digit_roll.h"
+#include "animation.h"
+#include <string.h>
+
+#define CELL_W 6
+#define CELL_H 8
+
+// 글자 하나를 6x8 비트로 (열마다 8비트, 아래쪽 줄이 상위 비트) - 그리는 글꼴 그대로 쓰기 위해 GFX 로 찍어서 받음
+class GlyphCanvas : public Adafruit_GFX {
+public:
+  GlyphCanvas() : Adafruit_GFX(CELL_W, CELL_H) {}
+  uint8_t columns[CELL_W];
+
+  void render(char c) {
+    memset(columns, 0, sizeof(columns));
+    drawChar(0, 0, c, 1, 1, 1, 1);
+  }
+  void drawPixel(int16_t px, int16_t py, uint16_t) override {
+    if (px >= 0 && px < CELL_W && py >= 0 && py < CELL_H) columns[px] |= 1 << py;
+  }
+};
+
+static GlyphCanvas oldGlyph;
+static GlyphCanvas newGlyph;
+
+DigitRoll::DigitRoll(int16_t x, int16_t y, uint16_t color, uint16_t background, FieldEraser erase)
+  : x(x), y(y), color(color), background(background), erase(erase), fade(true), length(0), first(-1), last(-1) {
+  shown[0] = next[0] = '\0';
+}
+
+void DigitRoll::reset(const char* text) {
+  strncpy(shown, text, DIGIT_ROLL_CELLS);
+  shown[DIGIT_ROLL_CELLS] = '\0';
+  length = strlen(shown);
+  first = last = -1;
+}
+
+bool DigitRoll::change(Adafruit_GFX& g, const char* text) {
+  uint8_t newLength = min((int)strlen(text), DIGIT_ROLL_CELLS);
+  if (newLength != length) {
+    // 자릿수가 바뀌면 굴리지 않고 통째로
+    erase(x, y, max(newLength, length) * CELL_W, CELL_H);
+    g.setTextColor(color);
+    g.setTextSize(1);
+    g.setCursor(x, y);
+    for (uint8_t i = 0; i < newLength; i++) g.print(text[i]);
+    reset(text);
+    return false;
+  }
+
+  first = last = -1;
+  for (int8_t i = 0; i < length; i++) {
+    next[i] = text[i];
+    if (text[i] == shown[i]) continue;
+    if (first < 0) first = i;
+    last = i;
+  }
+  next[length] = '\0';
+  return first >= 0;
+}
+
+void DigitRoll::render(Adafruit_GFX& g, int16_t phase) {
+  if (first < 0) return;
+  if (phase > DIGIT_ROLL_LINES) phase = DIGIT_ROLL_LINES;
+  erase(x + first * CELL_W, y, (last - first + 1) * CELL_W, CELL_H);
+  g.startWrite();
+  for (int16_t cell = first; cell <= last; cell++) drawCell(g, cell, phase);
+  g.endWrite();
+  if (phase == DIGIT_ROLL_LINES) {
+    memcpy(shown, next, sizeof(shown));
+    first = last = -1;
+  }
+}
+
+// 칸 하나: 위 (CELL_H - phase) 줄은 이전 글자의 아래쪽, 나머지는 새 글자의 위쪽
+void DigitRoll::drawCell(Adafruit_GFX& g, int16_t cell, int16_t phase) {
+  if (shown[cell] == next[cell]) phase = 0;
+  oldGlyph.render(shown[cell]);
+  newGlyph.render(next[cell]);
+  uint16_t incoming = fade ? blend565(background, color, phase * 256 / DIGIT_ROLL_LINES) : color;
+  int16_t cx = x + cell * CELL_W;
+
+  for (int16_t col = 0; col < CELL_W; col++) {
+    // 화면 줄 r 에 보일 비트: r < CELL_H - phase 면 이전 글자 줄 r + phase, 아니면 새 글자 줄 r + phase - CELL_H
+    uint8_t outgoing = phase >= CELL_H ? 0 : oldGlyph.columns[col] >> phase;
+    uint8_t entering = phase == 0 ? 0 : (uint8_t)(newGlyph.columns[col] << (CELL_H - phase));
+    for (int part = 0; part < 2; part++) {
+      uint8_t bits = part == 0 ? outgoing : entering;
+      uint16_t c = part == 0 ? color : incoming;
+      int16_t row = 0;
+      while (bits) {
+        // 세로로 이어진 점은 선 하나로
+        while (!(bits & 1)) { bits >>= 1; row++; }
+        int16_t run = 0;
+        while (bits & 1) { bits >>= 1; run++; }
+        g.drawFastVLine(cx + col, y + row, run, c);
+        row += run;
+      }
+    }
+  }
+}
@@ -0,0 +1,508 @@
+#include "display.h"
+#include "spi_bus.h"
+#include "profile.h"
+#include <string.h>
+
+// 띠 합성 버퍼 (7.5KB) 와 칠해진 픽셀 표시
+static uint16_t bandPixels[DISPLAY_MAX_WIDTH * DISPLAY_BAND_LINES];
+static uint8_t bandCovered[DISPLAY_MAX_WIDTH * DISPLAY_BAND_LINES];
+
+QmsDisplay::QmsDisplay(int8_t cs, int8_t dc, int8_t rst)
+  : Adafruit_ST7789(cs, dc, rst), framing(false), flushing(false), scrolled(false), directOpen(false), writeDepth(0), opCount(0),
+    dirtyBands(0), background(nullptr), underlay(nullptr), focusLine(0), scrollTop(0), scrollArea(0), scrollStart(0), resetUs(0) {
+  stats.reset();
+}
+
+// ===== 트랜잭션 / 주소창 =====
+
+// 실제 CS 구간 - 터치와 버스를 공유하면 그동안 터치 읽기는 대기
+void QmsDisplay::busBegin() {
+  tftBus.acquire(tftDevice);
+  Adafruit_ST7789::startWrite();
+}
+
+void QmsDisplay::busEnd() {
+  Adafruit_ST7789::endWrite();
+  tftBus.release();
+}
+
+void QmsDisplay::startWrite() {
+  if (framing && !flushing) {
+    writeDepth++;
+    return;
+  }
+  stats.transactions++;
+  busBegin();
+}
+
+void QmsDisplay::endWrite() {
+  if (framing && !flushing) {
+    if (writeDepth > 0) writeDepth--;
+    if (writeDepth == 0 && directOpen) {
+      directOpen = false;
+      busEnd();
+    }
+    return;
+  }
+  busEnd();
+}
+
+void QmsDisplay::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  // 프레임 중 직접 픽셀을 보내는 경우: 순서를 지키기 위해 기록분을 먼저 전송
+  if (framing && !flushing && !directOpen) {
+    flush();
+    stats.transactions++;
+    busBegin();
+    directOpen = true;
+  }
+  stats.windows++;
+  stats.bytes += SPI_WINDOW_OVERHEAD + (uint32_t)w * h * 2;
+  Adafruit_ST7789::setAddrWindow(x, y, w, h);
+}
+
+// ===== 그리기 (프레임 중에는 기록만) =====
+
+void QmsDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (framing) record(x, y, 1, 1, color);
+  else Adafruit_ST7789::drawPixel(x, y, color);
+}
+
+void QmsDisplay::writePixel(int16_t x, int16_t y, uint16_t color) {
+  if (framing) record(x, y, 1, 1, color);
+  else Adafruit_ST7789::writePixel(x, y, color);
+}
+
+void QmsDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (framing) record(x, y, w, h, color);
+  else Adafruit_ST7789::fillRect(x, y, w, h, color);
+}
+
+void QmsDisplay::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (framing) record(x, y, w, h, color);
+  else Adafruit_ST7789::writeFillRect(x, y, w, h, color);
+}
+
+void QmsDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (framing) record(x, y, w, 1, color);
+  else Adafruit_ST7789::drawFastHLine(x, y, w, color);
+}
+
+void QmsDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (framing) record(x, y, 1, h, color);
+  else Adafruit_ST7789::drawFastVLine(x, y, h, color);
+}
+
+void QmsDisplay::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (framing) record(x, y, w, 1, color);
+  else Adafruit_ST7789::writeFastHLine(x, y, w, color);
+}
+
+void QmsDisplay::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (framing) record(x, y, 1, h, color);
+  else Adafruit_ST7789::writeFastVLine(x, y, h, color);
+}
+
+// 화면 밖은 잘라내고, 바로 앞 명령과 이어지는 같은 색 사각형은 하나로 합침
+// (글자는 점/작은 사각형을 열 단위로 찍으므로 세로로 많이 합쳐짐)
+void QmsDisplay::record(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w < 0) { x += w + 1; w = -w; }
+  if (h < 0) { y += h + 1; h = -h; }
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w <= 0 || h <= 0) return;
+
+  markDirty(y, y + h);
+  if (opCount > 0) {
+    DrawOp& last = ops[opCount - 1];
+    if (last.color == color) {
+      if (last.x == x && last.w == w && last.y + last.h == y) {
+        last.h += h;
+        return;
+      }
+      if (last.y == y && last.h == h && last.x + last.w == x) {
+        last.w += w;
+        return;
+      }
+    }
+  }
+
+  if (opCount == DISPLAY_LIST_OPS) {
+    flush();
+    markDirty(y, y + h);
+  }
+  ops[opCount].x = x;
+  ops[opCount].y = y;
+  ops[opCount].w = w;
+  ops[opCount].h = h;
+  ops[opCount].color = color;
+  opCount++;
+}
+
+// ===== 패널 초기화 =====
+
+// 리셋을 풀고 슬립 해제(SLPOUT)를 보내기까지 기다려야 하는 시간 (ST7789 데이터시트)
+#define PANEL_RESET_TO_SLPOUT_US 120000
+// SLPOUT 뒤 다음 명령까지
+#define PANEL_SLPOUT_MS 5
+
+void QmsDisplay::resetPanel(uint32_t spiHz, uint8_t spiMode) {
+  // 라이브러리의 리셋(100 + 100 + 200ms 지연)은 건너뛰고 SPI 설정만
+  int8_t rst = _rst;
+  _rst = -1;
+  initSPI(spiHz, spiMode);
+  _rst = rst;
+
+  if (_rst >= 0) {
+    pinMode(_rst, OUTPUT);
+    digitalWrite(_rst, LOW);
+    delayMicroseconds(20);  // 최소 10us
+    digitalWrite(_rst, HIGH);
+  } else {
+    sendPanelCommand(ST77XX_SWRESET, nullptr, 0);
+  }
+  resetUs = micros();
+}
+
+void QmsDisplay::wakePanel() {
+  uint32_t sinceResetUs = micros() - resetUs;
+  if (sinceResetUs < PANEL_RESET_TO_SLPOUT_US) {
+    uint32_t waitUs = PANEL_RESET_TO_SLPOUT_US - sinceResetUs;
+    delay(waitUs / 1000);
+    delayMicroseconds(waitUs % 1000);
+  }
+  sendPanelCommand(ST77XX_SLPOUT, nullptr, 0);
+  delay(PANEL_SLPOUT_MS);
+
+  // 라이브러리 init + setRotation(0) 과 같은 설정 (16비트 색, 회전 0, 색 반전 패널)
+  // 주소창(CASET/RASET)은 그릴 때마다 지정하므로 생략. GRAM 은 아직 쓰레기라 백라이트는 첫 화면 뒤에 켤 것
+  const uint8_t colmod = 0x55;
+  const uint8_t madctl = ST77XX_MADCTL_MX | ST77XX_MADCTL_MY | ST77XX_MADCTL_RGB;
+  sendPanelCommand(ST77XX_COLMOD, &colmod, 1);
+  sendPanelCommand(ST77XX_MADCTL, &madctl, 1);
+  sendPanelCommand(ST77XX_INVON, nullptr, 0);
+  sendPanelCommand(ST77XX_NORON, nullptr, 0);
+  sendPanelCommand(ST77XX_DISPON, nullptr, 0);
+}
+
+// ===== 수직 스크롤 =====
+
+#define ST7789_VSCRDEF 0x33
+#define ST7789_VSCSAD  0x37
+
+void QmsDisplay::sendPanelCommand(uint8_t command, const uint8_t* data, uint8_t len) {
+  // 스크롤/초기화 명령은 메모리 쓰기 주소에 영향이 없으므로
+  // 기록된 그리기를 기다리지 않고 바로 보냄 (sendCommand 는 startWrite 를 거치지 않음)
+  if (directOpen) {
+    directOpen = false;
+    busEnd();
+  }
+  tftBus.acquire(tftDevice);
+  sendCommand(command, data, len);
+  tftBus.release();
+  stats.transactions++;
+  stats.bytes += 1 + len;
+}
+
+void QmsDisplay::setScrollArea(uint16_t top, uint16_t area, uint16_t bottom) {
+  uint8_t data[6] = {(uint8_t)(top >> 8), (uint8_t)top, (uint8_t)(area >> 8), (uint8_t)area,
+                     (uint8_t)(bottom >> 8), (uint8_t)bottom};
+  sendPanelCommand(ST7789_VSCRDEF, data, 6);
+  scrolled = true;
+  scrollTop = top;
+  scrollArea = area;
+  scrollStart = top;
+}
+
+void QmsDisplay::setScrollStart(uint16_t line) {
+  uint8_t data[2] = {(uint8_t)(line >> 8), (uint8_t)line};
+  sendPanelCommand(ST7789_VSCSAD, data, 2);
+  scrollStart = line;
+}
+
+// 스크롤 영역 k 번째 화면 줄 = 메모리 줄 top + (start - top + k) % area
+int16_t QmsDisplay::memoryLine(int16_t y) const {
+  if (!scrolled || y < scrollTop || y >= scrollTop + scrollArea) return y;
+  return scrollTop + (scrollStart - scrollTop + (y - scrollTop)) % scrollArea;
+}
+
+int16_t QmsDisplay::screenLine(int16_t line) const {
+  if (!scrolled || line < scrollTop || line >= scrollTop + scrollArea) return line;
+  return scrollTop + (line - scrollStart + scrollArea) % scrollArea;
+}
+
+int16_t QmsDisplay::contiguousUntil(int16_t y, int16_t limit) const {
+  int16_t end = y + 1;
+  while (end < limit && memoryLine(end) == memoryLine(end - 1) + 1) end++;
+  return end;
+}
+
+void QmsDisplay::resetScroll() {
+  if (!scrolled) return;
+  setScrollArea(0, HEIGHT, 0);
+  setScrollStart(0);
+  scrolled = false;
+}
+
+// ===== 프레임 =====
+
+void QmsDisplay::beginFrame() {
+  if (framing) return;
+  framing = true;
+  writeDepth = 0;
+  opCount = 0;
+}
+
+void QmsDisplay::endFrame() {
+  if (!framing) return;
+  flush();
+  if (directOpen) {
+    directOpen = false;
+    busEnd();
+  }
+  framing = false;
+  writeDepth = 0;
+}
+
+void QmsDisplay::setBackground(BandSource* source) {
+  if (background && background != source) background->release();
+  if (underlay) {
+    underlay->release();
+    underlay = nullptr;
+  }
+  background = source;
+  opCount = 0;
+  markDirty(0, _height);
+}
+
+void QmsDisplay::setUnderlay(BandSource* source, int16_t y0, int16_t y1) {
+  if (!framing) {
+    beginFrame();
+    setUnderlay(source, y0, y1);
+    endFrame();
+    return;
+  }
+  // 배경만 예약된 상태(명령 없음)면 그 위에 바로 겹침
+  if (dirtyBands != 0 && (opCount > 0 || underlay != nullptr)) flush();
+  underlay = source;
+  markDirty(y0, y1);
+}
+
+void QmsDisplay::markDirty(int16_t y0, int16_t y1) {
+  for (int band = y0 / DISPLAY_BAND_LINES; band * DISPLAY_BAND_LINES < y1 && band < DISPLAY_BANDS; band++) {
+    dirtyBands |= 1UL << band;
+  }
+}
+
+// 아직 안 보낸 띠 중 focusLine 에 가장 가까운 띠
+int QmsDisplay::nextBand() const {
+  int best = -1;
+  int bestDistance = 0;
+  for (int band = 0; band < DISPLAY_BANDS; band++) {
+    if (!(dirtyBands & (1UL << band))) continue;
+    int center = band * DISPLAY_BAND_LINES + DISPLAY_BAND_LINES / 2;
+    int distance = abs(center - focusLine);
+    if (best < 0 || distance < bestDistance) {
+      best = band;
+      bestDistance = distance;
+    }
+  }
+  return best;
+}
+
+void QmsDisplay::sendBand(int band) {
+  int16_t top = band * DISPLAY_BAND_LINES;
+  flushBand(top, min((int16_t)(top + DISPLAY_BAND_LINES), _height));
+  dirtyBands &= ~(1UL << band);
+}
+
+// 모든 띠를 보냈으면 기록과 배경을 비움
+void QmsDisplay::finishBands() {
+  if (dirtyBands != 0) return;
+  opCount = 0;
+  if (background) {
+    background->release();
+    background = nullptr;
+  }
+  if (underlay) {
+    underlay->release();
+    underlay = nullptr;
+  }
+}
+
+void QmsDisplay::flush() {
+  if (dirtyBands == 0) {
+    finishBands();
+    return;
+  }
+
+  if (directOpen) {
+    directOpen = false;
+    busEnd();
+  }
+  flushing = true;
+  startWrite();
+  for (int band = 0; band < DISPLAY_BANDS; band++) {
+    if (dirtyBands & (1UL << band)) sendBand(band);
+  }
+  endWrite();
+  flushing = false;
+  finishBands();
+}
+
+void QmsDisplay::sendLines(int16_t y0, int16_t y1) {
+  uint32_t bands = 0;
+  for (int band = y0 / DISPLAY_BAND_LINES; band * DISPLAY_BAND_LINES < y1 && band < DISPLAY_BANDS; band++) {
+    bands |= 1UL << band;
+  }
+  if (!framing || (dirtyBands & bands) == 0) return;
+
+  if (directOpen) {
+    directOpen = false;
+    busEnd();
+  }
+  flushing = true;
+  startWrite();
+  for (int band = 0; band < DISPLAY_BANDS; band++) {
+    if (dirtyBands & bands & (1UL << band)) sendBand(band);
+  }
+  endWrite();
+  flushing = false;
+  finishBands();
+}
+
+bool QmsDisplay::pumpFrame(uint32_t budgetUs) {
+  if (!framing) return true;
+
+  if (dirtyBands != 0) {
+    if (directOpen) {
+      directOpen = false;
+      busEnd();
+    }
+    flushing = true;
+    startWrite();
+    // 최소 한 띠는 보내고, 다음 띠가 직전 띠만큼 걸린다고 보고 예산을 넘기기 전에 멈춤
+    uint32_t startUs = micros();
+    uint32_t elapsedUs = 0;
+    uint32_t bandUs = 0;
+    do {
+      sendBand(nextBand());
+      uint32_t nowUs = micros() - startUs;
+      bandUs = nowUs - elapsedUs;
+      elapsedUs = nowUs;
+    } while (dirtyBands != 0 && elapsedUs + bandUs <= budgetUs);
+    endWrite();
+    flushing = false;
+    if (dirtyBands != 0) return false;
+  }
+
+  finishBands();
+  endFrame();
+  return true;
+}
+
+// 띠 하나: 명령을 순서대로 합성한 뒤, 줄마다 칠해진 구간을 찾고
+// 위아래 줄에서 같은 구간이 이어지면 한 사각형으로 묶어서 전송
+void QmsDisplay::flushBand(int16_t bandTop, int16_t bandBottom) {
+  int16_t lines = bandBottom - bandTop;
+  int16_t width = min(_width, (int16_t)DISPLAY_MAX_WIDTH);
+  {
+    QMS_PROFILE_SCOPE("band compose");
+    memset(bandCovered, 0, sizeof(bandCovered));
+    if (background) background->fillBand(bandPixels, bandCovered, bandTop, lines, width);
+    if (underlay) underlay->fillBand(bandPixels, bandCovered, bandTop, lines, width);
+
+    for (int i = 0; i < opCount; i++) {
+      const DrawOp& op = ops[i];
+      int16_t y0 = max(op.y, bandTop);
+      int16_t y1 = min((int16_t)(op.y + op.h), bandBottom);
+      if (y0 >= y1) continue;
+      int16_t x1 = min((int16_t)(op.x + op.w), width);
+      for (int16_t y = y0; y < y1; y++) {
+        int row = (y - bandTop) * DISPLAY_MAX_WIDTH;
+        for (int16_t x = op.x; x < x1; x++) {
+          bandPixels[row + x] = op.color;
+          bandCovered[row + x] = 1;
+        }
+      }
+    }
+  }
+
+  // 열린 사각형: 이전 줄까지 이어진 구간 [x0, x1) 과 시작 줄
+  struct OpenRect { int16_t x0, x1, y0; bool alive; };
+  static OpenRect open[DISPLAY_MAX_WIDTH / 2 + 1];
+  static OpenRect next[DISPLAY_MAX_WIDTH / 2 + 1];
+  int openCount = 0;
+
+  for (int16_t line = 0; line <= lines; line++) {
+    int nextCount = 0;
+    for (int i = 0; i < openCount; i++) open[i].alive = false;
+
+    if (line < lines) {
+      const uint8_t* covered = &bandCovered[line * DISPLAY_MAX_WIDTH];
+      int16_t x = 0;
+      while (x < width) {
+        if (!covered[x]) { x++; continue; }
+        int16_t start = x;
+        while (x < width && covered[x]) x++;
+        // 윗줄과 같은 구간이면 이어 붙임
+        int16_t y0 = bandTop + line;
+        for (int i = 0; i < openCount; i++) {
+          if (open[i].x0 == start && open[i].x1 == x) {
+            open[i].alive = true;
+            y0 = open[i].y0;
+            break;
+          }
+        }
+        next[nextCount].x0 = start;
+        next[nextCount].x1 = x;
+        next[nextCount].y0 = y0;
+        nextCount++;
+      }
+    }
+
+    // 이어지지 않은 사각형은 여기서 끝 → 전송
+    for (int i = 0; i < openCount; i++) {
+      if (!open[i].alive) {
+        emitRect(open[i].x0, open[i].y0, open[i].x1 - open[i].x0, bandTop + line - open[i].y0, bandTop);
+      }
+    }
+    memcpy(open, next, nextCount * sizeof(OpenRect));
+    openCount = nextCount;
+  }
+}
+
+void QmsDisplay::emitRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t bandTop) {
+  setAddrWindow(x, y, w, h);
+  for (int16_t row = 0; row < h; row++) {
+    writePixels(&bandPixels[(y - bandTop + row) * DISPLAY_MAX_WIDTH + x], w);
+  }
+}
+
+// ===== ScreenCanvas =====
+
+ScreenCanvas::ScreenCanvas(QmsDisplay& target) : Adafruit_GFX(target.width(), target.height()), panel(target) {}
+
+void ScreenCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  panel.drawPixel(x, panel.memoryLine(y), color);
+}
+
+void ScreenCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (h < 0) { y += h + 1; h = -h; }
+  int16_t y1 = min((int16_t)(y + h), _height);
+  if (y < 0) y = 0;
+  while (y < y1) {
+    int16_t end = panel.contiguousUntil(y, y1);
+    panel.fillRect(x, panel.memoryLine(y), w, end - y, color);
+    y = end;
+  }
+}
+
+void ScreenCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void ScreenCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
@@ -0,0 +1,143 @@
+#include "gesture.h"
+#include "profile.h"
+
+GestureEngine::GestureEngine(int confirmSamples, int slopPx)
+  : confirmSamples(confirmSamples), slopPx(slopPx) {
+  reset();
+}
+
+void GestureEngine::reset() {
+  state = GESTURE_IDLE;
+  settleCount = 0;
+  anchorX = anchorY = lastX = lastY = emittedX = emittedY = 0;
+  pressUs = lastDownUs = 0;
+  windowHead = 0;
+  windowCount = 0;
+}
+
+void GestureEngine::push(uint32_t timeUs, int x, int y) {
+  window[windowHead] = {timeUs, (int16_t)x, (int16_t)y};
+  windowHead = (windowHead + 1) % GESTURE_WINDOW;
+  if (windowCount < GESTURE_WINDOW) windowCount++;
+}
+
+// 최근 GESTURE_WINDOW_MS 안의 가장 오래된 샘플 → 가장 최근 샘플 기울기
+void GestureEngine::velocity(int32_t& vx, int32_t& vy) const {
+  vx = vy = 0;
+  if (windowCount < 2) return;
+  const Point& newest = window[(windowHead + GESTURE_WINDOW - 1) % GESTURE_WINDOW];
+  const Point* oldest = &newest;
+  for (int i = 2; i <= windowCount; i++) {
+    const Point& p = window[(windowHead + GESTURE_WINDOW - i) % GESTURE_WINDOW];
+    if (newest.timeUs - p.timeUs > GESTURE_WINDOW_MS * 1000UL) break;
+    oldest = &p;
+  }
+  uint32_t dt = newest.timeUs - oldest->timeUs;
+  if (dt == 0) return;
+  vx = (int32_t)(newest.x - oldest->x) * 1000000L / (int32_t)dt;
+  vy = (int32_t)(newest.y - oldest->y) * 1000000L / (int32_t)dt;
+}
+
+Gesture GestureEngine::make(GestureType type, int x, int y) const {
+  Gesture g;
+  g.type = type;
+  g.x = x;
+  g.y = y;
+  g.startX = anchorX;
+  g.startY = anchorY;
+  g.dx = g.dy = 0;
+  g.vx = g.vy = 0;
+  return g;
+}
+
+Gesture GestureEngine::feed(uint32_t timeUs, bool down, int x, int y) {
+  QMS_PROFILE_SCOPE("touch stabilize");  // 누름 안정화 + 제스처 판별
+  if (!down) {
+    if (state == GESTURE_IDLE) return make(GESTURE_NONE, x, y);
+    if (state == GESTURE_SETTLING) {
+      // 확정 전에 떨어지면 잡음으로 보고 처음부터
+      state = GESTURE_IDLE;
+      settleCount = 0;
+      return make(GESTURE_NONE, x, y);
+    }
+    // 확정 후에는 잠깐 떨어진 것(압력 튐)은 무시
+    if (timeUs - lastDownUs < GESTURE_RELEASE_MS * 1000UL) return make(GESTURE_NONE, lastX, lastY);
+
+    State was = state;
+    state = GESTURE_IDLE;
+    settleCount = 0;
+    if (was == GESTURE_HELD) return make(GESTURE_TAP, lastX, lastY);
+    if (was == GESTURE_DRAGGING) {
+      Gesture g = make(GESTURE_RELEASE, lastX, lastY);
+      velocity(g.vx, g.vy);
+      if (abs(g.vx) >= GESTURE_SWIPE_PX_PER_S || abs(g.vy) >= GESTURE_SWIPE_PX_PER_S) g.type = GESTURE_SWIPE;
+      return g;
+    }
+    return make(GESTURE_RELEASE, lastX, lastY);
+  }
+
+  lastDownUs = timeUs;
+  switch (state) {
+    case GESTURE_IDLE:
+      state = GESTURE_SETTLING;
+      anchorX = x;
+      anchorY = y;
+      settleCount = 1;
+      return make(GESTURE_NONE, x, y);
+
+    case GESTURE_SETTLING:
+      if (abs(x - anchorX) > slopPx || abs(y - anchorY) > slopPx) {
+        // 기준점 벗어남 → 다시 세기
+        anchorX = x;
+        anchorY = y;
+        settleCount = 1;
+        return make(GESTURE_NONE, x, y);
+      }
+      if (++settleCount < confirmSamples) return make(GESTURE_NONE, x, y);
+
+      state = GESTURE_HELD;
+      anchorX = (anchorX + x) / 2;
+      anchorY = (anchorY + y) / 2;
+      lastX = emittedX = anchorX;
+      lastY = emittedY = anchorY;
+      pressUs = timeUs;
+      windowCount = 0;
+      push(timeUs, anchorX, anchorY);
+      return make(GESTURE_PRESS, anchorX, anchorY);
+
+    case GESTURE_HELD:
+      lastX = x;
+      lastY = y;
+      push(timeUs, x, y);
+      if (abs(x - anchorX) > slopPx || abs(y - anchorY) > slopPx) {
+        state = GESTURE_DRAGGING;
+        break;
+      }
+      if (timeUs - pressUs >= GESTURE_LONG_PRESS_MS * 1000UL) {
+        state = GESTURE_LONG_HELD;
+        return make(GESTURE_LONG_PRESS, anchorX, anchorY);
+      }
+      return make(GESTURE_NONE, x, y);
+
+    case GESTURE_DRAGGING:
+      lastX = x;
+      lastY = y;
+      push(timeUs, x, y);
+      break;
+
+    case GESTURE_LONG_HELD:
+      lastX = x;
+      lastY = y;
+      return make(GESTURE_NONE, x, y);
+  }
+
+  // 드래그: 직전 이벤트 이후 이동량
+  if (x == emittedX && y == emittedY) return make(GESTURE_NONE, x, y);
+  Gesture g = make(GESTURE_DRAG, x, y);
+  g.dx = x - emittedX;
+  g.dy = y - emittedY;
+  velocity(g.vx, g.vy);
+  emittedX = x;
+  emittedY = y;
+  return g;
+}
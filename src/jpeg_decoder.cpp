@@ -0,0 +1,386 @@
+#include "jpeg_decoder.h"
+#include "hot_path.h"
+#include <string.h>
+
+// 지그재그 순서 → 8x8 블록 위치
+static const uint8_t QMS_HOT_DATA zigzag[64] = {
+   0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+  12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+  35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+  58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// 1차원 IDCT 계수 (Q12): idct[x][u] = C(u)/2 * cos((2x+1)uπ/16)
+static const int16_t QMS_HOT_DATA idct[8][8] = {
+  {1448,  2009,  1892,  1703,  1448,  1138,   784,   400},
+  {1448,  1703,   784,  -400, -1448, -2009, -1892, -1138},
+  {1448,  1138,  -784, -2009, -1448,   400,  1892,  1703},
+  {1448,   400, -1892, -1138,  1448,  1703,  -784, -2009},
+  {1448,  -400, -1892,  1138,  1448, -1703,  -784,  2009},
+  {1448, -1138,  -784,  2009, -1448,  -400,  1892, -1703},
+  {1448, -1703,   784,   400, -1448,  2009, -1892,  1138},
+  {1448, -2009,  1892, -1703,  1448, -1138,   784,  -400},
+};
+
+#define JPEG_COEF_LIMIT 4095  // 8비트 샘플의 역양자화 계수 범위 (깨진 파일에서 넘침 방지)
+
+static inline uint8_t clampSample(int v) {
+  return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+JpegDecoder::JpegDecoder()
+  : input(nullptr), invert(false), imageWidth(0), imageHeight(0), mcuW(8), mcuH(8), mcusPerRow(0),
+    rowCount(0), componentCount(0), restartInterval(0), bufferStart(0), bufferLength(0) {}
+
+// ===== 입력 =====
+
+int JpegDecoder::byteAt(uint32_t pos) {
+  if (pos < bufferStart || pos >= bufferStart + bufferLength) {
+    bufferStart = pos;
+    bufferLength = input->readAt(pos, buffer, JPEG_INPUT_BYTES);
+    if (bufferLength == 0) return -1;
+  }
+  return buffer[pos - bufferStart];
+}
+
+uint16_t JpegDecoder::read16(uint32_t pos) {
+  return (uint16_t)((byteAt(pos) & 0xFF) << 8 | (byteAt(pos + 1) & 0xFF));
+}
+
+// ===== 헤더 =====
+
+bool JpegDecoder::begin(JpegInput* source, bool invertColors) {
+  input = source;
+  invert = invertColors;
+  rowCount = 0;
+  bufferLength = 0;
+  if (!parseHeaders()) return false;
+
+  // 엔트로피 부호를 한 번 훑으며 MCU 줄 시작 상태 기록 (출력 없이)
+  int rows = (imageHeight + mcuH - 1) / mcuH;
+  if (rows > JPEG_MAX_ROWS) return false;
+  for (int row = 0; row < rows; row++) {
+    rowStart[row] = state;
+    for (int i = 0; i < mcusPerRow; i++) {
+      if (!decodeMcu(false)) return false;
+    }
+  }
+  rowCount = rows;
+  return true;
+}
+
+bool JpegDecoder::parseHeaders() {
+  if (byteAt(0) != 0xFF || byteAt(1) != 0xD8) return false;
+  uint32_t pos = 2;
+  bool frame = false;
+  restartInterval = 0;
+
+  while (true) {
+    // 마커 앞의 채움 0xFF 는 건너뜀
+    if (byteAt(pos) != 0xFF) return false;
+    while (byteAt(pos) == 0xFF) pos++;
+    int marker = byteAt(pos++);
+    if (marker < 0) return false;
+    uint16_t length = read16(pos);
+    uint32_t body = pos + 2;
+
+    switch (marker) {
+      case 0xC0:  // baseline
+      case 0xC1: {  // extended (8비트 허프만이면 같음)
+        if (byteAt(body) != 8) return false;
+        imageHeight = read16(body + 1);
+        imageWidth = read16(body + 3);
+        componentCount = byteAt(body + 5);
+        if (imageWidth == 0 || imageHeight == 0) return false;
+        if (componentCount != 1 && componentCount != 3) return false;
+        for (int i = 0; i < componentCount; i++) {
+          Component& c = components[i];
+          c.id = byteAt(body + 6 + i * 3);
+          uint8_t sampling = byteAt(body + 7 + i * 3);
+          c.h = sampling >> 4;
+          c.v = sampling & 0x0F;
+          c.quant = byteAt(body + 8 + i * 3);
+          if (c.quant > 3) return false;
+        }
+        if (componentCount == 1) {
+          // 단일 성분 스캔은 항상 8x8 블록 하나가 MCU
+          components[0].h = components[0].v = 1;
+        } else {
+          if (components[0].h < 1 || components[0].h > 2 || components[0].v < 1 || components[0].v > 2) return false;
+          if (components[1].h != 1 || components[1].v != 1 || components[2].h != 1 || components[2].v != 1) return false;
+        }
+        mcuW = components[0].h * 8;
+        mcuH = components[0].v * 8;
+        mcusPerRow = (imageWidth + mcuW - 1) / mcuW;
+        frame = true;
+        break;
+      }
+      case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+      case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+        return false;  // progressive / 무손실 / 산술 부호
+      case 0xC4:
+        if (!parseHuffman(body, length - 2)) return false;
+        break;
+      case 0xDB: {
+        uint32_t p = body;
+        while (p < body + length - 2) {
+          uint8_t info = byteAt(p++);
+          uint8_t id = info & 0x0F;
+          if (id > 3) return false;
+          bool wide = (info >> 4) != 0;
+          for (int k = 0; k < 64; k++) {
+            quant[id][k] = wide ? read16(p + k * 2) : byteAt(p + k);
+          }
+          p += wide ? 128 : 64;
+        }
+        break;
+      }
+      case 0xDD:
+        restartInterval = read16(body);
+        break;
+      case 0xDA: {
+        if (!frame) return false;
+        uint8_t count = byteAt(body);
+        if (count != componentCount) return false;  // 성분을 나눠 담은 스캔은 지원 안 함
+        for (int i = 0; i < count; i++) {
+          uint8_t id = byteAt(body + 1 + i * 2);
+          uint8_t tables = byteAt(body + 2 + i * 2);
+          // 기준(baseline) 은 DC/AC 표 0, 1 만 - 그 밖의 번호는 겹쳐 쓰지 않고 거부
+          if ((tables >> 4) > 1 || (tables & 0x0F) > 1) return false;
+          for (int k = 0; k < componentCount; k++) {
+            if (components[k].id != id) continue;
+            components[k].dcTable = tables >> 4;
+            components[k].acTable = tables & 0x0F;
+          }
+        }
+        state.pos = body + length - 2;
+        state.bits = 0;
+        state.count = 0;
+        state.dc[0] = state.dc[1] = state.dc[2] = 0;
+        state.restartLeft = restartInterval;
+        return true;
+      }
+      case 0xD9:
+        return false;  // 스캔 없이 끝남
+      default:
+        break;  // APPn, COM 등
+    }
+    pos = body + length - 2;
+  }
+}
+
+bool JpegDecoder::parseHuffman(uint32_t pos, uint16_t length) {
+  uint32_t end = pos + length;
+  while (pos < end) {
+    uint8_t info = byteAt(pos++);
+    uint8_t tableClass = info >> 4, id = info & 0x0F;
+    if (tableClass > 1 || id > 1) return false;  // 기준(baseline) 은 표 0, 1 만
+    Huffman& table = tableClass ? acTables[id] : dcTables[id];
+    uint8_t counts[17];
+    int total = 0;
+    for (int len = 1; len <= 16; len++) {
+      counts[len] = byteAt(pos++);
+      total += counts[len];
+    }
+    if (total > 256) return false;
+    for (int i = 0; i < total; i++) table.values[i] = byteAt(pos++);
+
+    // 길이별 부호 범위 (표준 canonical 허프만)
+    uint16_t code = 0;
+    int index = 0;
+    for (int len = 1; len <= 16; len++) {
+      table.valptr[len] = index;
+      table.mincode[len] = code;
+      code += counts[len];
+      index += counts[len];
+      table.maxcode[len] = counts[len] ? code - 1 : -1;
+      code <<= 1;
+    }
+  }
+  return true;
+}
+
+// ===== 엔트로피 디코딩 =====
+
+// 비트 버퍼를 24비트 이상으로 채움. 마커(0xFF + 0 아닌 값)에 닿으면 0 을 채우고 멈춤
+void JpegDecoder::fillBits() {
+  while (state.count <= 24) {
+    int b = byteAt(state.pos);
+    if (b == 0xFF) {
+      int next = byteAt(state.pos + 1);
+      if (next == 0x00) {
+        state.pos += 2;
+      } else {
+        b = 0;
+      }
+    } else if (b < 0) {
+      b = 0;
+    } else {
+      state.pos++;
+    }
+    state.bits |= (uint32_t)b << (24 - state.count);
+    state.count += 8;
+  }
+}
+
+uint32_t JpegDecoder::getBits(int n) {
+  if (n == 0) return 0;
+  fillBits();
+  uint32_t value = state.bits >> (32 - n);
+  state.bits <<= n;
+  state.count -= n;
+  return value;
+}
+
+int JpegDecoder::decodeSymbol(const Huffman& table) {
+  fillBits();
+  uint32_t peek = state.bits >> 16;
+  for (int len = 1; len <= 16; len++) {
+    int32_t code = peek >> (16 - len);
+    if (code <= table.maxcode[len]) {
+      state.bits <<= len;
+      state.count -= len;
+      return table.values[table.valptr[len] + code - table.mincode[len]];
+    }
+  }
+  return -1;  // 깨진 부호
+}
+
+// 재시작 간격이 끝났으면 RSTn 마커를 건너뛰고 DC 예측값을 초기화
+bool JpegDecoder::restart() {
+  if (restartInterval == 0) return true;
+  if (state.restartLeft == 0) {
+    state.bits = 0;
+    state.count = 0;
+    while (byteAt(state.pos) == 0xFF && byteAt(state.pos + 1) == 0xFF) state.pos++;
+    if (byteAt(state.pos) != 0xFF) return false;
+    int marker = byteAt(state.pos + 1);
+    if (marker < 0xD0 || marker > 0xD7) return false;
+    state.pos += 2;
+    state.dc[0] = state.dc[1] = state.dc[2] = 0;
+    state.restartLeft = restartInterval;
+  }
+  state.restartLeft--;
+  return true;
+}
+
+static inline int extend(uint32_t value, int bits) {
+  return value < (1u << (bits - 1)) ? (int)value - (1 << bits) + 1 : (int)value;
+}
+
+// 블록 하나를 풀어서 (output 이면) 역양자화 + IDCT 후 out 에 8x8 샘플로
+bool JpegDecoder::decodeBlock(const Component& c, int index, uint8_t* out, int stride, bool output) {
+  int s = decodeSymbol(dcTables[c.dcTable]);
+  if (s < 0 || s > 11) return false;
+  state.dc[index] += s ? extend(getBits(s), s) : 0;
+
+  const uint16_t* q = quant[c.quant];
+  if (output) {
+    memset(coef, 0, sizeof(coef));
+    int dc = state.dc[index] * q[0];
+    coef[0] = dc > JPEG_COEF_LIMIT ? JPEG_COEF_LIMIT : (dc < -JPEG_COEF_LIMIT ? -JPEG_COEF_LIMIT : dc);
+  }
+  bool acZero = true;
+  for (int k = 1; k < 64;) {
+    int rs = decodeSymbol(acTables[c.acTable]);
+    if (rs < 0) return false;
+    int run = rs >> 4;
+    int size = rs & 0x0F;
+    if (size == 0) {
+      if (run != 15) break;  // EOB
+      k += 16;
+      continue;
+    }
+    k += run;
+    if (k > 63) return false;
+    int value = extend(getBits(size), size);
+    if (output) {
+      int v = value * q[k];
+      coef[zigzag[k]] = v > JPEG_COEF_LIMIT ? JPEG_COEF_LIMIT : (v < -JPEG_COEF_LIMIT ? -JPEG_COEF_LIMIT : v);
+      acZero = false;
+    }
+    k++;
+  }
+  if (!output) return true;
+
+  // AC 가 모두 0 이면 평균값으로 채움 (단색 영역에서 흔함)
+  if (acZero) {
+    uint8_t v = clampSample(((coef[0] + 4) >> 3) + 128);  // DC 만 있으면 모든 샘플이 DC/8
+    for (int y = 0; y < 8; y++) memset(&out[y * stride], v, 8);
+    return true;
+  }
+
+  // 행 방향 → 열 방향 분리 IDCT (Q12 x Q12, 중간에 한 번 줄임)
+  int32_t tmp[64];
+  for (int v = 0; v < 8; v++) {
+    const int16_t* in = &coef[v * 8];
+    for (int x = 0; x < 8; x++) {
+      int32_t sum = 0;
+      for (int u = 0; u < 8; u++) sum += idct[x][u] * in[u];
+      tmp[v * 8 + x] = (sum + (1 << 10)) >> 11;  // Q1
+    }
+  }
+  for (int x = 0; x < 8; x++) {
+    for (int y = 0; y < 8; y++) {
+      int32_t sum = 0;
+      for (int v = 0; v < 8; v++) sum += idct[y][v] * tmp[v * 8 + x];
+      out[y * stride + x] = clampSample(((sum + (1 << 12)) >> 13) + 128);
+    }
+  }
+  return true;
+}
+
+bool JpegDecoder::decodeMcu(bool output) {
+  if (!restart()) return false;
+  const Component& y = components[0];
+  for (int by = 0; by < y.v; by++) {
+    for (int bx = 0; bx < y.h; bx++) {
+      if (!decodeBlock(y, 0, &luma[by * 8 * 16 + bx * 8], 16, output)) return false;
+    }
+  }
+  for (int i = 1; i < componentCount; i++) {
+    if (!decodeBlock(components[i], i, chroma[i - 1], 8, output)) return false;
+  }
+  return true;
+}
+
+// MCU 를 RGB565 타일로 (색차는 MCU 크기에 맞춰 가까운 값 확대)
+void JpegDecoder::emitMcu(int mcuX, int row, JpegTileSink& sink) {
+  int shiftX = components[0].h - 1;
+  int shiftY = components[0].v - 1;
+  uint16_t mask = invert ? 0xFFFF : 0;
+  for (int y = 0; y < mcuH; y++) {
+    for (int x = 0; x < mcuW; x++) {
+      int l = luma[y * 16 + x];
+      int r, g, b;
+      if (componentCount == 1) {
+        r = g = b = l;
+      } else {
+        int ci = (y >> shiftY) * 8 + (x >> shiftX);
+        int cb = chroma[0][ci] - 128;
+        int cr = chroma[1][ci] - 128;
+        // ITU-R BT.601 (Q16)
+        r = l + ((91881 * cr + 32768) >> 16);
+        g = l - ((22554 * cb + 46802 * cr - 32768) >> 16);
+        b = l + ((116130 * cb + 32768) >> 16);
+      }
+      uint16_t color = (clampSample(r) & 0xF8) << 8 | (clampSample(g) & 0xFC) << 3 | clampSample(b) >> 3;
+      tileOut[y * mcuW + x] = color ^ mask;
+    }
+  }
+  int16_t px = mcuX * mcuW;
+  int16_t py = row * mcuH;
+  int16_t w = imageWidth - px < mcuW ? imageWidth - px : mcuW;
+  int16_t h = imageHeight - py < mcuH ? imageHeight - py : mcuH;
+  sink.tile(px, py, w, h, tileOut, mcuW);
+}
+
+bool JpegDecoder::decodeRow(int row, JpegTileSink& sink) {
+  if (row < 0 || row >= rowCount) return false;
+  state = rowStart[row];
+  for (int i = 0; i < mcusPerRow; i++) {
+    if (!decodeMcu(true)) return false;
+    emitMcu(i, row, sink);
+  }
+  return true;
+}
@@ -0,0 +1,317 @@
+#include "layer_cache.h"
+#include "profile.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define LAYER_RUN_CHUNK 512  // 래스터화 중 런 버퍼 증가 단위
+
+LayerCache layerCache;
+
+// 래스터화용 캔버스는 한 번에 하나만 쓰므로 하나만 둠 (7.5KB)
+StripCanvas stripCanvas(LAYER_MAX_WIDTH, LAYER_MAX_HEIGHT);
+
+// ===== StripCanvas =====
+
+StripCanvas::StripCanvas(int16_t w, int16_t h) : Adafruit_GFX(w, h), top(0) {}
+
+void StripCanvas::setStrip(int16_t stripTop) {
+  top = stripTop;
+}
+
+void StripCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= _width || y < top || y >= top + LAYER_STRIP_LINES || y >= _height) return;
+  buffer[(y - top) * LAYER_MAX_WIDTH + x] = color;
+}
+
+void StripCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w < 0) { x += w + 1; w = -w; }
+  if (h < 0) { y += h + 1; h = -h; }
+  int16_t x0 = max(x, (int16_t)0);
+  int16_t x1 = min((int16_t)(x + w), _width);
+  int16_t y0 = max(y, top);
+  int16_t y1 = min((int16_t)(y + h), (int16_t)min((int)_height, top + LAYER_STRIP_LINES));
+  for (int16_t row = y0; row < y1; row++) {
+    uint16_t* p = &buffer[(row - top) * LAYER_MAX_WIDTH];
+    for (int16_t col = x0; col < x1; col++) p[col] = color;
+  }
+}
+
+void StripCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  fillRect(x, y, w, 1, color);
+}
+
+void StripCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  fillRect(x, y, 1, h, color);
+}
+
+// ===== LayerBandSource =====
+
+void LayerBandSource::attach(uint8_t layerId, const LayerRun* layerRuns, uint32_t count, QmsDisplay& target,
+                             bool keyedLayer, uint16_t keyColor) {
+  id = layerId;
+  panel = &target;
+  runs = layerRuns;
+  keyed = keyedLayer;
+  key = keyColor;
+
+  // 런을 한 번 훑으며 띠 경계 위치 기록
+  uint32_t width = target.width();
+  uint32_t bandPixels = width * DISPLAY_BAND_LINES;
+  uint32_t pos = 0;
+  int band = 0;
+  for (uint32_t i = 0; i < count && band < DISPLAY_BANDS; i++) {
+    uint32_t runEnd = pos + runs[i].length;
+    while (band < DISPLAY_BANDS && band * bandPixels < runEnd) {
+      bandRun[band] = i;
+      bandSkip[band] = band * bandPixels - pos;
+      band++;
+    }
+    pos = runEnd;
+  }
+  for (; band < DISPLAY_BANDS; band++) {
+    bandRun[band] = count;
+    bandSkip[band] = 0;
+  }
+}
+
+void QMS_HOT LayerBandSource::fillBand(uint16_t* pixels, uint8_t* covered, int16_t top, int16_t lines, int16_t width) {
+  QMS_PROFILE_SCOPE("layer fill");
+  if (!keyed) {
+    for (int16_t y = 0; y < lines; y++) memset(&covered[y * DISPLAY_MAX_WIDTH], 1, width);
+  }
+  int band = top / DISPLAY_BAND_LINES;
+  uint32_t i = bandRun[band];
+  uint32_t left = runs[i].length - bandSkip[band];
+  for (int16_t y = 0; y < lines; y++) {
+    uint16_t* row = &pixels[y * DISPLAY_MAX_WIDTH];
+    int16_t x = 0;
+    while (x < width) {
+      if (left == 0) left = runs[++i].length;
+      uint32_t n = min(left, (uint32_t)(width - x));
+      uint16_t color = runs[i].color;
+      if (keyed && color == key) {
+        x += n;
+      } else {
+        if (keyed) memset(&covered[y * DISPLAY_MAX_WIDTH + x], 1, n);
+        for (uint32_t k = 0; k < n; k++) row[x++] = color;
+      }
+      left -= n;
+    }
+  }
+}
+
+// ===== LayerCache =====
+
+LayerCache::LayerCache() : useClock(0), used(0), prefetchBlocked(0) {
+  pending.id = LAYER_SLOTS;
+  pending.top = 0;
+  pending.out = nullptr;
+  pending.count = 0;
+  pending.capacity = 0;
+  for (int i = 0; i < LAYER_SLOTS; i++) {
+    runs[i] = nullptr;
+    runCount[i] = 0;
+    lastUse[i] = 0;
+  }
+}
+
+void LayerCache::invalidate(uint8_t id) {
+  if (id >= LAYER_SLOTS) return;
+  // 아직 프레임 배경으로 보내는 중이면 먼저 다 보냄 (release 로 배경 해제)
+  if (background.layer() == id) background.target()->flush();
+  if (overlay.layer() == id) overlay.target()->flush();
+  if (pending.id == id) abandonRaster();  // 그리는 내용이 바뀜
+  if (runs[id] == nullptr) return;
+  prefetchBlocked = 0;  // 자리가 생김
+  used -= runCount[id] * sizeof(LayerRun);
+  free(runs[id]);
+  runs[id] = nullptr;
+  runCount[id] = 0;
+}
+
+void LayerCache::clear() {
+  for (uint8_t i = 0; i < LAYER_SLOTS; i++) invalidate(i);
+}
+
+// bytes 만큼 자리가 나도록 오래된 레이어부터 버림 (keep 은 제외)
+bool LayerCache::makeRoom(size_t bytes, uint8_t keep) {
+  if (bytes > LAYER_CACHE_BYTES) return false;
+  while (used + bytes > LAYER_CACHE_BYTES) {
+    int oldest = -1;
+    for (int i = 0; i < LAYER_SLOTS; i++) {
+      if (i == keep || i == background.layer() || i == overlay.layer() || runs[i] == nullptr) continue;
+      if (oldest < 0 || lastUse[i] < lastUse[oldest]) oldest = i;
+    }
+    if (oldest < 0) return false;
+    invalidate(oldest);
+  }
+  return true;
+}
+
+void LayerCache::beginRaster(uint8_t id) {
+  abandonRaster();
+  pending.id = id;
+  pending.top = 0;
+}
+
+void LayerCache::abandonRaster() {
+  free(pending.out);
+  pending.id = LAYER_SLOTS;
+  pending.out = nullptr;
+  pending.count = 0;
+  pending.capacity = 0;
+}
+
+// 다음 띠 하나를 painter 로 그려서 RLE 런으로 이어 붙임
+// evict 가 false 면 다른 레이어를 버리지 않고 남은 RAM 안에서만 (모자라면 실패)
+bool LayerCache::rasterStrip(LayerPainter painter, int16_t w, int16_t h, bool evict) {
+  int16_t top = pending.top;
+  stripCanvas.setStrip(top);
+  painter(stripCanvas);
+
+  int16_t bottom = min((int16_t)(top + LAYER_STRIP_LINES), h);
+  for (int16_t y = top; y < bottom; y++) {
+    const uint16_t* p = stripCanvas.line(y);
+    for (int16_t x = 0; x < w; x++) {
+      LayerRun* out = pending.out;
+      uint32_t count = pending.count;
+      if (count > 0 && out[count - 1].color == p[x] && out[count - 1].length < 0xFFFF) {
+        out[count - 1].length++;
+        continue;
+      }
+      if (count == pending.capacity) {
+        // 다 늘리기 전에 상한을 넘으면 캐시 포기
+        size_t bytes = (pending.capacity + LAYER_RUN_CHUNK) * sizeof(LayerRun);
+        bool room = evict ? makeRoom(bytes, pending.id) : used + bytes <= LAYER_CACHE_BYTES;
+        LayerRun* grown = room ? (LayerRun*)realloc(out, bytes) : nullptr;
+        if (grown == nullptr) {
+          abandonRaster();
+          return false;
+        }
+        pending.out = out = grown;
+        pending.capacity += LAYER_RUN_CHUNK;
+      }
+      out[count].length = 1;
+      out[count].color = p[x];
+      pending.count++;
+    }
+  }
+  pending.top = bottom;
+  return true;
+}
+
+void LayerCache::commitRaster() {
+  // 남는 부분 반환
+  uint8_t id = pending.id;
+  LayerRun* fitted = (LayerRun*)realloc(pending.out, pending.count * sizeof(LayerRun));
+  runs[id] = fitted ? fitted : pending.out;
+  runCount[id] = pending.count;
+  used += pending.count * sizeof(LayerRun);
+  pending.out = nullptr;
+  abandonRaster();
+}
+
+// painter 를 띠마다 호출해서 위에서부터 RLE 런으로 인코딩
+// (유휴 시간에 같은 레이어를 미리 시작해 뒀으면 남은 띠부터)
+bool LayerCache::rasterize(uint8_t id, LayerPainter painter, int16_t w, int16_t h) {
+  if (w > LAYER_MAX_WIDTH) return false;
+  if (pending.id != id) beginRaster(id);
+
+  while (pending.top < h) {
+    if (!rasterStrip(painter, w, h, true)) return false;
+  }
+  commitRaster();
+  return true;
+}
+
+bool LayerCache::prefetch(uint8_t id, LayerPainter painter, int16_t w, int16_t h) {
+  if (id >= LAYER_SLOTS || w > LAYER_MAX_WIDTH || runs[id] != nullptr) return true;
+  if (prefetchBlocked & (1u << id)) return true;
+  if (pending.id != id) beginRaster(id);
+
+  if (!rasterStrip(painter, w, h, false)) {
+    // RAM 이 모자람 - 캐시에서 뭔가 빠질 때까지 다시 시도하지 않음
+    prefetchBlocked |= 1u << id;
+    return true;
+  }
+  if (pending.top < h) return false;
+  commitRaster();
+  return true;
+}
+
+void LayerCache::blit(uint8_t id, Adafruit_SPITFT& panel) {
+  const LayerRun* r = runs[id];
+  uint32_t n = runCount[id];
+  panel.startWrite();
+  panel.setAddrWindow(0, 0, panel.width(), panel.height());
+  for (uint32_t i = 0; i < n; i++) {
+    panel.writeColor(r[i].color, r[i].length);
+  }
+  panel.endWrite();
+}
+
+// 런을 처음부터 따라가며 영역 줄마다 겹치는 부분만 잘라 보냄 (전송량 = 영역 픽셀 수)
+// 수직 스크롤 중이면 메모리 줄이 끊기는 곳마다 주소창을 새로 엶
+void LayerCache::blitRegion(uint8_t id, QmsDisplay& panel, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t mask) {
+  const LayerRun* r = runs[id];
+  uint32_t n = runCount[id];
+  uint32_t width = panel.width();
+  uint32_t i = 0;
+  uint32_t pos = 0;  // 런 i 의 시작 픽셀
+
+  panel.startWrite();
+  int16_t windowEnd = y;
+  for (int16_t row = y; row < y + h; row++) {
+    if (row == windowEnd) {
+      windowEnd = panel.contiguousUntil(row, y + h);
+      panel.setAddrWindow(x, panel.memoryLine(row), w, windowEnd - row);
+    }
+    uint32_t p = (uint32_t)row * width + x;
+    uint32_t end = p + w;
+    while (i < n && pos + r[i].length <= p) pos += r[i++].length;
+    while (i < n && p < end) {
+      uint32_t runEnd = pos + r[i].length;
+      uint32_t stop = min(runEnd, end);
+      panel.writeColor(r[i].color ^ mask, stop - p);
+      p = stop;
+      if (p == runEnd) pos += r[i++].length;
+    }
+  }
+  panel.endWrite();
+}
+
+bool LayerCache::drawRegion(uint8_t id, LayerPainter painter, QmsDisplay& panel,
+                            int16_t x, int16_t y, int16_t w, int16_t h, bool invert) {
+  if (id >= LAYER_SLOTS || w <= 0 || h <= 0) return false;
+  if (runs[id] == nullptr && !rasterize(id, painter, panel.width(), panel.height())) return false;
+  lastUse[id] = ++useClock;
+  blitRegion(id, panel, x, y, w, h, invert ? 0xFFFF : 0);
+  return true;
+}
+
+bool LayerCache::drawOver(uint8_t id, LayerPainter painter, QmsDisplay& panel, uint16_t key) {
+  if (id >= LAYER_SLOTS || !panel.inFrame()) return false;
+  if (runs[id] == nullptr && !rasterize(id, painter, panel.width(), panel.height())) return false;
+  lastUse[id] = ++useClock;
+  overlay.attach(id, runs[id], runCount[id], panel, true, key);
+  panel.setUnderlay(&overlay, 0, panel.height());
+  return true;
+}
+
+void LayerCache::draw(uint8_t id, LayerPainter painter, QmsDisplay& panel) {
+  if (id >= LAYER_SLOTS) {
+    painter(panel);
+    return;
+  }
+  if (runs[id] == nullptr && !rasterize(id, painter, panel.width(), panel.height())) {
+    painter(panel);
+    return;
+  }
+  lastUse[id] = ++useClock;
+  if (panel.inFrame()) {
+    background.attach(id, runs[id], runCount[id], panel);
+    panel.setBackground(&background);
+  } else {
+    blit(id, panel);
+  }
+}
@@ -2,17 +2,50 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_ST7789.h>
 #include <SPI.h>
+#include <SPIFFS.h>
+#include "board.h"
+#include "spi_bus.h"
+#include "display.h"
+#include "layer_cache.h"
+#include "screen_predictor.h"
+#include "queue_view.h"
+#include "modal.h"
 #include "touch.h"
-#include "goadminbtn_32x32.h"
-#include "gouserbtn_32x32.h"
+#include "gesture.h"
+#include "qms_queue.h"
+#include "throughput_series.h"
+#include "admission.h"
+#include "ui_atlas.h"
+#include "asset_partition.h"
+#include "background_image.h"
+#include "animation.h"
+#include "digit_roll.h"
+#include "screen_slide.h"
+#include "boot_profile.h"
+#include "profile.h"
+#include "admin_link.h"
+#include "status_json.h"
 
-// ST7789 디스플레이 핀 설정
-#define TFT_CS    15
-#define TFT_RST   4
-#define TFT_DC    2
-#define TFT_MOSI  23
-#define TFT_SCLK  18
-#define TFT_BL    32
+// 안내판용 상태 HTTP (GET /status) - QMS_WIFI_SSID 를 주면 켜짐
+#ifndef QMS_STATUS_HTTP
+#ifdef QMS_WIFI_SSID
+#define QMS_STATUS_HTTP 1
+#else
+#define QMS_STATUS_HTTP 0
+#endif
+#endif
+#if QMS_STATUS_HTTP
+#include <WiFi.h>
+#include <WebServer.h>
+#ifndef QMS_WIFI_SSID
+#define QMS_WIFI_SSID ""
+#endif
+#ifndef QMS_WIFI_PASS
+#define QMS_WIFI_PASS ""
+#endif
+#endif
+
+// 디스플레이/터치 핀과 SPI 버스 설정은 board.h
 
 // 화면 크기 (ST7789는 240x320)
 #define SCREEN_WIDTH  240
@@ -51,14 +84,13 @@ enum ScreenState {
   QUEUE_LIST,         // 대기열 현황 조회
   QUEUE_DELETE_CONFIRM, // 대기열 삭제 확인
   TIME_SETTING,       // 사용자당 처리 시간 설정
-  PASSWORD_CHANGE     // 관리자 비밀번호 변경
+  PASSWORD_CHANGE,    // 관리자 비밀번호 변경
+  STATS_CHART         // 처리량 통계 차트
 };
 
 // 전역 변수
 ScreenState currentScreen = USER_MODE;
 int currentTicket = 0;            // 현재 발행된 마지막 번호
-int waitingCount = 0;             // 현재 대기 인원
-int waitingTimeSec = 0;           // 예상 대기시간(초)
 int issuedTicketWaitTime = 0;     // 발행된 티켓의 대기시간(초)
 int issuedTicket = 0;             // 방금 발행된 번호
 String adminPassword = "";        // 관리자 비밀번호 입력 버퍼
@@ -66,39 +98,118 @@ String correctPassword = "5678";  // 관리자 실제 비밀번호
 unsigned long ticketIssueTime = 0; // 번호 발행 시간
 int callWaitPosition = 1;         // 대기열 내 본인 순번
 
-// 대기열 관리
-int queueList[20];   // 대기열 번호 목록 (최대 20명)
-int queueCount = 0;  // 현재 대기열 개수
+// 대기열 관리 (목록/개수/처리 시간은 qms_queue.h)
 int selectedQueueIndex = -1;  // 삭제 선택된 queue 인덱스
-int userProcessTimeSec = 60;  // 1명당 처리 시간(초)
 String newPassword = "";  // 변경할 새 비밀번호 입력 버퍼
+ThroughputSeries throughputSeries;  // 분/시/일 단위 처리량 기록
+
+// 대기열 목록 (4열 45x30 버튼, 제목 아래부터 스크롤)
+QueueListView queueView({PADDING + 70, PADDING, PADDING + 5, 4, 45, 30, 6, invertColor(COLOR_ADMIN_BG)});
+
+// 모달 (호출 창 / 삭제 확인 창) - 열린 동안 가려진 아래 화면 영역을 저장해 두고 닫을 때 그 영역만 복원
+ModalOverlay modal;
+ScreenState modalParent = USER_MODE;  // 모달 아래 화면
+int modalListChangedFrom = -1;        // 모달이 열린 동안 바뀐 첫 대기열 인덱스 (-1 = 그대로)
+
+// 애니메이션 (고정 틱) - USER_MODE ↔ TICKET_ISSUED 슬라이드, 대기시간 숫자 굴림
+#ifndef QMS_SLIDE_MS
+#define QMS_SLIDE_MS 320   // 0 = 슬라이드 없이 바로 전환
+#endif
+#define DIGIT_ROLL_MS 240
+Animator animator;
+ScreenSlide screenSlide;
+
+// 발행 수용 판단 (대기열 자리 / 최대 대기시간 / 마감 시각)
+AdmissionPolicy admissionPolicy(QUEUE_CAPACITY);
+AdmissionDecision lastAdmission;    // 마지막 거절 사유 (QUEUE_FULL 화면 표시용)
+
+// 사용자 화면 배경 이미지 (SPIFFS 에 있으면 단색 배경 대신 띠마다 풀어서 깔고 위젯을 그 위에 합성)
+#define USER_BG_PATH "/bg_user.jpg"
+BackgroundImage userBackground;
+
+// 시리얼 명령 입력 버퍼
+String serialLine = "";
+
+// 관리용 바이너리 명령 (같은 시리얼 포트, 0xA5 로 시작하는 프레임)
+AdminLink adminLink;
+LinkReply linkReply;
+int remoteChangedFrom = -1;   // 바이너리 명령으로 바뀐 첫 대기열 인덱스 (loop 마다 한 번 화면에 반영)
+
+// 안내판용 상태 JSON (시리얼 status 명령과 HTTP 가 같은 버퍼에 씀)
+StatusFeed statusFeed;
+char statusBuffer[STATUS_JSON_MAX];
+#if QMS_STATUS_HTTP
+#define STATUS_HTTP_PORT 80
+WebServer statusServer(STATUS_HTTP_PORT);
+bool statusServerStarted = false;
+bool statusAddressShown = false;
+#endif
+
+// 터치 기록 재생 (화면 전환과 SPI 비용을 결정적으로 기록)
+#define REPLAY_PATH "/touch.qtt"
+#define REPLAY_MAX_BYTES 65536
+Print* replayLog = &Serial;        // 재생 로그 출력 대상 (호스트 빌드에서 교체)
+uint8_t* replayBuffer = nullptr;
+bool replayActive = false;
+unsigned long replayStartMs = 0;
+ScreenState loggedScreen = USER_MODE;
+unsigned long replayLongestLoopUs = 0;  // 터치 샘플 사이 가장 긴 loop 처리 시간
+
+const char* screenNames[] = {
+  "USER_MODE", "ADMIN_LOGIN", "ADMIN_MODE", "TICKET_ISSUED", "QUEUE_FULL", "CALL_MODAL",
+  "QUEUE_LIST", "QUEUE_DELETE_CONFIRM", "TIME_SETTING", "PASSWORD_CHANGE", "STATS_CHART"
+};
+
+// 통계 차트 (막대 높이는 화면 진입/탭 변경 시 미리 계산)
+#define CHART_X      PADDING
+#define CHART_Y      (PADDING + 125)
+#define CHART_W      200
+#define CHART_H      140
+SeriesResolution chartResolution = SERIES_MINUTE;
+SeriesMetric chartMetric = METRIC_SERVED;
+uint8_t chartHeights[CHART_W];
+uint8_t chartMarkers[CHART_W];
+int chartColumnCount = 0;
+uint16_t chartPeak = 0;
 
 // 터치 디버깅용
 int lastTouchX = -1;
 int lastTouchY = -1;
 unsigned long touchDisplayTime = 0;
 
-// 대기열 자동 처리 타이머
-unsigned long lastProcessTime = 0;
+// 사용자 화면 라벨 (값은 라벨 바로 뒤에 이어서 표시)
+// 라벨 뒤 x 좌표 = 시작 x + 글자 수 * 6px (기본 글꼴 1배)
+#define LABEL_END_X(x, label) ((x) + (int)strlen(label) * 6)
+const char* USER_WAITING_LABEL = "Current Waiting: ";
+const char* USER_WAIT_LABEL = "Expected Wait: ";
 
 // 동적 대기시간 표시용
 int lastDisplayedWaitMin = -1;
 int lastDisplayedWaitSec = -1;
 unsigned long lastWaitTimeUpdate = 0;
 
-// 터치 안정화 (물리적 손상 대비)
-int touchStabilizeCount = 0;
-int touchStabilizeX = -1;
-int touchStabilizeY = -1;
+// 터치 안정화 (물리적 손상 대비) - 같은 영역 연속 샘플 수로 누름 확정 후 제스처 판별
 const int TOUCH_STABILIZE_THRESHOLD = 50;  // 50회 연속 동일 지점 확인
 const int TOUCH_STABILIZE_AREA = 10;       // 동일 영역 오차 범위(px)
+GestureEngine gestures(TOUCH_STABILIZE_THRESHOLD, TOUCH_STABILIZE_AREA);
+
+// 대기열 목록 제스처 (목록 안에서 시작한 누름은 뗄 때까지 목록이 처리)
+bool listGestureActive = false;
+#define LIST_FLING_TICK_MS       16   // 관성 스크롤 감속 단위
+#define LIST_FLING_MIN_PX_PER_S  60   // 이보다 느려지면 멈춤
+int32_t listFlingVelocity = 0;        // px/s (양수 = 아래쪽 항목으로)
+int32_t listFlingRemainder = 0;       // 1px 미만 이동량 누적 (px/1000)
+unsigned long listFlingLastMs = 0;
 
 // TFT 및 터치스크린 객체 생성
-Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
+QmsDisplay tft(TFT_CS, TFT_DC, TFT_RST);  // SPI 비용 계측 포함
+ScreenCanvas screenCanvas(tft);           // 스크롤 중에도 화면 좌표로 (모달용)
 TouchModule touchModule(SCREEN_HEIGHT, SCREEN_WIDTH);
+BootProfile bootProfile;                  // 부팅 단계별 시간
 
 // 함수 선언
 void drawUserMode();
+void paintUserModeWidgets(Adafruit_GFX& g);
 void drawAdminLogin();
 void drawAdminMode();
 void drawTicketIssued();
@@ -108,131 +219,267 @@ void drawQueueList();
 void drawQueueDeleteConfirm();
 void drawTimeSetting();
 void drawPasswordChange();
+void drawStatsChart();
+void prepareChartColumns();
 void handleTouch(int x, int y);
+void handleGesture(const Gesture& g);
+void updateListFling();
+void deleteQueueItemInPlace(int index);
+void refreshQueueListFrom(int index);
+void printQueueCount(Adafruit_GFX& g);
+void openModal(ScreenState screen);
+void closeModal();
+void noteQueueChangedUnderModal(int index);
+void drawCallModalFields();
+void updatePressFeedback(bool down, int x, int y);
+void holdPressFeedback();
+void seedScreenPredictor();
+void trackScreenTransition();
+void prerenderIdleStep();
 void handleAdminLoginTouch(int x, int y);
 void handlePasswordChangeTouch(int x, int y);
-void addToQueue(int ticketNum);
-void removeFromQueue(int index);
-void drawInvertedRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h);
+void processQueueHead(bool log);
+void pollSerialCommands();
+void handleLinkFrame(const LinkFrame& frame);
+void noteRemoteChange(int index);
+void applyRemoteChange();
+size_t renderStatus(uint32_t since);
+void startStatusServer();
+void pollStatusServer();
+bool beginTouchReplay(const uint8_t* buffer, size_t len);
+void logReplayProgress();
+void handleSerialCommand(String line);
+void printMinSec(Print& out, int totalSec);
+void formatMinSec(char* out, size_t size, int totalSec);
+void stepWaitRoll(int32_t phase, bool done);
+void stepSlide(int32_t lines, bool done);
+void slideInScreen(bool up);
+void resolveIcons();
+void loadUserBackground();
+void eraseUserField(int16_t x, int16_t y, int16_t w, int16_t h);
+void drawIcon(Adafruit_GFX& g, int16_t x, int16_t y, uint8_t sprite);
+bool deferredInitStep();
 
 // ===== 유틸리티 함수 구현 =====
 
-// RGB565 색상 반전 이미지 그리기
-void drawInvertedRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
-  for (int16_t j = 0; j < h; j++) {
-    for (int16_t i = 0; i < w; i++) {
-      uint16_t color = pgm_read_word(&bitmap[j * w + i]);
-      tft.drawPixel(x + i, y + j, ~color);  // 색상 반전
+// UI 아이콘마다 그릴 아틀라스와 번호 (에셋 파티션에 같은 이름이 있으면 파티션, 없으면 내장)
+const SpriteAtlas* iconAtlas[UI_ATLAS_COUNT];
+uint8_t iconIndex[UI_ATLAS_COUNT];
+
+void resolveIcons() {
+  assetPartition.begin();
+  int fromPartition = 0;
+  for (int i = 0; i < UI_ATLAS_COUNT; i++) {
+    int found = assetPartition.find(ui_atlas_names[i]);
+    if (found >= 0) {
+      iconAtlas[i] = assetPartition.atlas();
+      iconIndex[i] = found;
+      fromPartition++;
+      continue;
     }
+#if QMS_ASSET_BUILTIN
+    iconAtlas[i] = &ui_atlas;
+    iconIndex[i] = i;
+#else
+    iconAtlas[i] = nullptr;
+#endif
+  }
+  Serial.print("Assets: ");
+  Serial.print(fromPartition);
+  Serial.print("/");
+  Serial.print(UI_ATLAS_COUNT);
+  Serial.print(" icons from partition (");
+  Serial.print(assetPartition.imageSize());
+  Serial.println(" bytes mapped)");
+}
+
+// UI 아이콘 그리기 (반전은 변환할 때 이미 적용됨)
+// 패널에 직접 그리면 주소창 하나로 줄마다 스트리밍, 캔버스(레이어 래스터화)나
+// 프레임 기록 중(배경 이미지 위 합성)이면 같은 색 구간 단위로
+void drawIcon(Adafruit_GFX& g, int16_t x, int16_t y, uint8_t sprite) {
+  const SpriteAtlas* atlas = iconAtlas[sprite];
+  if (atlas == nullptr) return;
+  if (&g == &tft && !tft.inFrame()) streamSprite(tft, x, y, *atlas, iconIndex[sprite]);
+  else drawSprite(g, x, y, *atlas, iconIndex[sprite]);
+}
+
+// 사용자 화면 배경 이미지 열기 (없거나 지원하지 않는 JPEG 면 단색 배경 그대로)
+void loadUserBackground() {
+  if (!SPIFFS.begin(true) || !SPIFFS.exists(USER_BG_PATH)) return;
+  if (!userBackground.begin(SPIFFS, USER_BG_PATH, invertColor(COLOR_USER_BG))) {
+    Serial.println("Background: " USER_BG_PATH " not supported (baseline JPEG only)");
+    return;
   }
+  const JpegDecoder& image = userBackground.image();
+  Serial.print("Background: ");
+  Serial.print(image.width());
+  Serial.print("x");
+  Serial.print(image.height());
+  Serial.print(" JPEG, ");
+  Serial.print(image.mcuWidth());
+  Serial.print("x");
+  Serial.print(image.mcuHeight());
+  Serial.print(" MCU, ");
+  Serial.print(sizeof(JpegDecoder));
+  Serial.println(" bytes decoder");
+}
+
+// 사용자 화면에서 바뀌는 글자 자리 지우기 (배경 이미지면 그 영역만 이미지로 되돌림)
+void eraseUserField(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if (userBackground.ready() && tft.inFrame()) userBackground.restore(tft, x, y, w, h);
+  else tft.fillRect(x, y, w, h, invertColor(COLOR_USER_BG));
+}
+
+// ===== 애니메이션 =====
+
+// 대기시간 mm:ss - 바뀐 숫자 칸만 굴림 (화면 전체를 다시 그릴 때 reset)
+DigitRoll waitRoll(LABEL_END_X(PADDING, USER_WAIT_LABEL), PADDING + 75,
+                   invertColor(COLOR_USER_TEXT), invertColor(COLOR_USER_BG), eraseUserField);
+
+void stepWaitRoll(int32_t phase, bool done) {
+  if (currentScreen != USER_MODE) return;
+  waitRoll.render(tft, phase);
+}
+
+// 슬라이드는 목표 줄 수만 정하고 전송은 loop 마다 screenSlide.pump 가 예산 안에서
+void stepSlide(int32_t lines, bool done) {
+  screenSlide.setTarget(lines);
+}
+
+// 방금 프레임에 그린 화면을 슬라이드로 보냄 (up = 아래에서 올라옴). 안 되면 보통 전송
+void slideInScreen(bool up) {
+  if (QMS_SLIDE_MS == 0 || !screenSlide.begin(tft, up)) return;
+  animator.cancel(stepWaitRoll);
+  animator.start(0, tft.height(), QMS_SLIDE_MS, EASE_IN_OUT, stepSlide, false);
+}
+
+// ===== 부팅 =====
+
+// 첫 화면에 필요 없는 초기화는 첫 화면을 보낸 뒤 입력이 없는 loop 마다 하나씩 (미리 그리기보다 먼저)
+void restoreThroughputSeries() {
+  throughputSeries.loadSpilledDays();
+}
+
+// 배경 이미지를 열고, 사용자 화면이 이미 떠 있으면 배경을 깔아서 다시 그림
+void applyUserBackground() {
+  loadUserBackground();
+  if (!userBackground.ready()) return;
+  waitRoll.setFade(false);
+  if (currentScreen == USER_MODE) drawUserMode();
+}
+
+struct DeferredInit {
+  const char* name;
+  void (*run)();
+};
+
+const DeferredInit deferredInit[] = {
+  {"series replay", restoreThroughputSeries},
+  {"background", applyUserBackground},
+  {"predictor seed", seedScreenPredictor},
+#if QMS_STATUS_HTTP
+  {"status http", startStatusServer},
+#endif
+};
+const uint8_t DEFERRED_INIT_COUNT = sizeof(deferredInit) / sizeof(deferredInit[0]);
+uint8_t deferredInitNext = 0;
+
+// 남은 단계가 있었으면 하나 실행하고 true. 다 끝나면 부팅 기록을 출력
+bool deferredInitStep() {
+  if (deferredInitNext >= DEFERRED_INIT_COUNT) return false;
+  const DeferredInit& step = deferredInit[deferredInitNext++];
+  uint32_t startCycles = ESP.getCycleCount();
+  step.run();
+  bootProfile.record(step.name, ESP.getCycleCount() - startCycles, true);
+  if (deferredInitNext == DEFERRED_INIT_COUNT) bootProfile.print(Serial);
+  return true;
 }
 
 void setup() {
+  bootProfile.begin();
+  Serial.setRxBufferSize(LINK_RING_SIZE);  // 바이너리 명령이 몰려도 loop 한 번 동안 넘치지 않게
   Serial.begin(115200);
-  delay(1000);
   Serial.println("\n=================================");
   Serial.println("Embedded QMS Starting...");
   Serial.println("=================================");
   
-  // SPI 초기화
+  // SPI 초기화 (터치가 같은 버스를 쓰면 MISO 도 연결)
+#if QMS_TOUCH_BUS == TOUCH_BUS_SHARED
+  SPI.begin(TFT_SCLK, TOUCH_MISO, TFT_MOSI, TFT_CS);
+#else
   SPI.begin(TFT_SCLK, -1, TFT_MOSI, TFT_CS);
+#endif
+  tftBus.begin();
   
-  // 백라이트 핀 설정
+  // 백라이트는 첫 화면을 보낸 뒤에 (리셋 직후 GRAM 은 쓰레기)
   pinMode(TFT_BL, OUTPUT);
-  digitalWrite(TFT_BL, HIGH);
+  digitalWrite(TFT_BL, LOW);
   
-  // TFT 디스플레이 초기화
-  tft.init(240, 320, SPI_MODE3);
-  tft.setRotation(0);
+  // TFT 리셋 - 슬립 해제까지 120ms 를 기다리는 동안 나머지 초기화
+  tft.resetPanel(tftDevice.clockHz, SPI_MODE3);
+  bootProfile.mark("panel reset");
   
-  // 터치스크린 초기화
+  // 아이콘 (에셋 파티션 매핑)
+  resolveIcons();
+  bootProfile.mark("icons");
+  
+  // 터치스크린 초기화 (별도 버스면 다른 코어에서 샘플링)
   touchModule.begin();
+  touchModule.startSamplingTask(TOUCH_TASK_PERIOD_MS);
+  bootProfile.mark("touch");
+  
+  // 티켓 기록 기준 시각 (저장된 일 통계는 첫 화면 뒤에 읽음)
+  ticketLog.begin(millis());
+  throughputSeries.begin(millis());
+  bootProfile.mark("state");
+  
+  tft.wakePanel();
+  bootProfile.mark("panel wake");
   
-  // 초기 화면 그리기
+  // 초기 화면 그리기 (배경 이미지는 첫 화면 뒤에 열고 다시 그림)
+  tft.beginFrame();
   drawUserMode();
+  tft.endFrame();
+  digitalWrite(TFT_BL, HIGH);
+  bootProfile.mark("first frame");
+  bootProfile.ready();
   
   Serial.println("QMS System Ready!");
 }
 
 void loop() {
-  // 터치 감지
-  if (touchModule.isTouched()) {
-    int screenX, screenY;
-    touchModule.getScreenCoordinates(screenX, screenY);
+  // 이번 루프에서 그리는 것은 모아 두었다가 끝에서 띠 단위로 전송 (이전 프레임이 남아 있으면 이어서)
+  tft.beginFrame();
+  
+  // 시리얼 설정 명령
+  pollSerialCommands();
+#if QMS_STATUS_HTTP
+  pollStatusServer();
+#endif
+  
+  // 터치 감지 (기록/재생 중이면 샘플이 기록되거나 트레이스에서 공급됨)
+  TouchSample touch = touchModule.sample();
+  unsigned long sampledUs = micros();
+  int screenX = 0, screenY = 0;
+  if (touch.down) {
+    touchModule.toScreen(touch, screenX, screenY);
     
     screenX = constrain(screenX, 0, SCREEN_WIDTH - 1);
     screenY = constrain(screenY, 0, SCREEN_HEIGHT - 1);
-    
-    // 터치 안정화: 10x10 내에서 3회 연속 터치 시 인정
-    if (touchStabilizeCount == 0) {
-      // 첫 터치: 기준점 설정
-      touchStabilizeX = screenX;
-      touchStabilizeY = screenY;
-      touchStabilizeCount = 1;
-      Serial.print("Touch stabilize [1/3]: X=");
-      Serial.print(screenX);
-      Serial.print(", Y=");
-      Serial.println(screenY);
-    } else {
-      // 이전 터치와 거리 비교
-      int deltaX = abs(screenX - touchStabilizeX);
-      int deltaY = abs(screenY - touchStabilizeY);
-      
-      if (deltaX <= TOUCH_STABILIZE_AREA && deltaY <= TOUCH_STABILIZE_AREA) {
-        // 같은 영역 내 터치
-        touchStabilizeCount++;
-        Serial.print("Touch stabilize [");
-        Serial.print(touchStabilizeCount);
-        Serial.print("/3]: X=");
-        Serial.print(screenX);
-        Serial.print(", Y=");
-        Serial.println(screenY);
-        
-        if (touchStabilizeCount >= TOUCH_STABILIZE_THRESHOLD) {
-          // 3회 연속 성공 → 실제 터치로 처리
-          int avgX = (touchStabilizeX + screenX) / 2;
-          int avgY = (touchStabilizeY + screenY) / 2;
-          
-          Serial.print("Touch CONFIRMED: X=");
-          Serial.print(avgX);
-          Serial.print(", Y=");
-          Serial.println(avgY);
-          
-          // 터치 처리
-          handleTouch(avgX, avgY);
-          
-          // 안정화 리셋
-          touchStabilizeCount = 0;
-          
-          delay(200);  // 디바운스
-        }
-      } else {
-        // 기준점 벗어남 → 초기화
-        touchStabilizeX = screenX;
-        touchStabilizeY = screenY;
-        touchStabilizeCount = 1;
-        Serial.println("Touch area changed, reset counter");
-      }
-    }
-  } else {
-    // 터치 없음: 카운터 초기화
-    if (touchStabilizeCount > 0) {
-      touchStabilizeCount = 0;
-    }
   }
+  // 터치 안정화 + 제스처 판별 (10x10 내 연속 터치로 누름 확정, 뗄 때까지 한 번만)
+  handleGesture(gestures.feed(touch.timeUs, touch.down, screenX, screenY));
+  updatePressFeedback(touch.down, screenX, screenY);
+  updateListFling();
   
-  // 사용자 화면에서 매 초마다 대기시간 동적 업데이트
-  if (currentScreen == USER_MODE && queueCount > 0) {
+  // 사용자 화면에서 매 초마다 대기시간 동적 업데이트 (슬라이드로 들어오는 중이면 끝난 뒤에)
+  if (currentScreen == USER_MODE && queueCount > 0 && !screenSlide.active()) {
     unsigned long currentMillis = millis();
     if (currentMillis - lastWaitTimeUpdate >= 1000) {
       lastWaitTimeUpdate = currentMillis;
       
       // 남은 시간 계산 (현재 처리 중인 사람의 남은 시간 포함)
-      unsigned long elapsedSinceLastProcess = (currentMillis - lastProcessTime) / 1000;
-      int remainingForCurrent = userProcessTimeSec - elapsedSinceLastProcess;
-      if (remainingForCurrent < 0) remainingForCurrent = 0;
-      
-      int totalRemainingSec = remainingForCurrent + (queueCount - 1) * userProcessTimeSec;
+      int totalRemainingSec = expectedWaitSec(currentMillis);
       int mins = totalRemainingSec / 60;
       int secs = totalRemainingSec % 60;
       
@@ -241,24 +488,22 @@ void loop() {
         lastDisplayedWaitMin = mins;
         lastDisplayedWaitSec = secs;
         
-        // 시간 표시 영역만 지우고 다시 그리기
-        tft.fillRect(PADDING + 84, PADDING + 75, 60, 10, invertColor(COLOR_USER_BG));
-        tft.setTextColor(invertColor(COLOR_USER_TEXT));
-        tft.setTextSize(1);
-        tft.setCursor(PADDING + 84, PADDING + 75);
-        if (mins < 10) tft.print("0");
-        tft.print(mins);
-        tft.print(":");
-        if (secs < 10) tft.print("0");
-        tft.print(secs);
+        // 바뀐 숫자만 굴림 (자릿수가 바뀌면 그 자리만 바로 다시 그림)
+        char text[24];
+        formatMinSec(text, sizeof(text), totalRemainingSec);
+        animator.finish(stepWaitRoll);
+        if (waitRoll.change(tft, text)) {
+          animator.start(0, DIGIT_ROLL_LINES, DIGIT_ROLL_MS, EASE_OUT, stepWaitRoll);
+        }
       }
     }
   }
   
-  // 티켓 발행 화면 → 10초 뒤 자동 복귀
+  // 티켓 발행 화면 → 10초 뒤 자동 복귀 (위에서 내려오는 슬라이드)
   if (currentScreen == TICKET_ISSUED && millis() - ticketIssueTime > 10000) {
     currentScreen = USER_MODE;
     drawUserMode();
+    slideInScreen(false);
   }
   
   // 대기열 꾽 차서 화면 → 10초 뒤 자동 복귀
@@ -267,189 +512,377 @@ void loop() {
     drawUserMode();
   }
 
+  // 처리량 시계열 갱신 (분 경계에서 버킷 마감)
+  throughputSeries.update(millis(), queueCount);
+
   // 대기열 자동 처리
-  if (queueCount > 0 && millis() - lastProcessTime >= userProcessTimeSec * 1000) {
-    removeFromQueue(0);
+  if (queueHeadDue(millis())) {
+    processQueueHead(true);
     lastProcessTime = millis();
     if (currentScreen == USER_MODE) {
       drawUserMode();
+    } else if (currentScreen == CALL_MODAL) {
+      drawCallModalFields();
+    } else if (currentScreen == QUEUE_LIST) {
+      refreshQueueListFrom(0);
     }
   }
-}
-
-// ===== UI 그리기 함수 =====
-
-void drawUserMode() {
-  tft.fillScreen(invertColor(COLOR_USER_BG));
   
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_USER_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
-  // 관리자 버튼 아이콘 (우측 상단 32x32) - 색상 반전
-  drawInvertedRGBBitmap(SCREEN_WIDTH-PADDING-32, PADDING, goadminbtn_32x32, 32, 32);
-  
-  // 사용자 모드 표시
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, PADDING+25);
-  tft.print("User Mode");
-  
-  // 대기 정보 표시
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, PADDING+55);
-  tft.print("Current Waiting: ");
-  tft.print(waitingCount);
-  tft.print(" people");
-  
-  tft.setCursor(PADDING, PADDING+75);
-  tft.print("Expected Wait: ");
-  
-  // 남은 시간 계산
-  unsigned long elapsedSinceLastProcess = (millis() - lastProcessTime) / 1000;
-  int remainingForCurrent = userProcessTimeSec - elapsedSinceLastProcess;
-  if (remainingForCurrent < 0) remainingForCurrent = 0;
-  int totalRemainingSec = (queueCount > 0) ? (remainingForCurrent + (queueCount - 1) * userProcessTimeSec) : 0;
+  // 목록에서 다시 그리기로 예약된 줄은 앞 프레임을 다 보낸 뒤 한 줄씩
+  if (currentScreen == QUEUE_LIST && queueView.pending() && !tft.framePending()) queueView.pump(tft);
+
+  // 화면 전환 빈도 기록, 입력이 없으면 (미룬 부팅 초기화를 마친 뒤) 다음에 올 화면의 정적 레이어를 한 띠씩 미리 래스터화
+  trackScreenTransition();
+  if (!touch.down && !gestures.pressed() && gestures.settlingCount() == 0 && listFlingVelocity == 0 &&
+      !tft.framePending() && !queueView.pending()) {
+    if (!deferredInitStep()) prerenderIdleStep();
+  }
   
-  int mins = totalRemainingSec / 60;
-  int secs = totalRemainingSec % 60;
-  lastDisplayedWaitMin = mins;
-  lastDisplayedWaitSec = secs;
+  // 애니메이션 틱 - 앞 틱에 그린 것이 아직 전송 중이면 숫자 굴림은 이번 틱을 건너뜀
+  animator.update(millis(), tft.framePending());
   
-  if (mins < 10) tft.print("0");
-  tft.print(mins);
-  tft.print(":");
-  if (secs < 10) tft.print("0");
-  tft.print(secs);
+  // 시간 예산만큼만 전송하고 남은 띠는 다음 loop 에서 (그 사이 터치/타이머 처리)
+  // 슬라이드 중에는 슬라이드가 드러나는 순서대로 보냄
+  if (screenSlide.active()) screenSlide.pump(DISPLAY_FRAME_BUDGET_US);
+  else tft.pumpFrame(DISPLAY_FRAME_BUDGET_US);
   
-  // 대기표 발행 버튼 (중앙 큰 버튼)
-  int btnW = SCREEN_WIDTH - PADDING*2;
-  int btnH = 70;
-  int btnX = PADDING;
-  int btnY = SCREEN_HEIGHT - PADDING - btnH - 30;
-  tft.fillRect(btnX, btnY, btnW, btnH, invertColor(0xfb4d));  // 버튼 배경색
-  tft.drawRect(btnX, btnY, btnW, btnH, invertColor(0xb800));  // 버튼 테두리
-  tft.setTextColor(invertColor(0xffff));  // 버튼 글씨
-  tft.setTextSize(2);
-  tft.setCursor(btnX+40, btnY+25);
-  tft.print("Join Queue");
+  // 재생 중이면 화면 전환과 SPI 비용 기록
+  if (replayActive) {
+    replayLongestLoopUs = max(replayLongestLoopUs, micros() - sampledUs);
+    logReplayProgress();
+  }
 }
 
-void drawAdminLogin() {
-  tft.fillScreen(invertColor(COLOR_ADMIN_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
-  // 서브 타이틀
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, PADDING+25);
-  tft.print("Admin Login - Hex");
-  
-  // 비밀번호 표시 영역
-  tft.fillRect(PADDING+10, PADDING+50, 160, 35, invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextColor(invertColor(COLOR_GREEN));
-  tft.setTextSize(3);
-  tft.setCursor(PADDING+20, PADDING+57);
-  tft.print(adminPassword);
-  
-  // 16진수 키패드 (4x4)
-  const char* keys[16] = {"1", "2", "3", "4", "5", "6", "7", "8", 
+// ===== 제스처 처리 =====
+
+void handleGesture(const Gesture& g) {
+  bool onList = listGestureActive && currentScreen == QUEUE_LIST;
+
+  switch (g.type) {
+    case GESTURE_PRESS:
+      Serial.print("Touch CONFIRMED: X=");
+      Serial.print(g.x);
+      Serial.print(", Y=");
+      Serial.println(g.y);
+
+      listFlingVelocity = 0;
+      // 목록 영역은 탭/길게 누르기/드래그가 갈릴 때까지 기다리고, 나머지는 누름 확정 즉시 처리
+      listGestureActive = currentScreen == QUEUE_LIST && queueView.contains(g.x, g.y);
+      // 새 화면은 누른 곳 근처 띠부터 보냄
+      tft.setFocusLine(g.y);
+      if (!listGestureActive) {
+        handleTouch(g.x, g.y);
+        holdPressFeedback();
+      }
+      break;
+
+    case GESTURE_TAP:
+      if (onList) handleTouch(g.x, g.y);
+      listGestureActive = false;
+      break;
+
+    case GESTURE_LONG_PRESS:
+      if (onList) deleteQueueItemInPlace(queueView.itemAt(g.startX, g.startY));
+      break;
+
+    case GESTURE_DRAG:
+      // 손가락을 따라 콘텐츠 이동 (위로 끌면 아래쪽 항목)
+      if (onList) queueView.scrollBy(tft, -g.dy);
+      break;
+
+    case GESTURE_SWIPE:
+      if (onList) {
+        listFlingVelocity = -g.vy;
+        listFlingRemainder = 0;
+        listFlingLastMs = millis();
+      }
+      listGestureActive = false;
+      break;
+
+    case GESTURE_RELEASE:
+      listGestureActive = false;
+      break;
+
+    case GESTURE_NONE:
+      break;
+  }
+}
+
+// 스와이프 후 관성 스크롤 - LIST_FLING_TICK_MS 마다 속도를 7/8 로 줄임
+void updateListFling() {
+  if (listFlingVelocity == 0) return;
+  if (currentScreen != QUEUE_LIST || gestures.pressed()) {
+    listFlingVelocity = 0;
+    return;
+  }
+
+  unsigned long now = millis();
+  while (now - listFlingLastMs >= LIST_FLING_TICK_MS) {
+    listFlingLastMs += LIST_FLING_TICK_MS;
+    listFlingRemainder += listFlingVelocity * LIST_FLING_TICK_MS;
+    listFlingVelocity = listFlingVelocity * 7 / 8;
+  }
+
+  int step = listFlingRemainder / 1000;
+  listFlingRemainder -= step * 1000;
+  if (step != 0 && queueView.scrollBy(tft, step) == 0) {
+    listFlingVelocity = 0;  // 끝에 닿음
+    return;
+  }
+  if (abs(listFlingVelocity) < LIST_FLING_MIN_PX_PER_S) listFlingVelocity = 0;
+}
+
+// ===== UI 그리기 함수 =====
+// 각 화면은 정적 레이어(paintXxxStatic, 처음 방문 시 캐시)와
+// 상태에 따라 바뀌는 동적 필드(drawXxx 에서 tft 에 직접)로 나뉨
+
+// 상단 제목 (모든 화면 공통)
+void paintTitle(Adafruit_GFX& g, uint16_t color) {
+  g.setTextColor(invertColor(color));
+  g.setTextSize(2);
+  g.setCursor(PADDING, PADDING);
+  g.print("Embedded QMS");
+}
+
+// 우측 상단 X 버튼
+void paintCloseButton(Adafruit_GFX& g, uint16_t fill) {
+  g.fillRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(fill));
+  g.drawRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(fill == COLOR_ADMIN_TEXT ? COLOR_WHITE : COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+  g.setCursor(SCREEN_WIDTH-PADDING-25, PADDING+10);
+  g.print("X");
+}
+
+// 16진수 키패드 (4x4) + 우측 기능 버튼 (BACK, CLEAR, DEL, ENTER)
+void paintHexKeypad(Adafruit_GFX& g, uint16_t keyColor) {
+  const char* keys[16] = {"1", "2", "3", "4", "5", "6", "7", "8",
                           "9", "0", "A", "B", "C", "D", "E", "F"};
-  
+
   int keySize = 38;  // 축소 사이즈
   int keyGap = 4;
   int startX = PADDING;
   int startY = PADDING + 105;
-  
+
   for (int i = 0; i < 16; i++) {
     int row = i / 4;
     int col = i % 4;
     int x = startX + col * (keySize + keyGap);
     int y = startY + row * (keySize + keyGap);
-    
-    tft.fillRect(x, y, keySize, keySize, invertColor(COLOR_ADMIN_BTN));
-    tft.drawRect(x, y, keySize, keySize, invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextSize(2);
-    
-    tft.setCursor(x + 12, y + 12);
-    tft.print(keys[i]);
+
+    g.fillRect(x, y, keySize, keySize, invertColor(keyColor));
+    g.drawRect(x, y, keySize, keySize, invertColor(COLOR_ADMIN_TEXT));
+    g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+    g.setTextSize(2);
+
+    g.setCursor(x + 12, y + 12);
+    g.print(keys[i]);
   }
-  
-  // 우측 기능 버튼 (BACK, CLEAR, DEL, ENTER)
+
   int funcX = SCREEN_WIDTH - PADDING - 30;
   for (int i = 0; i < 4; i++) {
     int y = startY + i * (keySize + keyGap);
-    tft.fillRect(funcX, y, 30, keySize, invertColor(COLOR_ADMIN_BTN));
-    tft.drawRect(funcX, y, 30, keySize, invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextSize(1);
-    
-    tft.setCursor(funcX + 2, y + 16);
-    if (i == 0) tft.print("BCK");
-    else if (i == 1) tft.print("CLR");
-    else if (i == 2) tft.print("DEL");
-    else tft.print("ENT");
+    g.fillRect(funcX, y, 30, keySize, invertColor(keyColor));
+    g.drawRect(funcX, y, 30, keySize, invertColor(COLOR_ADMIN_TEXT));
+    g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+    g.setTextSize(1);
+
+    g.setCursor(funcX + 2, y + 16);
+    if (i == 0) g.print("BCK");
+    else if (i == 1) g.print("CLR");
+    else if (i == 2) g.print("DEL");
+    else g.print("ENT");
   }
 }
 
-void drawAdminMode() {
-  tft.fillScreen(invertColor(COLOR_ADMIN_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
-  // 사용자 모드 복귀 버튼 (우측 상단 32x32) - 색상 반전
-  drawInvertedRGBBitmap(SCREEN_WIDTH-PADDING-32, PADDING, gouserbtn_32x32, 32, 32);
-  
-  // 관리자 모드 표시
+// mm:ss 출력
+void printMinSec(Print& out, int totalSec) {
+  int mins = totalSec / 60;
+  int secs = totalSec % 60;
+  if (mins < 10) out.print("0");
+  out.print(mins);
+  out.print(":");
+  if (secs < 10) out.print("0");
+  out.print(secs);
+}
+
+void formatMinSec(char* out, size_t size, int totalSec) {
+  snprintf(out, size, "%02d:%02d", totalSec / 60, totalSec % 60);
+}
+
+void paintUserModeStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_USER_BG));
+  paintUserModeWidgets(g);
+}
+
+// 사용자 화면 배경 위의 고정 요소 (배경 이미지가 있으면 이미지 위에 바로 합성)
+void paintUserModeWidgets(Adafruit_GFX& g) {
+  paintTitle(g, COLOR_USER_TEXT);
+
+  // 관리자 버튼 아이콘 (우측 상단 32x32)
+  drawIcon(g, SCREEN_WIDTH-PADDING-32, PADDING, SPRITE_GOADMINBTN);
+
+  // 사용자 모드 표시
+  g.setTextSize(1);
+  g.setCursor(PADDING, PADDING+25);
+  g.print("User Mode");
+
+  // 대기 정보 라벨
+  g.setCursor(PADDING, PADDING+55);
+  g.print(USER_WAITING_LABEL);
+  g.setCursor(PADDING, PADDING+75);
+  g.print(USER_WAIT_LABEL);
+
+  // 대기표 발행 버튼 (중앙 큰 버튼)
+  int btnW = SCREEN_WIDTH - PADDING*2;
+  int btnH = 70;
+  int btnX = PADDING;
+  int btnY = SCREEN_HEIGHT - PADDING - btnH - 30;
+  g.fillRect(btnX, btnY, btnW, btnH, invertColor(0xfb4d));  // 버튼 배경색
+  g.drawRect(btnX, btnY, btnW, btnH, invertColor(0xb800));  // 버튼 테두리
+  g.setTextColor(invertColor(0xffff));  // 버튼 글씨
+  g.setTextSize(2);
+  g.setCursor(btnX+40, btnY+25);
+  g.print("Join Queue");
+}
+
+void drawUserMode() {
+  QMS_PROFILE_FUNCTION();  // 프레임 중이면 기록만 (전송은 pumpFrame 의 band compose)
+  // 배경 이미지 위에 정적 레이어를 배경색만 빼고 겹침 (캐시할 RAM 이 없으면 위젯을 직접 그림)
+  if (userBackground.ready() && tft.inFrame()) {
+    userBackground.attach(tft);
+    if (!layerCache.drawOver(USER_MODE, paintUserModeStatic, tft, invertColor(COLOR_USER_BG))) {
+      paintUserModeWidgets(tft);
+    }
+  } else {
+    layerCache.draw(USER_MODE, paintUserModeStatic, tft);
+  }
+
+  // 대기 정보 표시
+  tft.setTextColor(invertColor(COLOR_USER_TEXT));
   tft.setTextSize(1);
-  tft.setCursor(PADDING, PADDING+25);
-  tft.print("Admin Mode");
-  
-  // 메뉴 3개
-  const char* menus[3] = {"Waiting Call", "User Time Setting", "Admin Password"};
+  tft.setCursor(LABEL_END_X(PADDING, USER_WAITING_LABEL), PADDING+55);
+  tft.print(waitingCount);
+  tft.print(" people");
+
+  // 남은 시간 계산
+  int totalRemainingSec = expectedWaitSec(millis());
+  lastDisplayedWaitMin = totalRemainingSec / 60;
+  lastDisplayedWaitSec = totalRemainingSec % 60;
+
+  char text[24];
+  formatMinSec(text, sizeof(text), totalRemainingSec);
+  tft.setCursor(LABEL_END_X(PADDING, USER_WAIT_LABEL), PADDING+75);
+  tft.print(text);
+  animator.cancel(stepWaitRoll);
+  waitRoll.reset(text);
+}
+
+void paintAdminLoginStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintTitle(g, COLOR_ADMIN_TEXT);
+
+  // 서브 타이틀
+  g.setTextSize(1);
+  g.setCursor(PADDING, PADDING+25);
+  g.print("Admin Login - Hex");
+
+  // 비밀번호 표시 영역
+  g.fillRect(PADDING+10, PADDING+50, 160, 35, invertColor(COLOR_ADMIN_TEXT));
+
+  paintHexKeypad(g, COLOR_ADMIN_BTN);
+}
+
+void drawAdminLogin() {
+  layerCache.draw(ADMIN_LOGIN, paintAdminLoginStatic, tft);
+
+  tft.setTextColor(invertColor(COLOR_GREEN));
+  tft.setTextSize(3);
+  tft.setCursor(PADDING+20, PADDING+57);
+  tft.print(adminPassword);
+}
+
+// 관리자 화면 우측 호출 버튼 (제목 아래, 메뉴 위)
+#define ADMIN_CALL_X (SCREEN_WIDTH-PADDING-60)
+#define ADMIN_CALL_Y (PADDING+38)
+#define ADMIN_CALL_W 60
+#define ADMIN_CALL_H 26
+
+void paintAdminModeStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintTitle(g, COLOR_ADMIN_TEXT);
+
+  // 사용자 모드 복귀 버튼 (우측 상단 32x32)
+  drawIcon(g, SCREEN_WIDTH-PADDING-32, PADDING, SPRITE_GOUSERBTN);
+
+  // 관리자 모드 표시
+  g.setTextSize(1);
+  g.setCursor(PADDING, PADDING+25);
+  g.print("Admin Mode");
+
+  // 호출 창 버튼
+  g.fillRect(ADMIN_CALL_X, ADMIN_CALL_Y, ADMIN_CALL_W, ADMIN_CALL_H, invertColor(COLOR_GREEN));
+  g.drawRect(ADMIN_CALL_X, ADMIN_CALL_Y, ADMIN_CALL_W, ADMIN_CALL_H, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+  g.setCursor(ADMIN_CALL_X+6, ADMIN_CALL_Y+5);
+  g.print("Call");
+
+  // 메뉴 4개
+  const char* menus[4] = {"Waiting Call", "User Time Setting", "Admin Password", "Statistics"};
   int btnY = PADDING + 70;
-  int btnHeight = 50;
-  int btnGap = 20;
+  int btnHeight = 40;
+  int btnGap = 12;
   int btnW = SCREEN_WIDTH - PADDING*2;
-  
-  for (int i = 0; i < 3; i++) {
+
+  for (int i = 0; i < 4; i++) {
     int y = btnY + i * (btnHeight + btnGap);
-    tft.fillRect(PADDING, y, btnW, btnHeight, invertColor(COLOR_ADMIN_BTN));
-    tft.drawRect(PADDING, y, btnW, btnHeight, invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextSize(1);
-    tft.setCursor(PADDING+10, y + 20);
-    tft.print(menus[i]);
+    g.fillRect(PADDING, y, btnW, btnHeight, invertColor(COLOR_ADMIN_BTN));
+    g.drawRect(PADDING, y, btnW, btnHeight, invertColor(COLOR_ADMIN_TEXT));
+    g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+    g.setTextSize(1);
+    g.setCursor(PADDING+10, y + 16);
+    g.print(menus[i]);
   }
 }
 
+void drawAdminMode() {
+  layerCache.draw(ADMIN_MODE, paintAdminModeStatic, tft);
+}
+
+void paintTicketIssuedStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_USER_BG));
+  paintTitle(g, COLOR_USER_TEXT);
+
+  int startY = PADDING + 60;
+
+  // 라벨 (크기 1)
+  g.setTextSize(1);
+  g.setCursor(PADDING, startY);
+  g.print("Waiting Number");
+  g.setCursor(PADDING, startY + 60);
+  g.print("Your Position");
+  g.setCursor(PADDING, startY + 115);
+  g.print("Waiting Time");
+
+  // 확인 버튼
+  int btnW = 100;
+  int btnH = 30;
+  int btnX = (SCREEN_WIDTH - btnW) / 2;
+  int btnY = SCREEN_HEIGHT - PADDING - btnH - 10;
+  g.fillRect(btnX, btnY, btnW, btnH, invertColor(0xfb4d));  // 버튼 배경색
+  g.drawRect(btnX, btnY, btnW, btnH, invertColor(0xb800));  // 버튼 테두리
+  g.setTextColor(invertColor(0xffff));  // 버튼 글씨
+  g.setTextSize(1);
+  g.setCursor(btnX+38, btnY+10);
+  g.print("OK");
+}
+
 void drawTicketIssued() {
-  tft.fillScreen(invertColor(COLOR_USER_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_USER_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
+  layerCache.draw(TICKET_ISSUED, paintTicketIssuedStatic, tft);
+
   int startY = PADDING + 60;
-  
-  // Waiting Number (크기 1)
-  tft.setTextColor(invertColor(COLOR_USER_TEXT));
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, startY);
-  tft.print("Waiting Number");
-  
+
   // 대기번호 (크기 3)
   tft.setTextColor(COLOR_BLUE);
   tft.setTextSize(3);
@@ -457,336 +890,695 @@ void drawTicketIssued() {
   if (issuedTicket < 100) tft.print("0");
   if (issuedTicket < 10) tft.print("0");
   tft.print(issuedTicket);
-  
-  // Your Position (크기 1)
-  tft.setTextColor(invertColor(COLOR_USER_TEXT));
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, startY + 60);
-  tft.print("Your Position");
-  
+
   // 순번 (크기 2)
+  tft.setTextColor(invertColor(COLOR_USER_TEXT));
   tft.setTextSize(2);
   tft.setCursor(PADDING, startY + 75);
   tft.print(callWaitPosition);
-  
-  // Waiting Time (크기 1)
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, startY + 115);
-  tft.print("Waiting Time");
-  
+
   // 시간 (크기 2) - 티켓 발행 시점의 대기시간 사용
-  tft.setTextSize(2);
   tft.setCursor(PADDING, startY + 130);
-  int mins = issuedTicketWaitTime / 60;
-  int secs = issuedTicketWaitTime % 60;
-  if (mins < 10) tft.print("0");
-  tft.print(mins);
-  tft.print(":");
-  if (secs < 10) tft.print("0");
-  tft.print(secs);
-  
+  printMinSec(tft, issuedTicketWaitTime);
+}
+
+void paintQueueFullStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_USER_BG));
+  paintTitle(g, COLOR_USER_TEXT);
+
+  int startY = PADDING + 50;
+
+  // FAIL TO JOIN (크기 3)
+  g.setTextColor(COLOR_RED);
+  g.setTextSize(3);
+  g.setCursor(PADDING, startY);
+  g.print("FAIL TO JOIN");
+
+  // Thank you. (크기 1)
+  g.setTextColor(invertColor(COLOR_USER_TEXT));
+  g.setTextSize(1);
+  g.setCursor(PADDING, startY + 120);
+  g.print("Thank you.");
+
   // 확인 버튼
   int btnW = 100;
   int btnH = 30;
   int btnX = (SCREEN_WIDTH - btnW) / 2;
   int btnY = SCREEN_HEIGHT - PADDING - btnH - 10;
-  tft.fillRect(btnX, btnY, btnW, btnH, invertColor(0xfb4d));  // 버튼 배경색
-  tft.drawRect(btnX, btnY, btnW, btnH, invertColor(0xb800));  // 버튼 테두리
-  tft.setTextColor(invertColor(0xffff));  // 버튼 글씨
-  tft.setTextSize(1);
-  tft.setCursor(btnX+38, btnY+10);
-  tft.print("OK");
+  g.fillRect(btnX, btnY, btnW, btnH, invertColor(COLOR_ADMIN_TEXT));
+  g.drawRect(btnX, btnY, btnW, btnH, invertColor(COLOR_USER_TEXT));
+  g.setTextColor(invertColor(COLOR_WHITE));
+  g.setTextSize(1);
+  g.setCursor(btnX+25, btnY+10);
+  g.print("Confirm");
 }
 
 void drawQueueFull() {
-  tft.fillScreen(invertColor(COLOR_USER_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_USER_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
+  layerCache.draw(QUEUE_FULL, paintQueueFullStatic, tft);
+
   int startY = PADDING + 50;
-  
-  // FAIL TO JOIN (크기 3)
-  tft.setTextColor(COLOR_RED);
-  tft.setTextSize(3);
-  tft.setCursor(PADDING, startY);
-  tft.print("FAIL TO JOIN");
-  
-  // Queue is already full. (크기 2)
+
+  // 거절 사유 (크기 2)
   tft.setTextColor(invertColor(COLOR_USER_TEXT));
   tft.setTextSize(2);
   tft.setCursor(PADDING, startY + 30);
-  tft.print("Queue is Full.");
-  
-  // Please try again in a moment. (크기 1)
+  if (lastAdmission.result == ADMIT_CLOSING) tft.print("Closing Soon.");
+  else if (lastAdmission.result == ADMIT_WAIT_TOO_LONG) tft.print("Wait Too Long.");
+  else tft.print("Queue is Full.");
+
+  // 다음 발행 가능 시점 (크기 1)
   tft.setTextSize(1);
   tft.setCursor(PADDING, startY + 75);
-  tft.print("Please try again in a moment.");
-  
-  // Thank you. (크기 1)
-  tft.setCursor(PADDING, startY + 120);
-  tft.print("Thank you.");
-  
-  // 확인 버튼
-  int btnW = 100;
-  int btnH = 30;
-  int btnX = (SCREEN_WIDTH - btnW) / 2;
-  int btnY = SCREEN_HEIGHT - PADDING - btnH - 10;
-  tft.fillRect(btnX, btnY, btnW, btnH, invertColor(COLOR_ADMIN_TEXT));
-  tft.drawRect(btnX, btnY, btnW, btnH, invertColor(COLOR_USER_TEXT));
-  tft.setTextColor(invertColor(COLOR_WHITE));
-  tft.setTextSize(1);
-  tft.setCursor(btnX+25, btnY+10);
-  tft.print("Confirm");
+  if (lastAdmission.nextSlotSec < 0) {
+    tft.print("No more tickets today.");
+  } else {
+    tft.print("Next ticket in ");
+    printMinSec(tft, lastAdmission.nextSlotSec);
+
+    // 시계가 설정된 경우 시각도 표시
+    long slotSec = admissionPolicy.secondsOfDay(millis());
+    if (slotSec >= 0) {
+      slotSec = (slotSec + lastAdmission.nextSlotSec) % 86400L;
+      int hh = slotSec / 3600;
+      int mm = (slotSec / 60) % 60;
+      tft.print(" (");
+      if (hh < 10) tft.print("0");
+      tft.print(hh);
+      tft.print(":");
+      if (mm < 10) tft.print("0");
+      tft.print(mm);
+      tft.print(")");
+    }
+  }
 }
 
-void drawCallModal() {
-  // 기존 화면 위에 반투명처럼 표현
-  tft.fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, invertColor(COLOR_ADMIN_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
-  // X 버튼
-  tft.fillRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(COLOR_ADMIN_TEXT));
-  tft.drawRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextColor(invertColor(COLOR_WHITE));
-  tft.setTextSize(2);
-  tft.setCursor(SCREEN_WIDTH-PADDING-25, PADDING+10);
-  tft.print("X");
-  
+// 호출 창 (화면 위에 겹치는 모달 - 다음 번호를 보고 호출)
+#define CALL_BOX_X   30
+#define CALL_BOX_Y   80
+#define CALL_BOX_W   180
+#define CALL_BOX_H   170
+#define CALL_CLOSE_X (CALL_BOX_X + CALL_BOX_W - 30)
+#define CALL_CLOSE_Y (CALL_BOX_Y + 6)
+#define CALL_BTN_X   (CALL_BOX_X + 30)
+#define CALL_BTN_Y   (CALL_BOX_Y + 120)
+#define CALL_BTN_W   120
+#define CALL_BTN_H   36
+
+void paintCallModalBox(Adafruit_GFX& g) {
+  g.fillRect(CALL_BOX_X, CALL_BOX_Y, CALL_BOX_W, CALL_BOX_H, invertColor(COLOR_ADMIN_BTN));
+  g.drawRect(CALL_BOX_X, CALL_BOX_Y, CALL_BOX_W, CALL_BOX_H, invertColor(COLOR_ADMIN_TEXT));
+  g.drawRect(CALL_BOX_X+1, CALL_BOX_Y+1, CALL_BOX_W-2, CALL_BOX_H-2, invertColor(COLOR_ADMIN_TEXT));
+
   // Call 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING+60, PADDING+40);
-  tft.print("Call");
-  
-  // 입력 박스
-  int boxW = SCREEN_WIDTH - PADDING*2;
-  int boxH = 200;
-  tft.fillRect(PADDING, PADDING+80, boxW, boxH, invertColor(COLOR_WHITE));
-  tft.drawRect(PADDING, PADDING+80, boxW, boxH, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+  g.setCursor(CALL_BOX_X+10, CALL_BOX_Y+10);
+  g.print("Call");
+
+  // 닫기 (작은 X)
+  g.fillRect(CALL_CLOSE_X, CALL_CLOSE_Y, 24, 24, invertColor(COLOR_ADMIN_BG));
+  g.drawRect(CALL_CLOSE_X, CALL_CLOSE_Y, 24, 24, invertColor(COLOR_ADMIN_TEXT));
+  g.setCursor(CALL_CLOSE_X+7, CALL_CLOSE_Y+5);
+  g.print("X");
+
+  g.setTextSize(1);
+  g.setCursor(CALL_BOX_X+10, CALL_BOX_Y+40);
+  g.print("Next");
+
+  // 호출 버튼
+  g.fillRect(CALL_BTN_X, CALL_BTN_Y, CALL_BTN_W, CALL_BTN_H, invertColor(COLOR_GREEN));
+  g.drawRect(CALL_BTN_X, CALL_BTN_Y, CALL_BTN_W, CALL_BTN_H, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+  g.setCursor(CALL_BTN_X + (CALL_BTN_W - 48) / 2, CALL_BTN_Y + 11);
+  g.print("CALL");
 }
 
-void drawQueueList() {
-  tft.fillScreen(invertColor(COLOR_ADMIN_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
-  // X 버튼
-  tft.fillRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(COLOR_ADMIN_BG));
-  tft.drawRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(SCREEN_WIDTH-PADDING-25, PADDING+10);
-  tft.print("X");
-  
+// 레이어 캐시용 (누름 표시가 버튼 영역만 가져다 씀) - 창 밖은 한 색이라 RLE 가 작음
+void paintCallModalStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintCallModalBox(g);
+}
+
+void drawCallModal() {
+  paintCallModalBox(screenCanvas);
+  drawCallModalFields();
+}
+
+// 다음 번호와 남은 인원
+void drawCallModalFields() {
+  screenCanvas.fillRect(CALL_BOX_X+10, CALL_BOX_Y+52, CALL_BOX_W-20, 62, invertColor(COLOR_ADMIN_BTN));
+  screenCanvas.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  screenCanvas.setTextSize(4);
+  String numStr = queueCount > 0 ? String(queueList[0]) : String("---");
+  screenCanvas.setCursor(CALL_BOX_X + (CALL_BOX_W - numStr.length() * 24) / 2, CALL_BOX_Y+56);
+  screenCanvas.print(numStr);
+
+  screenCanvas.setTextSize(1);
+  screenCanvas.setCursor(CALL_BOX_X+10, CALL_BOX_Y+100);
+  screenCanvas.print(queueCount);
+  screenCanvas.print(" waiting");
+}
+
+// 목록 위 스크롤 버튼 (한 번에 한 줄)
+#define LIST_UP_X     150
+#define LIST_DOWN_X   190
+#define LIST_ARROW_Y  (PADDING+38)
+#define LIST_ARROW_W  30
+#define LIST_ARROW_H  24
+
+const char* QUEUE_LIST_LABEL = "Manage Queue";
+
+void paintQueueListStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintTitle(g, COLOR_ADMIN_TEXT);
+  paintCloseButton(g, COLOR_ADMIN_BG);
+
   // 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, PADDING+45);
-  tft.print("Manage Queue");
-  
-  // 대기열 버튼 (4x5 = 최대 20개)
-  int btnSize = 45;
-  int btnHeight = 30;  // 높이 줄이기 (70%)
-  int btnGap = 6;
-  int startX = PADDING + 5;
-  int startY = PADDING + 70;
-  int cols = 4;
-  
-  for (int i = 0; i < 20 && i < queueCount; i++) {
-    int row = i / cols;
-    int col = i % cols;
-    int x = startX + col * (btnSize + btnGap);
-    int y = startY + row * (btnHeight + btnGap);
-    
-    tft.fillRect(x, y, btnSize, btnHeight, invertColor(COLOR_ADMIN_BG));
-    tft.drawRect(x, y, btnSize, btnHeight, invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextSize(2);
-    
-    String numStr = String(queueList[i]);
-    int textX = x + (btnSize - numStr.length() * 12) / 2;
-    int textY = y + 8;
-    tft.setCursor(textX, textY);
-    tft.print(numStr);
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(1);
+  g.setCursor(PADDING, PADDING+45);
+  g.print(QUEUE_LIST_LABEL);
+
+  // 스크롤 버튼 (위 / 아래)
+  g.fillTriangle(LIST_UP_X + 15, LIST_ARROW_Y + 4, LIST_UP_X + 5, LIST_ARROW_Y + 20,
+                 LIST_UP_X + 25, LIST_ARROW_Y + 20, invertColor(COLOR_ADMIN_TEXT));
+  g.fillTriangle(LIST_DOWN_X + 15, LIST_ARROW_Y + 20, LIST_DOWN_X + 5, LIST_ARROW_Y + 4,
+                 LIST_DOWN_X + 25, LIST_ARROW_Y + 4, invertColor(COLOR_ADMIN_TEXT));
+}
+
+// 칸마다 마지막으로 그린 번호 - 다시 그리기 전에 대기열이 바뀌었는지 (제자리 삭제 확인용)
+int queueDrawnTicket[QUEUE_CAPACITY];
+
+// 대기열 버튼 하나 (콘텐츠 좌표)
+void paintQueueItem(Adafruit_GFX& g, int index, int16_t x, int16_t y, int16_t w, int16_t h) {
+  queueDrawnTicket[index] = queueList[index];
+  g.fillRect(x, y, w, h, invertColor(COLOR_ADMIN_BG));
+  g.drawRect(x, y, w, h, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+
+  String numStr = String(queueList[index]);
+  int textX = x + (w - numStr.length() * 12) / 2;
+  int textY = y + 8;
+  g.setCursor(textX, textY);
+  g.print(numStr);
+}
+
+void drawQueueList() {
+  // 정적 레이어는 스크롤 없는 좌표로 복원
+  queueView.hide(tft);
+  layerCache.draw(QUEUE_LIST, paintQueueListStatic, tft);
+
+  printQueueCount(tft);
+
+  // 대기열 버튼 (4열, 보이는 줄만) - 배경은 정적 레이어가 이미 칠함
+  queueView.show(tft, queueCount, paintQueueItem, true);
+}
+
+// 대기 인원 " (n)"
+void printQueueCount(Adafruit_GFX& g) {
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(1);
+  g.setCursor(LABEL_END_X(PADDING, QUEUE_LIST_LABEL), PADDING+45);
+  g.print(" (");
+  g.print(queueCount);
+  g.print(")");
+}
+
+// 지금 보이는 목록 화면 전체 (화면 좌표) - 모달이 가리는 영역 저장용
+void paintQueueListScreen(Adafruit_GFX& g) {
+  paintQueueListStatic(g);
+  printQueueCount(g);
+  queueView.paintVisible(g);
+}
+
+// 대기열이 바뀐 뒤 인원 수와 index 이후 항목이 있는 보이는 줄만 다시 그림
+void refreshQueueListFrom(int index) {
+  tft.fillRect(LABEL_END_X(PADDING, QUEUE_LIST_LABEL), PADDING+45, 48, 8, invertColor(COLOR_ADMIN_BG));
+  printQueueCount(tft);
+  queueView.refresh(tft, queueCount, index);
+}
+
+// 길게 누른 항목을 확인 화면 없이 바로 삭제하고 바뀐 줄만 다시 그림
+void deleteQueueItemInPlace(int index) {
+  if (index < 0 || index >= queueCount) return;
+  // 칸이 아직 옛 번호를 보여 주는 중이면 (자동 처리로 당겨진 뒤 다시 그리기 전) 지우지 않음
+  if (queueDrawnTicket[index] != queueList[index]) {
+    Serial.print("Long-press ignored: cell shows ");
+    Serial.print(queueDrawnTicket[index]);
+    Serial.print(", queue has ");
+    Serial.println(queueList[index]);
+    return;
   }
+  Serial.print("Long-press remove: ");
+  Serial.println(queueList[index]);
+
+  removeFromQueue(index, millis());
+  refreshQueueListFrom(index);
 }
 
-void drawQueueDeleteConfirm() {
-  tft.fillScreen(invertColor(COLOR_ADMIN_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
-  // X 버튼
-  tft.fillRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(COLOR_ADMIN_BG));
-  tft.drawRect(SCREEN_WIDTH-PADDING-32, PADDING, 32, 32, invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(SCREEN_WIDTH-PADDING-25, PADDING+10);
-  tft.print("X");
-  
+// 삭제 확인 창 (목록 위에 겹치는 모달, YES/NO 위치는 기존과 같음)
+#define CONFIRM_BOX_X 30
+#define CONFIRM_BOX_Y 115
+#define CONFIRM_BOX_W 180
+#define CONFIRM_BOX_H 170
+
+void paintQueueDeleteConfirmBox(Adafruit_GFX& g) {
+  g.fillRect(CONFIRM_BOX_X, CONFIRM_BOX_Y, CONFIRM_BOX_W, CONFIRM_BOX_H, invertColor(COLOR_ADMIN_BTN));
+  g.drawRect(CONFIRM_BOX_X, CONFIRM_BOX_Y, CONFIRM_BOX_W, CONFIRM_BOX_H, invertColor(COLOR_ADMIN_TEXT));
+  g.drawRect(CONFIRM_BOX_X+1, CONFIRM_BOX_Y+1, CONFIRM_BOX_W-2, CONFIRM_BOX_H-2, invertColor(COLOR_ADMIN_TEXT));
+
   // 삭제 메시지
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(1);
-  tft.setCursor(PADDING+20, PADDING+80);
-  tft.print("Remove this element?");
-  
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(1);
+  g.setCursor(CONFIRM_BOX_X+30, CONFIRM_BOX_Y+10);
+  g.print("Remove this element?");
+
+  // YES 버튼
+  g.fillRect(50, 230, 60, 40, invertColor(COLOR_GREEN));
+  g.drawRect(50, 230, 60, 40, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+  g.setCursor(58, 242);
+  g.print("YES");
+
+  // NO 버튼
+  g.fillRect(130, 230, 60, 40, invertColor(COLOR_ADMIN_BG));
+  g.drawRect(130, 230, 60, 40, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+  g.setCursor(145, 242);
+  g.print("NO");
+}
+
+// 레이어 캐시용 (누름 표시가 버튼 영역만 가져다 씀)
+void paintQueueDeleteConfirmStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintQueueDeleteConfirmBox(g);
+}
+
+void drawQueueDeleteConfirm() {
+  paintQueueDeleteConfirmBox(screenCanvas);
+
   // 선택된 번호 표시
   if (selectedQueueIndex >= 0 && selectedQueueIndex < queueCount) {
     int ticketNum = queueList[selectedQueueIndex];
-    tft.fillRect(85, 140, 70, 70, invertColor(COLOR_ADMIN_BG));
-    tft.drawRect(85, 140, 70, 70, invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextSize(3);
-    
+    screenCanvas.fillRect(85, 140, 70, 70, invertColor(COLOR_ADMIN_BG));
+    screenCanvas.drawRect(85, 140, 70, 70, invertColor(COLOR_ADMIN_TEXT));
+    screenCanvas.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+    screenCanvas.setTextSize(3);
+
     String numStr = String(ticketNum);
     int textX = 85 + (70 - numStr.length() * 18) / 2;
-    tft.setCursor(textX, 165);
-    tft.print(numStr);
+    screenCanvas.setCursor(textX, 165);
+    screenCanvas.print(numStr);
   }
-  
-  // YES 버튼
-  tft.fillRect(50, 230, 60, 40, invertColor(COLOR_GREEN));
-  tft.drawRect(50, 230, 60, 40, invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(58, 242);
-  tft.print("YES");
-  
-  // NO 버튼
-  tft.fillRect(130, 230, 60, 40, invertColor(COLOR_ADMIN_BG));
-  tft.drawRect(130, 230, 60, 40, invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(145, 242);
-  tft.print("NO");
 }
 
-void drawTimeSetting() {
-  tft.fillScreen(invertColor(COLOR_ADMIN_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
+void paintTimeSettingStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintTitle(g, COLOR_ADMIN_TEXT);
+
   // 라벨 - 25px 높게, 한 줄에 표시
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, PADDING+45);
-  tft.print("user process time duration");
-  
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(1);
+  g.setCursor(PADDING, PADDING+45);
+  g.print("user process time duration");
+
   // 증가 삼각형
-  tft.fillTriangle(90, 110, 120, 80, 150, 110, invertColor(COLOR_ADMIN_BG));
-  tft.drawTriangle(90, 110, 120, 80, 150, 110, invertColor(COLOR_ADMIN_TEXT));
-  
+  g.fillTriangle(90, 110, 120, 80, 150, 110, invertColor(COLOR_ADMIN_BG));
+  g.drawTriangle(90, 110, 120, 80, 150, 110, invertColor(COLOR_ADMIN_TEXT));
+
   // 숫자 박스
-  tft.fillRect(70, 115, 100, 70, invertColor(COLOR_ADMIN_BG));
-  tft.drawRect(70, 115, 100, 70, invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(4);
-  tft.setCursor(85, 135);
-  tft.print(userProcessTimeSec);
-  
-  tft.setTextSize(1);
-  tft.setCursor(145, 160);
-  tft.print("sec");
-  
+  g.fillRect(70, 115, 100, 70, invertColor(COLOR_ADMIN_BG));
+  g.drawRect(70, 115, 100, 70, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(1);
+  g.setCursor(145, 160);
+  g.print("sec");
+
   // 감소 삼각형
-  tft.fillTriangle(90, 195, 120, 225, 150, 195, invertColor(COLOR_ADMIN_BG));
-  tft.drawTriangle(90, 195, 120, 225, 150, 195, invertColor(COLOR_ADMIN_TEXT));
-  
+  g.fillTriangle(90, 195, 120, 225, 150, 195, invertColor(COLOR_ADMIN_BG));
+  g.drawTriangle(90, 195, 120, 225, 150, 195, invertColor(COLOR_ADMIN_TEXT));
+
   // YES 버튼 - 관리자 버튼 색상
-  tft.fillRect(90, 240, 60, 40, invertColor(COLOR_ADMIN_BTN));
-  tft.drawRect(90, 240, 60, 40, invertColor(COLOR_ADMIN_TEXT));
+  g.fillRect(90, 240, 60, 40, invertColor(COLOR_ADMIN_BTN));
+  g.drawRect(90, 240, 60, 40, invertColor(COLOR_ADMIN_TEXT));
+  g.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  g.setTextSize(2);
+  g.setCursor(98, 252);
+  g.print("OK");
+}
+
+void drawTimeSetting() {
+  layerCache.draw(TIME_SETTING, paintTimeSettingStatic, tft);
+
+  // 숫자 (라벨 "sec" 와 같은 색이라 겹쳐도 결과 동일)
   tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(98, 252);
-  tft.print("OK");
+  tft.setTextSize(4);
+  tft.setCursor(85, 135);
+  tft.print(userProcessTimeSec);
 }
 
-void drawPasswordChange() {
-  tft.fillScreen(invertColor(COLOR_ADMIN_BG));
-  
-  // 상단 제목
-  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-  tft.setTextSize(2);
-  tft.setCursor(PADDING, PADDING);
-  tft.print("Embedded QMS");
-  
+void paintPasswordChangeStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintTitle(g, COLOR_ADMIN_TEXT);
+
   // 서브 타이틀
-  tft.setTextSize(1);
-  tft.setCursor(PADDING, PADDING+25);
-  tft.print("Change Password");
-  
+  g.setTextSize(1);
+  g.setCursor(PADDING, PADDING+25);
+  g.print("Change Password");
+
   // 입력 비밀번호 표시 박스
-  tft.fillRect(PADDING+10, PADDING+50, 160, 35, invertColor(COLOR_ADMIN_TEXT));
+  g.fillRect(PADDING+10, PADDING+50, 160, 35, invertColor(COLOR_ADMIN_TEXT));
+
+  paintHexKeypad(g, COLOR_ADMIN_BG);
+}
+
+void drawPasswordChange() {
+  layerCache.draw(PASSWORD_CHANGE, paintPasswordChangeStatic, tft);
+
   tft.setTextColor(invertColor(COLOR_GREEN));
   tft.setTextSize(3);
   tft.setCursor(PADDING+20, PADDING+57);
   tft.print(newPassword);
+}
+
+// 차트 막대 높이 미리 계산 (그릴 때는 열마다 fillRect 한 번)
+void prepareChartColumns() {
+  chartColumnCount = throughputSeries.buildColumns(chartResolution, chartMetric, chartHeights, chartMarkers,
+                                                   CHART_W, CHART_H, chartPeak);
+}
+
+void paintStatsChartStatic(Adafruit_GFX& g) {
+  g.fillScreen(invertColor(COLOR_ADMIN_BG));
+  paintTitle(g, COLOR_ADMIN_TEXT);
+  paintCloseButton(g, COLOR_ADMIN_BG);
+
+  // 제목
+  g.setTextSize(1);
+  g.setCursor(PADDING, PADDING+45);
+  g.print("Statistics");
+
+  // 차트 기준선
+  g.drawFastHLine(CHART_X, CHART_Y + CHART_H, CHART_W, invertColor(COLOR_ADMIN_TEXT));
+}
+
+void drawStatsChart() {
+  layerCache.draw(STATS_CHART, paintStatsChartStatic, tft);
+
+  // 해상도 탭
+  const char* tabs[3] = {"1H", "1W", "1Y"};
+  tft.setTextSize(1);
+  for (int i = 0; i < 3; i++) {
+    int x = PADDING + i * 65;
+    uint16_t bg = (i == chartResolution) ? COLOR_ADMIN_TEXT : COLOR_ADMIN_BTN;
+    uint16_t fg = (i == chartResolution) ? COLOR_ADMIN_BTN : COLOR_ADMIN_TEXT;
+    tft.fillRect(x, PADDING+60, 60, 24, invertColor(bg));
+    tft.drawRect(x, PADDING+60, 60, 24, invertColor(COLOR_ADMIN_TEXT));
+    tft.setTextColor(invertColor(fg));
+    tft.setCursor(x + 24, PADDING+68);
+    tft.print(tabs[i]);
+  }
+
+  // 지표 전환 버튼
+  const char* metrics[4] = {"Served", "Issued", "Queue Length", "Wait (bar) / Estimate (line)"};
+  tft.fillRect(PADDING, PADDING+90, SCREEN_WIDTH-PADDING*2, 24, invertColor(COLOR_ADMIN_BTN));
+  tft.drawRect(PADDING, PADDING+90, SCREEN_WIDTH-PADDING*2, 24, invertColor(COLOR_ADMIN_TEXT));
+  tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
+  tft.setCursor(PADDING+6, PADDING+98);
+  tft.print(metrics[chartMetric]);
+
+  // 차트 영역
+  if (chartColumnCount == 0) {
+    tft.setCursor(CHART_X + 70, CHART_Y + CHART_H/2);
+    tft.print("No data yet");
+    return;
+  }
+
+  int colW = CHART_W / chartColumnCount;
+  if (colW < 1) colW = 1;
+  int barW = (colW > 2) ? colW - 1 : colW;
+  for (int i = 0; i < chartColumnCount; i++) {
+    int x = CHART_X + i * colW;
+    if (chartHeights[i] > 0) {
+      tft.fillRect(x, CHART_Y + CHART_H - chartHeights[i], barW, chartHeights[i], invertColor(COLOR_ADMIN_TEXT));
+    }
+    if (chartMetric == METRIC_WAIT && chartMarkers[i] > 0) {
+      tft.drawFastHLine(x, CHART_Y + CHART_H - chartMarkers[i], colW, COLOR_BLUE);
+    }
+  }
   
-  // 16진수 키패드 (4x4)
-  const char* keys[16] = {"1", "2", "3", "4", "5", "6", "7", "8", 
-                          "9", "0", "A", "B", "C", "D", "E", "F"};
-  
+  // 스케일 표시
+  tft.setCursor(CHART_X, CHART_Y + CHART_H + 5);
+  tft.print("max ");
+  tft.print(chartPeak);
+  if (chartMetric == METRIC_WAIT) tft.print(" sec");
+}
+
+// ===== 누름 피드백 =====
+// 누름 확정(안정화)을 기다리지 않고 펜이 닿은 샘플에서 바로 버튼을 반전해서 보여 줌
+// 정적 레이어에서 버튼 영역만 다시 보내므로 비용은 버튼 픽셀만큼
+
+struct PressWidget {
+  uint8_t screen;
+  int16_t x, y, w, h;  // 터치 판정과 같은 사각형 (판정은 경계 포함)
+};
+
+#define CLOSE_WIDGET(screen) {screen, SCREEN_WIDTH-PADDING-32, PADDING, 32, 32}
+
+const PressWidget pressWidgets[] = {
+  CLOSE_WIDGET(USER_MODE),  // 관리자 아이콘
+  {USER_MODE, PADDING, SCREEN_HEIGHT-PADDING-100, SCREEN_WIDTH-PADDING*2, 70},  // Join Queue
+  CLOSE_WIDGET(ADMIN_MODE),  // 사용자 모드 아이콘
+  {ADMIN_MODE, ADMIN_CALL_X, ADMIN_CALL_Y, ADMIN_CALL_W, ADMIN_CALL_H},  // 호출 창
+  {ADMIN_MODE, PADDING, PADDING+70, SCREEN_WIDTH-PADDING*2, 40},
+  {ADMIN_MODE, PADDING, PADDING+122, SCREEN_WIDTH-PADDING*2, 40},
+  {ADMIN_MODE, PADDING, PADDING+174, SCREEN_WIDTH-PADDING*2, 40},
+  {ADMIN_MODE, PADDING, PADDING+226, SCREEN_WIDTH-PADDING*2, 40},
+  {TICKET_ISSUED, (SCREEN_WIDTH-100)/2, SCREEN_HEIGHT-PADDING-40, 100, 30},
+  {QUEUE_FULL, (SCREEN_WIDTH-100)/2, SCREEN_HEIGHT-PADDING-40, 100, 30},
+  {CALL_MODAL, CALL_CLOSE_X, CALL_CLOSE_Y, 24, 24},
+  {CALL_MODAL, CALL_BTN_X, CALL_BTN_Y, CALL_BTN_W, CALL_BTN_H},
+  CLOSE_WIDGET(QUEUE_LIST),
+  {QUEUE_LIST, LIST_UP_X, LIST_ARROW_Y, LIST_ARROW_W, LIST_ARROW_H},
+  {QUEUE_LIST, LIST_DOWN_X, LIST_ARROW_Y, LIST_ARROW_W, LIST_ARROW_H},
+  {QUEUE_DELETE_CONFIRM, 50, 230, 60, 40},   // YES
+  {QUEUE_DELETE_CONFIRM, 130, 230, 60, 40},  // NO
+  {TIME_SETTING, 90, 80, 60, 30},    // 증가
+  {TIME_SETTING, 90, 195, 60, 30},   // 감소
+  {TIME_SETTING, 90, 240, 60, 40},   // OK
+  CLOSE_WIDGET(STATS_CHART)
+};
+const int PRESS_WIDGET_COUNT = sizeof(pressWidgets) / sizeof(pressWidgets[0]);
+
+// 정적 레이어 painter (ScreenState 순서)
+const LayerPainter staticLayers[] = {
+  paintUserModeStatic, paintAdminLoginStatic, paintAdminModeStatic, paintTicketIssuedStatic,
+  paintQueueFullStatic, paintCallModalStatic, paintQueueListStatic, paintQueueDeleteConfirmStatic,
+  paintTimeSettingStatic, paintPasswordChangeStatic, paintStatsChartStatic
+};
+
+// ===== 모달 =====
+
+// 화면 다시 그리기 (ScreenState 순서) - 모달 아래 영역을 저장하지 못했을 때 아래 화면 전체를 다시 그림
+void (* const screenDrawers[])() = {
+  drawUserMode, drawAdminLogin, drawAdminMode, drawTicketIssued, drawQueueFull, drawCallModal,
+  drawQueueList, drawQueueDeleteConfirm, drawTimeSetting, drawPasswordChange, drawStatsChart
+};
+
+// 모달 아래에 올 수 있는 화면 전체(정적 + 동적)를 화면 좌표로 그리는 painter (ScreenState 순서)
+// nullptr 인 화면은 저장하지 않고 닫을 때 다시 그림 (동적 필드를 tft 에 직접 그리는 화면)
+const LayerPainter modalUnderlays[] = {
+  nullptr, nullptr, paintAdminModeStatic, nullptr, nullptr, nullptr,
+  paintQueueListScreen, nullptr, nullptr, nullptr, nullptr
+};
+
+struct ModalBox {
+  ScreenState screen;
+  int16_t x, y, w, h;
+};
+
+const ModalBox modalBoxes[] = {
+  {CALL_MODAL, CALL_BOX_X, CALL_BOX_Y, CALL_BOX_W, CALL_BOX_H},
+  {QUEUE_DELETE_CONFIRM, CONFIRM_BOX_X, CONFIRM_BOX_Y, CONFIRM_BOX_W, CONFIRM_BOX_H}
+};
+
+// 지금 화면 위에 모달을 엶 (가려지는 영역을 저장)
+void openModal(ScreenState screen) {
+  if (modal.active()) return;
+  for (const ModalBox& box : modalBoxes) {
+    if (box.screen != screen) continue;
+    modalParent = currentScreen;
+    modalListChangedFrom = -1;
+    listFlingVelocity = 0;
+    if (!modal.open(tft, box.x, box.y, box.w, box.h, modalUnderlays[modalParent])) {
+      Serial.println("Modal: region not saved, parent will be redrawn");
+    }
+    currentScreen = screen;
+    screenDrawers[screen]();
+    return;
+  }
+}
+
+// 모달을 닫고 저장해 둔 영역만 복원 (저장하지 못했으면 아래 화면 전체를 다시 그림)
+void closeModal() {
+  currentScreen = modalParent;
+  if (!modal.close()) {
+    screenDrawers[modalParent]();
+    return;
+  }
+  // 열린 동안 대기열이 바뀌었으면 목록은 바뀐 줄만 다시 그림
+  if (modalParent == QUEUE_LIST && modalListChangedFrom >= 0) refreshQueueListFrom(modalListChangedFrom);
+}
+
+// 모달이 열린 동안 대기열 index 이후가 바뀜
+void noteQueueChangedUnderModal(int index) {
+  if (!modal.active()) return;
+  if (modalListChangedFrom < 0 || index < modalListChangedFrom) modalListChangedFrom = index;
+}
+
+PressWidget pressedWidget;
+bool pressShown = false;   // 누름 표시할 버튼이 있음
+bool pressDrawn = false;   // 패널에 실제로 누름 모습이 그려져 있음
+
+bool findPressWidget(uint8_t screen, int x, int y, PressWidget& out) {
+  for (int i = 0; i < PRESS_WIDGET_COUNT; i++) {
+    const PressWidget& w = pressWidgets[i];
+    if (w.screen == screen && x >= w.x && x <= w.x + w.w && y >= w.y && y <= w.y + w.h) {
+      out = w;
+      return true;
+    }
+  }
+
+  // 16진수 키패드 화면: paintHexKeypad 배치 (4x4 + 우측 기능 버튼 4개)
+  if (screen != ADMIN_LOGIN && screen != PASSWORD_CHANGE) return false;
   int keySize = 38;
   int keyGap = 4;
-  int startX = PADDING;
   int startY = PADDING + 105;
-  
-  for (int i = 0; i < 16; i++) {
-    int row = i / 4;
-    int col = i % 4;
-    int x = startX + col * (keySize + keyGap);
-    int y = startY + row * (keySize + keyGap);
-    
-    tft.fillRect(x, y, keySize, keySize, invertColor(COLOR_ADMIN_BG));
-    tft.drawRect(x, y, keySize, keySize, invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextSize(2);
-    
-    tft.setCursor(x + 12, y + 12);
-    tft.print(keys[i]);
-  }
-  
-  // 기능 버튼 (BACK, CLEAR, DEL, ENTER)
   int funcX = SCREEN_WIDTH - PADDING - 30;
-  for (int i = 0; i < 4; i++) {
-    int y = startY + i * (keySize + keyGap);
-    tft.fillRect(funcX, y, 30, keySize, invertColor(COLOR_ADMIN_BG));
-    tft.drawRect(funcX, y, 30, keySize, invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextColor(invertColor(COLOR_ADMIN_TEXT));
-    tft.setTextSize(1);
-    
-    tft.setCursor(funcX + 2, y + 16);
-    if (i == 0) tft.print("BCK");
-    else if (i == 1) tft.print("CLR");
-    else if (i == 2) tft.print("DEL");
-    else tft.print("ENT");
+  for (int row = 0; row < 4; row++) {
+    int keyY = startY + row * (keySize + keyGap);
+    if (y < keyY || y > keyY + keySize) continue;
+    for (int col = 0; col < 4; col++) {
+      int keyX = PADDING + col * (keySize + keyGap);
+      if (x >= keyX && x <= keyX + keySize) {
+        out = {screen, (int16_t)keyX, (int16_t)keyY, (int16_t)keySize, (int16_t)keySize};
+        return true;
+      }
+    }
+    if (x >= funcX && x <= funcX + 30) {
+      out = {screen, (int16_t)funcX, (int16_t)keyY, 30, (int16_t)keySize};
+      return true;
+    }
+  }
+  return false;
+}
+
+bool sameWidget(const PressWidget& a, const PressWidget& b) {
+  return a.screen == b.screen && a.x == b.x && a.y == b.y;
+}
+
+void drawPressState(const PressWidget& w, bool pressed) {
+  layerCache.drawRegion(w.screen, staticLayers[w.screen], tft, w.x, w.y, w.w, w.h, pressed);
+}
+
+// 누름 대상 갱신 - 바뀐 경우에만 버튼 영역을 다시 보냄
+void setPressed(bool hit, const PressWidget& target) {
+  if (pressShown && (!hit || !sameWidget(target, pressedWidget))) {
+    if (pressDrawn) drawPressState(pressedWidget, false);
+    pressShown = pressDrawn = false;
+  }
+  if (hit && !pressShown) {
+    pressedWidget = target;
+    pressShown = true;
+  }
+  if (pressShown && !pressDrawn) {
+    drawPressState(pressedWidget, true);
+    pressDrawn = true;
+  }
+}
+
+// 매 샘플 호출 - 펜이 닿으면 바로 누름 표시, 확정 전에 떼거나 벗어나면 되돌림
+// 확정 후에는 처음 누른 버튼만 유지하고 뗄 때 되돌림
+void updatePressFeedback(bool down, int x, int y) {
+  // 확정된 누름이 다른 화면을 그렸으면 되돌릴 것이 없음
+  if (pressShown && pressedWidget.screen != currentScreen) pressShown = pressDrawn = false;
+  // 화면을 띠 단위로 보내는 중이면 직접 전송은 미룸 (매 샘플 호출되므로 다 보낸 뒤 따라잡음)
+  if (tft.framePending()) return;
+
+  PressWidget target;
+  bool hit = down && findPressWidget(currentScreen, x, y, target);
+  if (gestures.pressed()) {
+    if (!down) {
+      // 뗌 판정 전 (압력 튐) - 유지
+      hit = pressShown;
+      target = pressedWidget;
+    } else {
+      hit = hit && pressShown && sameWidget(target, pressedWidget);
+    }
+  }
+  setPressed(hit, target);
+}
+
+// 확정된 누름 처리가 같은 화면을 다시 그렸을 수 있으므로 다음 갱신 때 누름 모습을 다시 그림
+void holdPressFeedback() {
+  if (pressShown) pressDrawn = false;
+}
+
+// ===== 다음 화면 선행 래스터화 =====
+
+#define PRERENDER_CANDIDATES 2  // 현재 화면에서 가장 자주 가는 화면 몇 개까지 미리 준비할지
+
+// 처음 쓰는 기기에서도 바로 효과가 있도록 넣어 두는 기본 전환 빈도
+struct TransitionPrior {
+  uint8_t from, to;
+  uint16_t weight;
+};
+
+const TransitionPrior transitionPriors[] = {
+  {USER_MODE, TICKET_ISSUED, 8},
+  {USER_MODE, ADMIN_LOGIN, 2},
+  {USER_MODE, QUEUE_FULL, 1},
+  {TICKET_ISSUED, USER_MODE, 8},
+  {QUEUE_FULL, USER_MODE, 8},
+  {ADMIN_LOGIN, ADMIN_MODE, 4},
+  {ADMIN_MODE, QUEUE_LIST, 2},
+  {ADMIN_MODE, USER_MODE, 2},
+  {QUEUE_LIST, ADMIN_MODE, 2},
+  {QUEUE_LIST, QUEUE_DELETE_CONFIRM, 1}
+};
+
+void seedScreenPredictor() {
+  for (const TransitionPrior& p : transitionPriors) {
+    screenPredictor.record(p.from, p.to, p.weight);
+  }
+}
+
+ScreenState lastSeenScreen = USER_MODE;
+
+void trackScreenTransition() {
+  if (currentScreen == lastSeenScreen) return;
+  screenPredictor.record(lastSeenScreen, currentScreen);
+  lastSeenScreen = currentScreen;
+}
+
+// 유휴 loop 1회당 한 띠 (LAYER_STRIP_LINES 줄) - 터치가 오면 다음 loop 에서 바로 멈춤
+// 다른 화면 레이어를 버리지 않고 캐시에 남은 RAM 안에서만 준비
+void prerenderIdleStep() {
+  uint8_t next[PRERENDER_CANDIDATES];
+  int n = screenPredictor.likely(currentScreen, next, PRERENDER_CANDIDATES);
+  for (int i = 0; i < n; i++) {
+    if (!layerCache.prefetchable(next[i])) continue;
+    layerCache.prefetch(next[i], staticLayers[next[i]], SCREEN_WIDTH, SCREEN_HEIGHT);
+    return;
   }
 }
 
 // ===== 터치 처리 =====
 
 void handleTouch(int x, int y) {
+  QMS_PROFILE_FUNCTION();
   
   switch (currentScreen) {
     case USER_MODE:
@@ -798,8 +1590,11 @@ void handleTouch(int x, int y) {
       }
       // 대기표 발행 버튼
       else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= SCREEN_HEIGHT-PADDING-100 && y <= SCREEN_HEIGHT-PADDING-30) {
-        if (queueCount >= 20) {
-          // 대기열 꾽 차서 예약 불가
+        // 발행 시점의 대기시간 계산 및 수용 판단
+        lastAdmission = admissionPolicy.evaluate(millis(), queueCount, remainingForCurrentSec(millis()), userProcessTimeSec);
+        
+        if (lastAdmission.result != ADMIT_OK) {
+          // 대기열 꽉 참 / 대기시간 초과 / 마감 → 발행 불가
           ticketIssueTime = millis();
           currentScreen = QUEUE_FULL;
           drawQueueFull();
@@ -807,19 +1602,15 @@ void handleTouch(int x, int y) {
           // 정상 발행
           currentTicket++;
           issuedTicket = currentTicket;
+          issuedTicketWaitTime = lastAdmission.predictedWaitSec;
+          throughputSeries.recordIssue(issuedTicketWaitTime);
           
-          // 티켓 발행 시점의 대기시간 계산 및 저장
-          unsigned long elapsedSinceLastProcess = (millis() - lastProcessTime) / 1000;
-          int remainingForCurrent = userProcessTimeSec - elapsedSinceLastProcess;
-          if (remainingForCurrent < 0) remainingForCurrent = 0;
-          int totalRemainingSec = (queueCount > 0) ? (remainingForCurrent + queueCount * userProcessTimeSec) : 0;
-          issuedTicketWaitTime = totalRemainingSec;
-          
-          addToQueue(currentTicket);  // 대기열에 번호 추가
+          addToQueue(currentTicket, millis());  // 대기열에 번호 추가
           callWaitPosition = queueCount;
           ticketIssueTime = millis();
           currentScreen = TICKET_ISSUED;
           drawTicketIssued();
+          slideInScreen(true);
         }
       }
       break;
@@ -834,22 +1625,32 @@ void handleTouch(int x, int y) {
         currentScreen = USER_MODE;
         drawUserMode();
       }
+      // 호출 창 (관리자 화면 위에 겹쳐 엶)
+      else if (x >= ADMIN_CALL_X && x <= ADMIN_CALL_X + ADMIN_CALL_W && y >= ADMIN_CALL_Y && y <= ADMIN_CALL_Y + ADMIN_CALL_H) {
+        openModal(CALL_MODAL);
+      }
       // 대기열 보기
-      else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= PADDING+70 && y <= PADDING+120) {
+      else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= PADDING+70 && y <= PADDING+110) {
         currentScreen = QUEUE_LIST;
         drawQueueList();
       }
       // 시간 설정
-      else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= PADDING+140 && y <= PADDING+190) {
+      else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= PADDING+122 && y <= PADDING+162) {
         currentScreen = TIME_SETTING;
         drawTimeSetting();
       }
       // 비밀번호 변경
-      else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= PADDING+210 && y <= PADDING+260) {
+      else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= PADDING+174 && y <= PADDING+214) {
         currentScreen = PASSWORD_CHANGE;
         newPassword = "";
         drawPasswordChange();
       }
+      // 통계 차트
+      else if (x >= PADDING && x <= SCREEN_WIDTH-PADDING && y >= PADDING+226 && y <= PADDING+266) {
+        currentScreen = STATS_CHART;
+        prepareChartColumns();
+        drawStatsChart();
+      }
       break;
       
     case TICKET_ISSUED:
@@ -857,6 +1658,7 @@ void handleTouch(int x, int y) {
       if (x >= (SCREEN_WIDTH-100)/2 && x <= (SCREEN_WIDTH+100)/2 && y >= SCREEN_HEIGHT-PADDING-40 && y <= SCREEN_HEIGHT-PADDING-10) {
         currentScreen = USER_MODE;
         drawUserMode();
+        slideInScreen(false);
       }
       break;
       
@@ -871,51 +1673,42 @@ void handleTouch(int x, int y) {
     case QUEUE_LIST:
       // X 버튼
       if (x >= SCREEN_WIDTH-PADDING-32 && x <= SCREEN_WIDTH-PADDING && y >= PADDING && y <= PADDING+32) {
+        queueView.hide(tft);
         currentScreen = ADMIN_MODE;
         drawAdminMode();
       }
+      // 스크롤 버튼 (한 줄씩, 새로 보이는 줄만 그림)
+      else if (y >= LIST_ARROW_Y && y <= LIST_ARROW_Y + LIST_ARROW_H && x >= LIST_UP_X && x <= LIST_UP_X + LIST_ARROW_W) {
+        queueView.scrollBy(tft, -queueView.rowPitch());
+      }
+      else if (y >= LIST_ARROW_Y && y <= LIST_ARROW_Y + LIST_ARROW_H && x >= LIST_DOWN_X && x <= LIST_DOWN_X + LIST_ARROW_W) {
+        queueView.scrollBy(tft, queueView.rowPitch());
+      }
       // 번호 클릭
       else {
-        int btnSize = 45;
-        int btnHeight = 30;
-        int btnGap = 6;
-        int startX = PADDING + 5;
-        int startY = PADDING + 70;
-        int cols = 4;
-        
-        for (int i = 0; i < 20 && i < queueCount; i++) {
-          int row = i / cols;
-          int col = i % cols;
-          int btnX = startX + col * (btnSize + btnGap);
-          int btnY = startY + row * (btnHeight + btnGap);
-          
-          if (x >= btnX && x <= btnX + btnSize && y >= btnY && y <= btnY + btnHeight) {
-            selectedQueueIndex = i;
-            currentScreen = QUEUE_DELETE_CONFIRM;
-            drawQueueDeleteConfirm();
-            break;
-          }
+        int index = queueView.itemAt(x, y);
+        if (index >= 0) {
+          // 목록은 그대로 두고 확인 창만 겹쳐 그림
+          selectedQueueIndex = index;
+          openModal(QUEUE_DELETE_CONFIRM);
         }
       }
       break;
       
     case QUEUE_DELETE_CONFIRM:
-      // X 버튼
-      if (x >= SCREEN_WIDTH-PADDING-32 && x <= SCREEN_WIDTH-PADDING && y >= PADDING && y <= PADDING+32) {
-        currentScreen = QUEUE_LIST;
-        drawQueueList();
-      }
-      // YES
-      else if (x >= 50 && x <= 110 && y >= 230 && y <= 270) {
-        removeFromQueue(selectedQueueIndex);
+      // YES - 확인 창 자리를 복원하고 삭제된 항목부터 다시 그림
+      if (x >= 50 && x <= 110 && y >= 230 && y <= 270) {
+        if (selectedQueueIndex >= 0 && selectedQueueIndex < queueCount) {
+          removeFromQueue(selectedQueueIndex, millis());
+          noteQueueChangedUnderModal(selectedQueueIndex);
+        }
         selectedQueueIndex = -1;
-        currentScreen = QUEUE_LIST;
-        drawQueueList();
+        closeModal();
       }
-      // NO
-      else if (x >= 130 && x <= 190 && y >= 230 && y <= 270) {
-        currentScreen = QUEUE_LIST;
-        drawQueueList();
+      // NO 또는 창 밖
+      else if ((x >= 130 && x <= 190 && y >= 230 && y <= 270) || !modal.contains(x, y)) {
+        selectedQueueIndex = -1;
+        closeModal();
       }
       break;
       
@@ -948,11 +1741,41 @@ void handleTouch(int x, int y) {
       break;
       
     case CALL_MODAL:
+      // 호출 - 맨 앞 번호를 처리하고 창 안의 번호만 갱신
+      if (x >= CALL_BTN_X && x <= CALL_BTN_X + CALL_BTN_W && y >= CALL_BTN_Y && y <= CALL_BTN_Y + CALL_BTN_H) {
+        if (queueCount > 0) {
+          processQueueHead(true);
+          lastProcessTime = millis();
+        }
+        drawCallModalFields();
+      }
+      // X 또는 창 밖
+      else if ((x >= CALL_CLOSE_X && x <= CALL_CLOSE_X + 24 && y >= CALL_CLOSE_Y && y <= CALL_CLOSE_Y + 24) ||
+               !modal.contains(x, y)) {
+        closeModal();
+      }
+      break;
+      
+    case STATS_CHART:
       // X 버튼
       if (x >= SCREEN_WIDTH-PADDING-32 && x <= SCREEN_WIDTH-PADDING && y >= PADDING && y <= PADDING+32) {
         currentScreen = ADMIN_MODE;
         drawAdminMode();
       }
+      // 해상도 탭 (1H / 1W / 1Y)
+      else if (y >= PADDING+60 && y <= PADDING+84 && x >= PADDING && x <= PADDING+190) {
+        int tab = (x - PADDING) / 65;
+        if (tab > 2) tab = 2;
+        chartResolution = (SeriesResolution)tab;
+        prepareChartColumns();
+        drawStatsChart();
+      }
+      // 지표 전환 버튼
+      else if (y >= PADDING+90 && y <= PADDING+114 && x >= PADDING && x <= SCREEN_WIDTH-PADDING) {
+        chartMetric = (SeriesMetric)((chartMetric + 1) % 4);
+        prepareChartColumns();
+        drawStatsChart();
+      }
       break;
   }
 }
@@ -1038,25 +1861,27 @@ void handleAdminLoginTouch(int x, int y) {
 
 // ===== 대기열 관리 =====
 
-void addToQueue(int ticketNum) {
-  if (queueCount < 20) {
-    queueList[queueCount] = ticketNum;
-    queueCount++;
-    waitingCount = queueCount;
-    waitingTimeSec = queueCount * userProcessTimeSec;
-  }
-}
-
-void removeFromQueue(int index) {
-  if (index >= 0 && index < queueCount) {
-    // 배열에서 요소 삭제 (뒤 요소들을 당겨옴)
-    for (int i = index; i < queueCount - 1; i++) {
-      queueList[i] = queueList[i + 1];
-    }
-    queueCount--;
-    waitingCount = queueCount;
-    waitingTimeSec = queueCount * userProcessTimeSec;
-  }
+// 맨 앞 티켓 처리 완료 + 통계 기록 (log = false 면 시리얼 출력 없이 - 바이너리 명령의 대량 처리)
+void processQueueHead(bool log) {
+  int ticketNum = queueList[0];
+  int actualWaitSec = serveQueueHead(millis());
+  if (actualWaitSec < 0) return;
+  noteQueueChangedUnderModal(0);
+  
+  throughputSeries.recordServe(actualWaitSec);
+  statusFeed.noteServed(ticketNum);
+  if (!log) return;
+  Serial.print("Served #");
+  Serial.print(ticketNum);
+  Serial.print(" | wait p50/p90: ");
+  Serial.print(ticketLog.waitSecP50(), 1);
+  Serial.print("/");
+  Serial.print(ticketLog.waitSecP90(), 1);
+  Serial.print("s, service p50/p90: ");
+  Serial.print(ticketLog.serviceSecP50(), 1);
+  Serial.print("/");
+  Serial.print(ticketLog.serviceSecP90(), 1);
+  Serial.println("s");
 }
 
 void handlePasswordChangeTouch(int x, int y) {
@@ -1113,3 +1938,454 @@ void handlePasswordChangeTouch(int x, int y) {
     }
   }
 }
+
+// ===== 시리얼 명령 =====
+
+// "HH:MM" → 자정 기준 초 (형식 오류 시 -1)
+long parseTimeOfDay(String text) {
+  int colon = -1;
+  for (unsigned int i = 0; i < text.length(); i++) {
+    if (text[i] == ':') colon = i;
+  }
+  if (colon <= 0) return -1;
+  long hh = atoi(text.c_str());
+  long mm = atoi(text.c_str() + colon + 1);
+  if (hh < 0 || hh > 23 || mm < 0 || mm > 59) return -1;
+  return hh * 3600 + mm * 60;
+}
+
+// 바이너리 프레임은 링 버퍼에서 바로 처리하고, 나머지 바이트는 줄 단위 텍스트 명령
+void pollSerialCommands() {
+  adminLink.fill(Serial);
+  LinkFrame frame;
+  char c;
+  LinkItem item;
+  while ((item = adminLink.next(frame, c)) != LINK_ITEM_NONE) {
+    if (item == LINK_ITEM_FRAME) {
+      handleLinkFrame(frame);
+      adminLink.consume(frame);
+    } else if (c == '\n' || c == '\r') {
+      if (serialLine.length() > 0) {
+        handleSerialCommand(serialLine);
+        serialLine = "";
+      }
+    } else if (serialLine.length() < 64) {
+      serialLine += c;
+    }
+  }
+  applyRemoteChange();
+}
+
+void handleSerialCommand(String line) {
+  const char* cmd = line.c_str();
+  
+  // clock HH:MM - 현재 시각 설정 (마감 판단 기준)
+  if (strncmp(cmd, "clock ", 6) == 0) {
+    long sec = parseTimeOfDay(String(cmd + 6));
+    if (sec >= 0) {
+      admissionPolicy.setClock(millis(), sec);
+      Serial.println("Clock set");
+    } else {
+      Serial.println("Usage: clock HH:MM");
+    }
+  }
+  // close HH:MM | close off - 마감 시각 설정
+  else if (strncmp(cmd, "close ", 6) == 0) {
+    if (strcmp(cmd + 6, "off") == 0) {
+      admissionPolicy.setClosingTime(-1);
+      Serial.println("Closing time disabled");
+    } else {
+      long sec = parseTimeOfDay(String(cmd + 6));
+      if (sec >= 0) {
+        admissionPolicy.setClosingTime(sec);
+        Serial.println("Closing time set");
+      } else {
+        Serial.println("Usage: close HH:MM | close off");
+      }
+    }
+  }
+  // trace start - 터치 샘플 기록 시작 (프레임으로 감싸서 시리얼로 출력)
+  else if (strcmp(cmd, "trace start") == 0) {
+    touchModule.startRecording(Serial);
+  }
+  // trace stop - 기록 종료
+  else if (strcmp(cmd, "trace stop") == 0) {
+    uint32_t count = touchModule.stopRecording();
+    Serial.print("\nTrace stopped: ");
+    Serial.print(count);
+    Serial.println(" samples");
+  }
+  // replay - SPIFFS 의 /touch.qtt 재생
+  else if (strcmp(cmd, "replay") == 0) {
+    if (!SPIFFS.begin(true)) {
+      Serial.println("SPIFFS mount failed");
+      return;
+    }
+    File f = SPIFFS.open(REPLAY_PATH, FILE_READ);
+    if (!f || f.size() > REPLAY_MAX_BYTES) {
+      Serial.println("No trace at " REPLAY_PATH);
+      return;
+    }
+    free(replayBuffer);
+    size_t len = f.size();
+    replayBuffer = (uint8_t*)malloc(len);
+    if (!replayBuffer || f.read(replayBuffer, len) != len || !beginTouchReplay(replayBuffer, len)) {
+      Serial.println("Invalid trace");
+    }
+    f.close();
+  }
+  // maxwait <sec> - 최대 허용 대기시간 (0 = 제한 없음)
+  else if (strncmp(cmd, "maxwait ", 8) == 0) {
+    admissionPolicy.setMaxWait(atoi(cmd + 8));
+    Serial.print("Max wait: ");
+    Serial.print(admissionPolicy.getMaxWait());
+    Serial.println(" sec");
+  }
+  // call - 지금 화면 위에 호출 창 열기
+  else if (strcmp(cmd, "call") == 0) {
+    if (modal.active()) {
+      Serial.println("Modal already open");
+    } else {
+      openModal(CALL_MODAL);
+      Serial.print("Call modal over ");
+      Serial.print(screenNames[modalParent]);
+      Serial.println(modal.saved() ? " (region saved)" : " (parent redraw on close)");
+    }
+  }
+  // spi - 버스 구성과 장치 전환 횟수
+  else if (strcmp(cmd, "spi") == 0) {
+    Serial.print("TFT ");
+    Serial.print(tftBus.name());
+    Serial.print(" @ ");
+    Serial.print(tftDevice.clockHz / 1000000);
+    Serial.print("MHz, touch ");
+    Serial.print(touchBus.name());
+    Serial.print(" @ ");
+    Serial.print(touchDevice.clockHz / 1000);
+    Serial.print("kHz, switches ");
+    Serial.println(tftBus.ownerSwitches());
+  }
+  // anim - 애니메이션 틱 수와 건너뛴(밀린) 틱 수
+  else if (strcmp(cmd, "anim") == 0) {
+    Serial.print("Anim: ");
+    Serial.print(animator.frames());
+    Serial.print(" ticks, ");
+    Serial.print(animator.dropped());
+    Serial.print(" dropped (tick ");
+    Serial.print(ANIM_TICK_MS);
+    Serial.println(" ms)");
+  }
+  // prof - 구간별 사이클 표 (QMS_PROFILE_SCOPE 자리마다), prof reset 으로 값만 지움
+  else if (strcmp(cmd, "prof") == 0) {
+    printProfile(Serial);
+  }
+  else if (strcmp(cmd, "prof reset") == 0) {
+    resetProfile();
+    Serial.println("Profile: reset");
+  }
+  // boot - 부팅 단계별 시간 (미룬 초기화 포함)
+  else if (strcmp(cmd, "boot") == 0) {
+    bootProfile.print(Serial);
+  }
+  // status [seq] - 안내판용 상태 JSON (seq 를 주면 그 뒤로 바뀐 필드만)
+  else if (strcmp(cmd, "status") == 0 || strncmp(cmd, "status ", 7) == 0) {
+    size_t len = renderStatus(cmd[6] ? strtoul(cmd + 7, nullptr, 10) : 0);
+    Serial.write((const uint8_t*)statusBuffer, len);
+    Serial.println();
+  }
+  // link - 바이너리 명령 수와 CRC/헤더 오류로 버린 프레임 수
+  else if (strcmp(cmd, "link") == 0) {
+    Serial.print("Link: ");
+    Serial.print(adminLink.frames());
+    Serial.print(" frames, ");
+    Serial.print(adminLink.errors());
+    Serial.println(" errors");
+  }
+  else {
+    Serial.println("Commands: clock HH:MM, close HH:MM|off, maxwait <sec>, trace start|stop, replay, call, spi, anim, boot, prof [reset], link, status [seq]");
+  }
+}
+
+// ===== 관리용 바이너리 명령 =====
+
+// 길이가 다르면 오류 응답을 준비하고 false
+bool linkLengthIs(const LinkFrame& frame, uint16_t length) {
+  if (frame.length == length) return true;
+  linkReply.begin(frame, LINK_BAD_LENGTH);
+  return false;
+}
+
+// 화면 갱신은 모아 두었다가 applyRemoteChange 에서 한 번만 (배치 하나에 수백 건이 바뀌어도)
+void handleLinkFrame(const LinkFrame& frame) {
+  unsigned long now = millis();
+  
+  switch (frame.op) {
+    case LINK_PING:
+      if (!linkLengthIs(frame, 0)) break;
+      linkReply.begin(frame, LINK_OK);
+      linkReply.put8(LINK_VERSION);
+      linkReply.put16(LINK_PAYLOAD_MAX);
+      break;
+      
+    // 키오스크 발행과 같은 수용 판단, 거절되면 거기서 멈추고 사유를 돌려줌
+    case LINK_ENQUEUE: {
+      if (!linkLengthIs(frame, 1)) break;
+      int requested = frame.u8(0);
+      int issued = 0;
+      int firstTicket = currentTicket + 1;
+      AdmissionResult stopped = ADMIT_OK;
+      while (issued < requested) {
+        AdmissionDecision decision = admissionPolicy.evaluate(now, queueCount, remainingForCurrentSec(now), userProcessTimeSec);
+        if (decision.result != ADMIT_OK) {
+          stopped = decision.result;
+          break;
+        }
+        currentTicket++;
+        throughputSeries.recordIssue(decision.predictedWaitSec);
+        addToQueue(currentTicket, now, TICKET_CLASS_REMOTE);
+        issued++;
+      }
+      if (issued > 0) noteRemoteChange(queueCount - issued);
+      linkReply.begin(frame, LINK_OK);
+      linkReply.put8(issued);
+      linkReply.put16(firstTicket);
+      linkReply.put8(stopped);
+      break;
+    }
+    
+    case LINK_DEQUEUE: {
+      if (!linkLengthIs(frame, 1)) break;
+      int served = 0;
+      while (served < frame.u8(0) && queueCount > 0) {
+        processQueueHead(false);
+        served++;
+      }
+      if (served > 0) {
+        lastProcessTime = now;
+        noteRemoteChange(0);
+      }
+      linkReply.begin(frame, LINK_OK);
+      linkReply.put8(served);
+      break;
+    }
+    
+    // 없는 번호는 건너뜀
+    case LINK_DELETE: {
+      if (frame.length % 2 != 0) {
+        linkReply.begin(frame, LINK_BAD_LENGTH);
+        break;
+      }
+      uint16_t deleted = 0;
+      for (uint16_t i = 0; i < frame.length; i += 2) {
+        int ticketNum = frame.u16(i);
+        for (int index = 0; index < queueCount; index++) {
+          if (queueList[index] != ticketNum) continue;
+          removeFromQueue(index, now);
+          noteRemoteChange(index);
+          deleted++;
+          break;
+        }
+      }
+      linkReply.begin(frame, LINK_OK);
+      linkReply.put16(deleted);
+      break;
+    }
+    
+    // 값 범위는 관리자 화면/텍스트 명령과 같음
+    case LINK_SET: {
+      if (!linkLengthIs(frame, 5)) break;
+      int32_t value = frame.i32(1);
+      bool valid = true;
+      switch (frame.u8(0)) {
+        case LINK_SET_PROCESS_SEC:
+          valid = value >= 1 && value <= 99;
+          if (valid) {
+            userProcessTimeSec = value;
+            waitingTimeSec = queueCount * userProcessTimeSec;
+          }
+          break;
+        case LINK_SET_MAX_WAIT:
+          valid = value >= 0;
+          if (valid) admissionPolicy.setMaxWait(value);
+          break;
+        case LINK_SET_CLOSING:
+          valid = value >= -1 && value < 86400;
+          if (valid) admissionPolicy.setClosingTime(value);
+          break;
+        case LINK_SET_CLOCK:
+          valid = value >= 0 && value < 86400;
+          if (valid) admissionPolicy.setClock(now, value);
+          break;
+        default:
+          valid = false;
+          break;
+      }
+      if (!valid) {
+        linkReply.begin(frame, LINK_BAD_VALUE);
+        break;
+      }
+      noteRemoteChange(queueCount);
+      linkReply.begin(frame, LINK_OK);
+      linkReply.put32(value);
+      break;
+    }
+    
+    // 응답에 들어가는 만큼만 번호를 싣고 실은 수를 따로 알림
+    case LINK_DUMP: {
+      if (!linkLengthIs(frame, 0)) break;
+      linkReply.begin(frame, LINK_OK);
+      linkReply.put16(currentTicket);
+      linkReply.put16(queueCount);
+      linkReply.put32(expectedWaitSec(now));
+      linkReply.put16(userProcessTimeSec);
+      linkReply.put32(admissionPolicy.getMaxWait());
+      linkReply.put32(admissionPolicy.getClosingTime());
+      linkReply.put32(ticketLog.servedCount());
+      linkReply.put32(adminLink.frames());
+      linkReply.put32(adminLink.errors());
+      linkReply.put8(currentScreen);
+      int listed = min(queueCount, (linkReply.room() - 2) / 2);
+      linkReply.put16(listed);
+      for (int i = 0; i < listed; i++) linkReply.put16(queueList[i]);
+      break;
+    }
+    
+    default:
+      linkReply.begin(frame, LINK_BAD_OP);
+      break;
+  }
+  linkReply.send(Serial);
+}
+
+// index 이후 대기열(또는 설정)이 바이너리 명령으로 바뀜
+void noteRemoteChange(int index) {
+  if (remoteChangedFrom < 0 || index < remoteChangedFrom) remoteChangedFrom = index;
+}
+
+// 보고 있는 화면에 반영 - 자동 처리와 같은 방식 (모달이 열려 있으면 닫을 때 목록을 고침)
+void applyRemoteChange() {
+  if (remoteChangedFrom < 0) return;
+  int index = remoteChangedFrom;
+  remoteChangedFrom = -1;
+  
+  noteQueueChangedUnderModal(index);
+  if (currentScreen == USER_MODE) {
+    drawUserMode();
+  } else if (currentScreen == CALL_MODAL) {
+    drawCallModalFields();
+  } else if (currentScreen == QUEUE_LIST) {
+    refreshQueueListFrom(index);
+  } else if (currentScreen == TIME_SETTING) {
+    drawTimeSetting();
+  }
+}
+
+// ===== 안내판 상태 =====
+
+QueueStatus snapshotStatus() {
+  QueueStatus status = {};
+  status.serving = queueCount > 0 ? queueList[0] : 0;
+  status.waiting = queueCount;
+  status.etaSec = expectedWaitSec(millis());
+  status.issued = currentTicket;
+  status.processSec = userProcessTimeSec;
+  for (int i = 1; i < queueCount && status.nextCount < STATUS_NEXT; i++) {
+    status.next[status.nextCount++] = queueList[i];
+  }
+  return status;
+}
+
+// 요청이 올 때 상태를 비교해 순번을 매기고 statusBuffer 에 씀 (since = 0 이면 전체)
+size_t renderStatus(uint32_t since) {
+  statusFeed.update(snapshotStatus());
+  return statusFeed.write(statusBuffer, sizeof(statusBuffer), since);
+}
+
+#if QMS_STATUS_HTTP
+// GET /status[?since=<seq>] - 본문은 statusBuffer 에서 바로 보냄
+void handleStatusRequest() {
+  uint32_t since = statusServer.hasArg("since") ? strtoul(statusServer.arg("since").c_str(), nullptr, 10) : 0;
+  size_t len = renderStatus(since);
+  statusServer.sendHeader("Cache-Control", "no-store");
+  statusServer.sendHeader("Access-Control-Allow-Origin", "*");
+  statusServer.setContentLength(len);
+  statusServer.send(200, "application/json", "");
+  statusServer.sendContent(statusBuffer, len);
+}
+
+// 미룬 초기화 - 접속은 기다리지 않고 시작만 (연결되면 pollStatusServer 가 주소를 알림)
+void startStatusServer() {
+  if (strlen(QMS_WIFI_SSID) == 0) return;
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(QMS_WIFI_SSID, QMS_WIFI_PASS);
+  statusServer.on("/status", HTTP_GET, handleStatusRequest);
+  statusServer.begin();
+  statusServerStarted = true;
+}
+
+void pollStatusServer() {
+  if (!statusServerStarted) return;
+  if (!statusAddressShown && WiFi.status() == WL_CONNECTED) {
+    statusAddressShown = true;
+    Serial.print("Status: http://");
+    Serial.print(WiFi.localIP());
+    Serial.println("/status");
+  }
+  statusServer.handleClient();
+}
+#endif
+
+// ===== 터치 재생 =====
+
+// 재생 시작: 사용자 화면에서 시작해 매번 같은 입력 → 같은 결과가 나오게 함
+bool beginTouchReplay(const uint8_t* buffer, size_t len) {
+  if (!touchModule.startReplay(buffer, len)) return false;
+  gestures.reset();
+  listGestureActive = false;
+  listFlingVelocity = 0;
+  queueView.hide(tft);
+  modal.cancel();
+  currentScreen = USER_MODE;
+  drawUserMode();
+  tft.stats.reset();
+  resetProfile();
+  replayLongestLoopUs = 0;
+  loggedScreen = currentScreen;
+  replayStartMs = millis();
+  replayActive = true;
+  replayLog->println("[replay] start");
+  return true;
+}
+
+void logReplayProgress() {
+  bool finished = !touchModule.isReplaying();
+  if (currentScreen == loggedScreen && !finished) return;
+  
+  replayLog->print("[replay] t=");
+  replayLog->print(millis() - replayStartMs);
+  replayLog->print("ms ");
+  replayLog->print(screenNames[loggedScreen]);
+  if (currentScreen != loggedScreen) {
+    replayLog->print(" -> ");
+    replayLog->print(screenNames[currentScreen]);
+  }
+  replayLog->print(" spi=");
+  replayLog->print(tft.stats.bytes);
+  replayLog->print("B tx=");
+  replayLog->print(tft.stats.transactions);
+  replayLog->print(" win=");
+  replayLog->print(tft.stats.windows);
+  replayLog->print(" loop<=");
+  replayLog->print(replayLongestLoopUs);
+  replayLog->println("us");
+  tft.stats.reset();
+  replayLongestLoopUs = 0;
+  loggedScreen = currentScreen;
+  
+  if (finished) {
+    // 보드에서만 사이클이 나옴 (호스트는 가상 시계) - QMS_IRAM_HOT=0/1 보드 로그는 util/prof_ab.py 로 비교
+    printProfile(*replayLog);
+    replayLog->println("[replay] end");
+    replayActive = false;
+  }
+}
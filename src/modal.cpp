@@ -0,0 +1,110 @@
+#include "modal.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MODAL_RUN_CHUNK 256  // 저장 중 런 버퍼 증가 단위
+
+ModalOverlay::ModalOverlay()
+  : panel(nullptr), opened(false), restoring(false), boxX(0), boxY(0), boxW(0), boxH(0),
+    runs(nullptr), count(0), capacity(0) {}
+
+bool ModalOverlay::open(QmsDisplay& target, int16_t x, int16_t y, int16_t w, int16_t h, LayerPainter under) {
+  // 이전 모달 복원을 아직 보내는 중이면 저장 버퍼를 다시 쓰기 전에 마저 보냄
+  if (restoring) target.flush();
+  freeRuns();
+
+  panel = &target;
+  boxX = max(x, (int16_t)0);
+  boxY = max(y, (int16_t)0);
+  boxW = min((int16_t)(x + w), min(target.width(), (int16_t)LAYER_MAX_WIDTH)) - boxX;
+  boxH = min((int16_t)(y + h), min(target.height(), (int16_t)LAYER_MAX_HEIGHT)) - boxY;
+  opened = true;
+  return under != nullptr && boxW > 0 && boxH > 0 && save(under);
+}
+
+// 아래 화면을 띠마다 다시 그려서 모달 사각형 줄만 런으로 인코딩
+bool ModalOverlay::save(LayerPainter under) {
+  count = 0;
+  for (int16_t top = boxY; top < boxY + boxH; top += LAYER_STRIP_LINES) {
+    stripCanvas.setStrip(top);
+    under(stripCanvas);
+
+    int16_t bottom = min((int16_t)(top + LAYER_STRIP_LINES), (int16_t)(boxY + boxH));
+    for (int16_t y = top; y < bottom; y++) {
+      rowStart[y - boxY] = count;
+      const uint16_t* p = stripCanvas.line(y);
+      for (int16_t x = boxX; x < boxX + boxW; x++) {
+        if (count > rowStart[y - boxY] && runs[count - 1].color == p[x]) {
+          runs[count - 1].length++;
+          continue;
+        }
+        if (count == capacity) {
+          size_t bytes = (capacity + MODAL_RUN_CHUNK) * sizeof(LayerRun);
+          LayerRun* grown = bytes <= MODAL_SAVE_BYTES ? (LayerRun*)realloc(runs, bytes) : nullptr;
+          if (grown == nullptr) {
+            freeRuns();
+            return false;
+          }
+          runs = grown;
+          capacity += MODAL_RUN_CHUNK;
+        }
+        runs[count].length = 1;
+        runs[count].color = p[x];
+        count++;
+      }
+    }
+  }
+  rowStart[boxH] = count;
+  return true;
+}
+
+bool ModalOverlay::close() {
+  if (!opened) return false;
+  opened = false;
+  if (!saved()) return false;
+
+  // 복원할 메모리 줄 범위 (스크롤 영역에 걸치면 되감긴 줄까지 포함)
+  int16_t y0 = panel->height();
+  int16_t y1 = 0;
+  for (int16_t y = boxY; y < boxY + boxH; y++) {
+    int16_t line = panel->memoryLine(y);
+    y0 = min(y0, line);
+    y1 = max(y1, (int16_t)(line + 1));
+  }
+  restoring = true;
+  panel->setUnderlay(this, y0, y1);
+  return true;
+}
+
+void ModalOverlay::discard() {
+  if (!restoring) freeRuns();
+}
+
+void ModalOverlay::fillBand(uint16_t* pixels, uint8_t* covered, int16_t top, int16_t lines, int16_t width) {
+  for (int16_t i = 0; i < lines; i++) {
+    int16_t row = panel->screenLine(top + i) - boxY;
+    if (row < 0 || row >= boxH) continue;
+    uint16_t* out = &pixels[i * DISPLAY_MAX_WIDTH];
+    uint8_t* mark = &covered[i * DISPLAY_MAX_WIDTH];
+    int16_t x = boxX;
+    for (uint32_t r = rowStart[row]; r < rowStart[row + 1]; r++) {
+      for (uint16_t k = 0; k < runs[r].length; k++, x++) {
+        if (x >= width) break;
+        out[x] = runs[r].color;
+        mark[x] = 1;
+      }
+    }
+  }
+}
+
+void ModalOverlay::release() {
+  restoring = false;
+  freeRuns();
+}
+
+void ModalOverlay::freeRuns() {
+  free(runs);
+  runs = nullptr;
+  count = 0;
+  capacity = 0;
+}
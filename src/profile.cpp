@@ -0,0 +1,56 @@
+#include "profile.h"
+#include <Arduino.h>
+
+static ProfileSite* profileSites = nullptr;
+
+#if !defined(__XTENSA__)
+uint32_t profileCycles() {
+  return ESP.getCycleCount();
+}
+#endif
+
+// 두 코어에서 처음 지나는 자리가 겹쳐도 목록이 깨지지 않게 비교 후 교환으로 앞에 붙임
+void profileLink(ProfileSite* site) {
+  if (__atomic_exchange_n(&site->linked, 1u, __ATOMIC_ACQ_REL)) return;
+  ProfileSite* head = __atomic_load_n(&profileSites, __ATOMIC_ACQUIRE);
+  do {
+    site->next = head;
+  } while (!__atomic_compare_exchange_n(&profileSites, &head, site, true, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+}
+
+// Profile (IRAM, 240 MHz) cycles: count / avg / min / max / total
+//   drawUserMode 3 / 1843200 / 1800000 / 1900000 / 5529600
+void printProfile(Print& out) {
+#if QMS_PROFILE
+  out.print("Profile (");
+  out.print(QMS_HOT_PLACEMENT);
+  out.print(", ");
+  out.print(ESP.getCpuFreqMHz());
+  out.println(" MHz) cycles: count / avg / min / max / total");
+  for (const ProfileSite* site = profileSites; site; site = site->next) {
+    out.print("  ");
+    out.print(site->name);
+    out.print(" ");
+    out.print(site->count);
+    out.print(" / ");
+    out.print(site->count ? (unsigned long)(site->totalCycles / site->count) : 0UL);
+    out.print(" / ");
+    out.print(site->count ? site->minCycles : 0);
+    out.print(" / ");
+    out.print(site->maxCycles);
+    out.print(" / ");
+    out.println((unsigned long long)site->totalCycles);
+  }
+#else
+  out.println("Profile: disabled (QMS_PROFILE=0)");
+#endif
+}
+
+void resetProfile() {
+  for (ProfileSite* site = profileSites; site; site = site->next) {
+    site->count = 0;
+    site->minCycles = UINT32_MAX;
+    site->maxCycles = 0;
+    site->totalCycles = 0;
+  }
+}
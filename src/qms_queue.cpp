@@ -0,0 +1,77 @@
+#include "qms_queue.h"
+#include "profile.h"
+
+static_assert(TICKET_ARENA_SIZE > QUEUE_CAPACITY, "TICKET_ARENA_SIZE must exceed QUEUE_CAPACITY");
+
+int queueList[QUEUE_CAPACITY];
+int queueCount = 0;
+int waitingCount = 0;
+int waitingTimeSec = 0;
+int userProcessTimeSec = 60;
+unsigned long lastProcessTime = 0;
+TicketLog ticketLog;
+
+void addToQueue(int ticketNum, unsigned long nowMs, uint8_t ticketClass) {
+  QMS_PROFILE_FUNCTION();
+  if (queueCount < QUEUE_CAPACITY) {
+    queueList[queueCount] = ticketNum;
+    queueCount++;
+    waitingCount = queueCount;
+    waitingTimeSec = queueCount * userProcessTimeSec;
+    
+    ticketLog.issue(ticketNum, ticketClass, nowMs);
+    if (queueCount == 1) {
+      ticketLog.call(ticketNum, nowMs);  // 대기 없이 바로 호출
+    }
+  }
+}
+
+void removeFromQueue(int index, unsigned long nowMs) {
+  QMS_PROFILE_FUNCTION();
+  if (index >= 0 && index < queueCount) {
+    // 처리되지 않고 빠진 티켓은 취소로 기록 (처리 완료된 티켓은 무시됨)
+    ticketLog.cancel(queueList[index]);
+    
+    // 배열에서 요소 삭제 (뒤 요소들을 당겨옴)
+    for (int i = index; i < queueCount - 1; i++) {
+      queueList[i] = queueList[i + 1];
+    }
+    queueCount--;
+    waitingCount = queueCount;
+    waitingTimeSec = queueCount * userProcessTimeSec;
+    
+    // 맨 앞이 빠졌으면 다음 사람 호출
+    if (index == 0 && queueCount > 0) {
+      ticketLog.call(queueList[0], nowMs);
+    }
+  }
+}
+
+int serveQueueHead(unsigned long nowMs) {
+  QMS_PROFILE_FUNCTION();
+  if (queueCount == 0) return -1;
+  
+  int ticketNum = queueList[0];
+  int actualWaitSec = -1;
+  if (ticketLog.serve(ticketNum, nowMs)) {
+    actualWaitSec = (ticketLog.calledAt(ticketNum) - ticketLog.issuedAt(ticketNum)) / 1000;
+  }
+  removeFromQueue(0, nowMs);
+  return actualWaitSec;
+}
+
+bool queueHeadDue(unsigned long nowMs) {
+  return queueCount > 0 && nowMs - lastProcessTime >= (unsigned long)userProcessTimeSec * 1000;
+}
+
+int remainingForCurrentSec(unsigned long nowMs) {
+  unsigned long elapsedSinceLastProcess = (nowMs - lastProcessTime) / 1000;
+  int remainingForCurrent = userProcessTimeSec - (int)elapsedSinceLastProcess;
+  if (remainingForCurrent < 0) remainingForCurrent = 0;
+  return remainingForCurrent;
+}
+
+int expectedWaitSec(unsigned long nowMs) {
+  if (queueCount == 0) return 0;
+  return remainingForCurrentSec(nowMs) + (queueCount - 1) * userProcessTimeSec;
+}
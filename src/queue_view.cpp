@@ -0,0 +1,183 @@
+#include "queue_view.h"
+
+// 콘텐츠 좌표로 그린 것을 [clipTop, clipBottom) 줄만 잘라 패널 메모리 줄로 옮겨 그리는 어댑터
+class ContentBand : public Adafruit_GFX {
+public:
+  ContentBand(Adafruit_GFX& target, int16_t w, int clipTop, int clipBottom, int shift)
+    : Adafruit_GFX(w, 0x7FFF), panel(target), clipTop(clipTop), clipBottom(clipBottom), shift(shift) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (y < clipTop || y >= clipBottom) return;
+    panel.drawPixel(x, y + shift, color);
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+    int y0 = max((int)y, clipTop);
+    int y1 = min((int)y + h, clipBottom);
+    if (y0 >= y1 || w <= 0) return;
+    panel.fillRect(x, y0 + shift, w, y1 - y0, color);
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    fillRect(x, y, w, 1, color);
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    fillRect(x, y, 1, h, color);
+  }
+
+private:
+  Adafruit_GFX& panel;
+  int clipTop, clipBottom, shift;
+};
+
+QueueListView::QueueListView(const QueueViewLayout& viewLayout)
+  : layout(viewLayout), area(0), scrollOffset(0), count(0), shown(false), paint(nullptr),
+    pendingTop(0), pendingBottom(0) {}
+
+int QueueListView::maxOffset() const {
+  int rows = (count + layout.columns - 1) / layout.columns;
+  int contentHeight = rows * rowPitch();
+  return contentHeight > area ? contentHeight - area : 0;
+}
+
+void QueueListView::show(QmsDisplay& panel, int itemCount, QueueItemPainter painter, bool backgroundReady) {
+  count = itemCount;
+  paint = painter;
+  area = panel.height() - layout.top - layout.bottom;
+  if (scrollOffset > maxOffset()) scrollOffset = maxOffset();
+
+  panel.setScrollArea(layout.top, area, layout.bottom);
+  panel.setScrollStart(memoryLine(scrollOffset));
+  shown = true;
+  pendingTop = pendingBottom = 0;
+  drawContent(panel, scrollOffset, scrollOffset + area, !backgroundReady);
+}
+
+void QueueListView::hide(QmsDisplay& panel) {
+  if (!shown) return;
+  panel.resetScroll();
+  shown = false;
+  pendingTop = pendingBottom = 0;
+}
+
+int QueueListView::scrollTo(QmsDisplay& panel, int offsetPx) {
+  return scrollBy(panel, offsetPx - scrollOffset);
+}
+
+int QueueListView::scrollBy(QmsDisplay& panel, int deltaPx) {
+  if (!shown) return 0;
+  int target = scrollOffset + deltaPx;
+  if (target < 0) target = 0;
+  if (target > maxOffset()) target = maxOffset();
+  int moved = target - scrollOffset;
+  if (moved == 0) return 0;
+
+  int previous = scrollOffset;
+  scrollOffset = target;
+  panel.setScrollStart(memoryLine(scrollOffset));
+
+  // 새로 드러난 줄만 그림 (한 화면 이상 움직였으면 전부)
+  if (moved >= area || -moved >= area) {
+    drawContent(panel, scrollOffset, scrollOffset + area);
+  } else if (moved > 0) {
+    drawContent(panel, previous + area, scrollOffset + area);
+  } else {
+    drawContent(panel, scrollOffset, previous);
+  }
+  return moved;
+}
+
+void QueueListView::refresh(QmsDisplay& panel, int itemCount, int fromIndex) {
+  if (!shown) return;
+  count = itemCount;
+  if (scrollOffset > maxOffset()) {
+    // 끝에서 줄어들면 스크롤 위치를 당기고 보이는 줄 전체를 다시 그림
+    scrollOffset = maxOffset();
+    panel.setScrollStart(memoryLine(scrollOffset));
+    invalidate(scrollOffset, scrollOffset + area);
+    return;
+  }
+  int y0 = max(scrollOffset, (fromIndex / layout.columns) * rowPitch());
+  if (y0 < scrollOffset + area) invalidate(y0, scrollOffset + area);
+}
+
+void QueueListView::invalidate(int y0, int y1) {
+  if (pending()) {
+    pendingTop = min(pendingTop, y0);
+    pendingBottom = max(pendingBottom, y1);
+  } else {
+    pendingTop = y0;
+    pendingBottom = y1;
+  }
+}
+
+bool QueueListView::pump(QmsDisplay& panel) {
+  if (!shown || !pending()) return false;
+  // 그 사이 스크롤로 밀려난 줄은 버림 (같은 메모리 줄을 이미 새 콘텐츠가 쓰고 있음)
+  int y0 = max(pendingTop, scrollOffset);
+  int y1 = min(pendingBottom, scrollOffset + area);
+  if (y0 >= y1) {
+    pendingTop = pendingBottom = 0;
+    return false;
+  }
+  int rowEnd = min(y1, (y0 / rowPitch() + 1) * rowPitch());
+  drawContent(panel, y0, rowEnd);
+  pendingTop = rowEnd;
+  pendingBottom = y1;
+  return pending();
+}
+
+void QueueListView::drawContent(QmsDisplay& panel, int y0, int y1, bool fillBackground) {
+  int pitch = rowPitch();
+  while (y0 < y1) {
+    // 메모리 줄이 스크롤 영역 끝에서 되감기는 지점에서 나눠 그림
+    int segmentEnd = min(y1, (y0 / area + 1) * area);
+    ContentBand band(panel, panel.width(), y0, segmentEnd, memoryLine(y0) - y0);
+
+    if (fillBackground) band.fillRect(0, y0, panel.width(), segmentEnd - y0, layout.background);
+    int firstRow = y0 / pitch;
+    int lastRow = (segmentEnd - 1) / pitch;
+    for (int row = firstRow; row <= lastRow; row++) {
+      for (int col = 0; col < layout.columns; col++) {
+        int index = row * layout.columns + col;
+        if (index >= count) break;
+        paint(band, index, layout.left + col * (layout.itemWidth + layout.gap), row * pitch,
+              layout.itemWidth, layout.itemHeight);
+      }
+    }
+    y0 = segmentEnd;
+  }
+}
+
+void QueueListView::paintVisible(Adafruit_GFX& gfx) const {
+  if (!shown) return;
+  int pitch = rowPitch();
+  int y1 = scrollOffset + area;
+  ContentBand band(gfx, gfx.width(), scrollOffset, y1, layout.top - scrollOffset);
+  band.fillRect(0, scrollOffset, gfx.width(), area, layout.background);
+  for (int row = scrollOffset / pitch; row * pitch < y1; row++) {
+    for (int col = 0; col < layout.columns; col++) {
+      int index = row * layout.columns + col;
+      if (index >= count) break;
+      paint(band, index, layout.left + col * (layout.itemWidth + layout.gap), row * pitch,
+            layout.itemWidth, layout.itemHeight);
+    }
+  }
+}
+
+bool QueueListView::contains(int x, int y) const {
+  return shown && x >= 0 && x < layout.left + layout.columns * (layout.itemWidth + layout.gap) && y >= layout.top && y < layout.top + area;
+}
+
+int QueueListView::itemAt(int x, int y) const {
+  if (!shown || y < layout.top || y >= layout.top + area || x < layout.left) return -1;
+  int contentY = scrollOffset + (y - layout.top);
+  int pitch = rowPitch();
+  if (contentY % pitch > layout.itemHeight) return -1;
+  int colPitch = layout.itemWidth + layout.gap;
+  int col = (x - layout.left) / colPitch;
+  if (col >= layout.columns || (x - layout.left) % colPitch > layout.itemWidth) return -1;
+  int index = (contentY / pitch) * layout.columns + col;
+  return index < count ? index : -1;
+}
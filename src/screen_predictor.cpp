@@ -0,0 +1,39 @@
+#include "screen_predictor.h"
+
+ScreenPredictor screenPredictor;
+
+ScreenPredictor::ScreenPredictor() {
+  for (int i = 0; i < PREDICT_SCREENS; i++) {
+    for (int j = 0; j < PREDICT_SCREENS; j++) counts[i][j] = 0;
+  }
+}
+
+void ScreenPredictor::record(uint8_t from, uint8_t to, uint16_t weight) {
+  if (from >= PREDICT_SCREENS || to >= PREDICT_SCREENS || from == to) return;
+  uint16_t* row = counts[from];
+  if (row[to] > 0xFFFF - weight) {
+    // 오래된 빈도를 줄여서 최근 사용 패턴 쪽으로 따라감
+    for (int j = 0; j < PREDICT_SCREENS; j++) row[j] >>= 1;
+  }
+  row[to] += weight;
+}
+
+int ScreenPredictor::likely(uint8_t from, uint8_t* out, int n) const {
+  if (from >= PREDICT_SCREENS) return 0;
+  const uint16_t* row = counts[from];
+  int found = 0;
+  // 후보 수가 작으므로 삽입 정렬
+  for (int j = 0; j < PREDICT_SCREENS; j++) {
+    if (row[j] == 0) continue;
+    int pos = found < n ? found : n;
+    while (pos > 0 && row[out[pos - 1]] < row[j]) {
+      if (pos < n) out[pos] = out[pos - 1];
+      pos--;
+    }
+    if (pos < n) {
+      out[pos] = j;
+      if (found < n) found++;
+    }
+  }
+  return found;
+}
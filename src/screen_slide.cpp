@@ -0,0 +1,58 @@
+#include "screen_slide.h"
+
+ScreenSlide::ScreenSlide() : panel(nullptr), up(true), target(0), revealed(0) {}
+
+bool ScreenSlide::begin(QmsDisplay& display, bool slideUp) {
+  if (panel) end();
+  if (!display.inFrame() || display.scrollActive()) return false;
+  panel = &display;
+  up = slideUp;
+  target = 0;
+  revealed = 0;
+  // 화면 전체를 스크롤 영역으로 (시작 줄 0 = 지금 보이는 그대로)
+  panel->setScrollArea(0, panel->height(), 0);
+  return true;
+}
+
+void ScreenSlide::end() {
+  panel->resetScroll();
+  panel = nullptr;
+}
+
+// 위로: 시작 줄을 lines 로 옮기면 메모리 [0, lines) 가 화면 아래쪽에 보임 → 그 띠를 보냄
+// 아래로: 시작 줄을 height - lines 로 옮기면 메모리 [height - lines, height) 가 화면 위쪽에 보임
+// 스크롤을 먼저 옮기고 보내므로 잠깐 보이는 것은 이전 화면 줄 (새 화면이 엉뚱한 곳에 보이지 않음)
+void ScreenSlide::reveal(int16_t lines) {
+  int16_t height = panel->height();
+  if (up) {
+    panel->setScrollStart(lines % height);
+    panel->sendLines(revealed, lines);
+  } else {
+    panel->setScrollStart((height - lines) % height);
+    panel->sendLines(height - lines, height - revealed);
+  }
+  revealed = lines;
+}
+
+bool ScreenSlide::pump(uint32_t budgetUs) {
+  if (!panel) return false;
+  int16_t height = panel->height();
+  int16_t goal = target >= height ? height : target / DISPLAY_BAND_LINES * DISPLAY_BAND_LINES;
+
+  // 최소 한 띠, 다음 띠가 직전 띠만큼 걸린다고 보고 예산을 넘기기 전에 멈춤 (pumpFrame 과 같은 규칙)
+  uint32_t startUs = micros();
+  uint32_t elapsedUs = 0;
+  uint32_t bandUs = 0;
+  bool first = true;
+  while (revealed < goal && (first || elapsedUs + bandUs <= budgetUs)) {
+    reveal(min((int16_t)(revealed + DISPLAY_BAND_LINES), height));
+    uint32_t nowUs = micros() - startUs;
+    bandUs = nowUs - elapsedUs;
+    elapsedUs = nowUs;
+    first = false;
+  }
+
+  if (revealed < height) return true;
+  end();
+  return false;
+}
@@ -0,0 +1,49 @@
+#include "spi_bus.h"
+#include "board.h"
+
+SpiDevice tftDevice = {"tft", SPISettings(TFT_SPI_HZ, MSBFIRST, SPI_MODE3), TFT_SPI_HZ};
+SpiDevice touchDevice = {"touch", SPISettings(TOUCH_SPI_HZ, MSBFIRST, SPI_MODE0), TOUCH_SPI_HZ};
+
+SpiBus tftBus("VSPI", SPI);
+
+#if QMS_TOUCH_BUS == TOUCH_BUS_HSPI
+static SPIClass hspi(HSPI);
+static SpiBus hspiBus("HSPI", hspi);
+SpiBus& touchBus = hspiBus;
+#elif QMS_TOUCH_BUS == TOUCH_BUS_SOFT
+// 비트뱅은 SPI 주변장치를 쓰지 않음 - 잠금 대상만 따로 둠
+static SPIClass unusedSpi(HSPI);
+static SpiBus softBus("GPIO", unusedSpi);
+SpiBus& touchBus = softBus;
+#else
+SpiBus& touchBus = tftBus;
+#endif
+
+SpiBus::SpiBus(const char* name, SPIClass& spi)
+  : busName(name), bus(spi), lastOwner(nullptr), switches(0) {
+#ifdef ARDUINO_ARCH_ESP32
+  mutex = nullptr;
+#endif
+}
+
+void SpiBus::begin() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (mutex == nullptr) mutex = xSemaphoreCreateMutex();
+#endif
+}
+
+void SpiBus::acquire(const SpiDevice& device) {
+#ifdef ARDUINO_ARCH_ESP32
+  if (mutex) xSemaphoreTake(mutex, portMAX_DELAY);
+#endif
+  if (lastOwner != &device) {
+    if (lastOwner != nullptr) switches++;
+    lastOwner = &device;
+  }
+}
+
+void SpiBus::release() {
+#ifdef ARDUINO_ARCH_ESP32
+  if (mutex) xSemaphoreGive(mutex);
+#endif
+}
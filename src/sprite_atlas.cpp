@@ -0,0 +1,50 @@
+#include "sprite_atlas.h"
+#include "profile.h"
+
+// 한 줄 풀어 놓는 버퍼 (writePixels 는 끝날 때까지 기다리므로 하나로 충분)
+static uint16_t spriteLine[SPRITE_MAX_WIDTH];
+
+static void QMS_HOT expandLine(const SpriteAtlas& atlas, const SpriteRect& rect, int16_t row, uint16_t* out) {
+  QMS_PROFILE_SCOPE("sprite line");
+  const uint16_t* lut = &atlas.palette[rect.palette];
+  if (atlas.bits == 8) {
+    const uint8_t* src = &atlas.pixels[rect.offset + (uint32_t)row * rect.width];
+    for (uint16_t i = 0; i < rect.width; i++) out[i] = pgm_read_word(&lut[pgm_read_byte(&src[i])]);
+    return;
+  }
+  const uint8_t* src = &atlas.pixels[rect.offset + (uint32_t)row * ((rect.width + 1) / 2)];
+  for (uint16_t i = 0; i < rect.width; i += 2) {
+    uint8_t pair = pgm_read_byte(&src[i / 2]);
+    out[i] = pgm_read_word(&lut[pair >> 4]);
+    if (i + 1 < rect.width) out[i + 1] = pgm_read_word(&lut[pair & 0x0F]);
+  }
+}
+
+void streamSprite(Adafruit_SPITFT& panel, int16_t x, int16_t y, const SpriteAtlas& atlas, uint8_t id) {
+  if (id >= atlas.count) return;
+  const SpriteRect& rect = atlas.rects[id];
+  panel.startWrite();
+  panel.setAddrWindow(x, y, rect.width, rect.height);
+  for (int16_t row = 0; row < rect.height; row++) {
+    expandLine(atlas, rect, row, spriteLine);
+    panel.writePixels(spriteLine, rect.width, true, true);
+  }
+  panel.endWrite();
+}
+
+void drawSprite(Adafruit_GFX& g, int16_t x, int16_t y, const SpriteAtlas& atlas, uint8_t id) {
+  if (id >= atlas.count) return;
+  const SpriteRect& rect = atlas.rects[id];
+  g.startWrite();
+  for (int16_t row = 0; row < rect.height; row++) {
+    expandLine(atlas, rect, row, spriteLine);
+    int16_t start = 0;
+    for (int16_t i = 1; i <= rect.width; i++) {
+      if (i < rect.width && spriteLine[i] == spriteLine[start]) continue;
+      uint16_t wire = spriteLine[start];
+      g.drawFastHLine(x + start, y + row, i - start, (uint16_t)((wire >> 8) | (wire << 8)));
+      start = i;
+    }
+  }
+  g.endWrite();
+}
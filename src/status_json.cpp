@@ -0,0 +1,147 @@
+#include "status_json.h"
+#include <string.h>
+
+// ===== JsonWriter =====
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity)
+    : out(buffer), size(capacity), used(0), overflow(capacity == 0), first(true) {}
+
+void JsonWriter::put(char c) {
+  // 마지막 한 칸은 '\0' 자리
+  if (used + 1 >= size) {
+    overflow = true;
+    return;
+  }
+  out[used++] = c;
+}
+
+void JsonWriter::putNumber(int32_t value) {
+  char digits[11];
+  uint8_t n = 0;
+  uint32_t v = value < 0 ? (uint32_t)0 - (uint32_t)value : (uint32_t)value;
+  do {
+    digits[n++] = (char)('0' + v % 10);
+    v /= 10;
+  } while (v > 0);
+  if (value < 0) put('-');
+  while (n > 0) put(digits[--n]);
+}
+
+void JsonWriter::separator() {
+  if (!first) put(',');
+  first = false;
+}
+
+void JsonWriter::beginObject() {
+  put('{');
+  first = true;
+}
+
+void JsonWriter::endObject() {
+  put('}');
+  first = false;
+}
+
+void JsonWriter::beginArray(const char* key) {
+  separator();
+  put('"');
+  while (*key) put(*key++);
+  put('"');
+  put(':');
+  put('[');
+  first = true;
+}
+
+void JsonWriter::endArray() {
+  put(']');
+  first = false;
+}
+
+void JsonWriter::field(const char* key, int32_t value) {
+  separator();
+  put('"');
+  while (*key) put(*key++);
+  put('"');
+  put(':');
+  putNumber(value);
+}
+
+void JsonWriter::item(int32_t value) {
+  separator();
+  putNumber(value);
+}
+
+size_t JsonWriter::finish() {
+  if (size == 0) return 0;
+  if (overflow) {
+    out[0] = '\0';
+    return 0;
+  }
+  out[used] = '\0';
+  return used;
+}
+
+// ===== StatusFeed =====
+
+StatusFeed::StatusFeed() : recentCount(0), recentChanged(false), seq(0) {
+  memset(&current, 0, sizeof(current));
+  memset(recent, 0, sizeof(recent));
+  memset(fieldSeq, 0, sizeof(fieldSeq));
+}
+
+void StatusFeed::noteServed(int32_t ticket) {
+  if (recentCount == STATUS_RECENT) {
+    memmove(recent, recent + 1, sizeof(recent[0]) * (STATUS_RECENT - 1));
+    recentCount--;
+  }
+  recent[recentCount++] = ticket;
+  recentChanged = true;
+}
+
+uint32_t StatusFeed::update(const QueueStatus& now) {
+  bool changed[STATUS_FIELD_COUNT] = {
+    now.serving != current.serving,
+    now.waiting != current.waiting,
+    now.etaSec != current.etaSec,
+    now.issued != current.issued,
+    now.processSec != current.processSec,
+    now.nextCount != current.nextCount || memcmp(now.next, current.next, sizeof(now.next[0]) * now.nextCount) != 0,
+    recentChanged
+  };
+  bool any = false;
+  for (int i = 0; i < STATUS_FIELD_COUNT; i++) any |= changed[i];
+  if (!any) return seq;
+
+  seq++;
+  for (int i = 0; i < STATUS_FIELD_COUNT; i++) {
+    if (changed[i]) fieldSeq[i] = seq;
+  }
+  current = now;
+  recentChanged = false;
+  return seq;
+}
+
+size_t StatusFeed::write(char* out, size_t size, uint32_t since) const {
+  bool delta = since > 0 && since <= seq;
+  JsonWriter json(out, size);
+  json.beginObject();
+  json.field("seq", seq);
+  if (delta) json.field("since", since);
+  if (!delta || fieldSeq[STATUS_SERVING] > since) json.field("serving", current.serving);
+  if (!delta || fieldSeq[STATUS_WAITING] > since) json.field("waiting", current.waiting);
+  if (!delta || fieldSeq[STATUS_ETA] > since) json.field("eta", current.etaSec);
+  if (!delta || fieldSeq[STATUS_ISSUED] > since) json.field("issued", current.issued);
+  if (!delta || fieldSeq[STATUS_PROCESS] > since) json.field("process", current.processSec);
+  if (!delta || fieldSeq[STATUS_NEXT_LIST] > since) {
+    json.beginArray("next");
+    for (uint8_t i = 0; i < current.nextCount; i++) json.item(current.next[i]);
+    json.endArray();
+  }
+  if (!delta || fieldSeq[STATUS_RECENT_LIST] > since) {
+    json.beginArray("recent");
+    for (uint8_t i = 0; i < recentCount; i++) json.item(recent[i]);
+    json.endArray();
+  }
+  json.endObject();
+  return json.finish();
+}
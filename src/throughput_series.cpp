@@ -0,0 +1,235 @@
+#include "throughput_series.h"
+#include <string.h>
+
+#ifdef QMS_SERIES_SPILL
+#include <SPIFFS.h>
+#endif
+
+static_assert(sizeof(ThroughputSeries) <= SERIES_RAM_CAP, "ThroughputSeries exceeds SERIES_RAM_CAP");
+
+// ===== SeriesAccum =====
+
+void SeriesAccum::reset() {
+  memset(this, 0, sizeof(*this));
+}
+
+void SeriesAccum::merge(const SeriesAccum& other) {
+  issued += other.issued;
+  served += other.served;
+  queueSum += other.queueSum;
+  queueSamples += other.queueSamples;
+  estWaitSum += other.estWaitSum;
+  estWaitCount += other.estWaitCount;
+  actualWaitSum += other.actualWaitSum;
+  actualWaitCount += other.actualWaitCount;
+  if (other.queueMax > queueMax) queueMax = other.queueMax;
+}
+
+static uint16_t clamp16(uint32_t v) {
+  return (v > 0xFFFF) ? 0xFFFF : (uint16_t)v;
+}
+
+SeriesBucket SeriesAccum::toBucket() const {
+  SeriesBucket b;
+  b.issued = clamp16(issued);
+  b.served = clamp16(served);
+  uint32_t avg = queueSamples ? (queueSum + queueSamples / 2) / queueSamples : 0;
+  b.queueAvg = (avg > 255) ? 255 : (uint8_t)avg;
+  b.queueMax = queueMax;
+  b.estWaitSec = estWaitCount ? clamp16(estWaitSum / estWaitCount) : 0;
+  b.actualWaitSec = actualWaitCount ? clamp16(actualWaitSum / actualWaitCount) : 0;
+  return b;
+}
+
+// ===== ThroughputSeries =====
+
+ThroughputSeries::ThroughputSeries() {
+  memset(minutes, 0, sizeof(minutes));
+  memset(hours, 0, sizeof(hours));
+  memset(days, 0, sizeof(days));
+  minuteHead = minuteFilled = 0;
+  hourHead = hourFilled = 0;
+  dayHead = dayFilled = 0;
+  minuteAcc.reset();
+  hourAcc.reset();
+  dayAcc.reset();
+  minutesInHour = 0;
+  hoursInDay = 0;
+  minuteStartMs = 0;
+  lastSampleMs = 0;
+}
+
+void ThroughputSeries::begin(unsigned long nowMs) {
+  minuteStartMs = nowMs;
+  lastSampleMs = nowMs;
+}
+
+void ThroughputSeries::update(unsigned long nowMs, int queueLength) {
+  // 대기열 길이는 1초에 한 번 샘플링
+  if (nowMs - lastSampleMs >= 1000) {
+    lastSampleMs = nowMs;
+    uint8_t len = (queueLength > 255) ? 255 : (uint8_t)queueLength;
+    minuteAcc.queueSum += len;
+    minuteAcc.queueSamples++;
+    if (len > minuteAcc.queueMax) minuteAcc.queueMax = len;
+  }
+  
+  while (nowMs - minuteStartMs >= 60000UL) {
+    minuteStartMs += 60000UL;
+    closeMinute();
+  }
+}
+
+void ThroughputSeries::recordIssue(int estimatedWaitSec) {
+  minuteAcc.issued++;
+  minuteAcc.estWaitSum += (estimatedWaitSec > 0) ? estimatedWaitSec : 0;
+  minuteAcc.estWaitCount++;
+}
+
+void ThroughputSeries::recordServe(int actualWaitSec) {
+  minuteAcc.served++;
+  minuteAcc.actualWaitSum += (actualWaitSec > 0) ? actualWaitSec : 0;
+  minuteAcc.actualWaitCount++;
+}
+
+void ThroughputSeries::closeMinute() {
+  minutes[minuteHead] = minuteAcc.toBucket();
+  minuteHead = (minuteHead + 1) % SERIES_MINUTE_BUCKETS;
+  if (minuteFilled < SERIES_MINUTE_BUCKETS) minuteFilled++;
+
+  hourAcc.merge(minuteAcc);
+  minuteAcc.reset();
+  if (++minutesInHour >= 60) {
+    minutesInHour = 0;
+    closeHour();
+  }
+}
+
+void ThroughputSeries::closeHour() {
+  hours[hourHead] = hourAcc.toBucket();
+  hourHead = (hourHead + 1) % SERIES_HOUR_BUCKETS;
+  if (hourFilled < SERIES_HOUR_BUCKETS) hourFilled++;
+
+  dayAcc.merge(hourAcc);
+  hourAcc.reset();
+  if (++hoursInDay >= 24) {
+    hoursInDay = 0;
+    closeDay();
+  }
+}
+
+void ThroughputSeries::closeDay() {
+  SeriesBucket bucket = dayAcc.toBucket();
+  days[dayHead] = bucket;
+  dayHead = (dayHead + 1) % SERIES_DAY_BUCKETS;
+  if (dayFilled < SERIES_DAY_BUCKETS) dayFilled++;
+  dayAcc.reset();
+  spillDay(bucket);
+}
+
+#ifdef QMS_SERIES_SPILL
+void ThroughputSeries::spillDay(const SeriesBucket& bucket) {
+  File f = SPIFFS.open(SERIES_SPILL_PATH, FILE_APPEND);
+  if (!f) return;
+  f.write((const uint8_t*)&bucket, sizeof(bucket));
+  size_t size = f.size();
+  f.close();
+  
+  // 1년치를 넘으면 최근 1년치만 남기고 다시 씀
+  if (size > sizeof(SeriesBucket) * SERIES_DAY_BUCKETS * 2) {
+    File out = SPIFFS.open(SERIES_SPILL_PATH, FILE_WRITE);
+    if (!out) return;
+    for (int i = 0; i < dayFilled; i++) {
+      const SeriesBucket& b = bucketAt(SERIES_DAY, i);
+      out.write((const uint8_t*)&b, sizeof(b));
+    }
+    out.close();
+  }
+}
+
+void ThroughputSeries::loadSpilledDays() {
+  if (!SPIFFS.begin(true)) return;
+  File f = SPIFFS.open(SERIES_SPILL_PATH, FILE_READ);
+  if (!f) return;
+  size_t records = f.size() / sizeof(SeriesBucket);
+  if (records > SERIES_DAY_BUCKETS) {
+    f.seek((records - SERIES_DAY_BUCKETS) * sizeof(SeriesBucket));
+  }
+  SeriesBucket b;
+  while (f.read((uint8_t*)&b, sizeof(b)) == sizeof(b)) {
+    days[dayHead] = b;
+    dayHead = (dayHead + 1) % SERIES_DAY_BUCKETS;
+    if (dayFilled < SERIES_DAY_BUCKETS) dayFilled++;
+  }
+  f.close();
+}
+#else
+void ThroughputSeries::spillDay(const SeriesBucket& bucket) {}
+void ThroughputSeries::loadSpilledDays() {}
+#endif
+
+int ThroughputSeries::bucketCount(SeriesResolution res) const {
+  if (res == SERIES_MINUTE) return minuteFilled;
+  if (res == SERIES_HOUR) return hourFilled;
+  return dayFilled;
+}
+
+const SeriesBucket& ThroughputSeries::bucketAt(SeriesResolution res, int index) const {
+  if (res == SERIES_MINUTE) {
+    int start = (minuteHead + SERIES_MINUTE_BUCKETS - minuteFilled) % SERIES_MINUTE_BUCKETS;
+    return minutes[(start + index) % SERIES_MINUTE_BUCKETS];
+  }
+  if (res == SERIES_HOUR) {
+    int start = (hourHead + SERIES_HOUR_BUCKETS - hourFilled) % SERIES_HOUR_BUCKETS;
+    return hours[(start + index) % SERIES_HOUR_BUCKETS];
+  }
+  int start = (dayHead + SERIES_DAY_BUCKETS - dayFilled) % SERIES_DAY_BUCKETS;
+  return days[(start + index) % SERIES_DAY_BUCKETS];
+}
+
+static uint16_t metricValue(const SeriesBucket& b, SeriesMetric metric) {
+  switch (metric) {
+    case METRIC_SERVED: return b.served;
+    case METRIC_ISSUED: return b.issued;
+    case METRIC_QUEUE: return b.queueAvg;
+    case METRIC_WAIT: return b.actualWaitSec;
+  }
+  return 0;
+}
+
+int ThroughputSeries::buildColumns(SeriesResolution res, SeriesMetric metric, uint8_t* heights, uint8_t* markers,
+                                   int maxCols, uint8_t maxHeight, uint16_t& peak) const {
+  int count = bucketCount(res);
+  peak = 0;
+  if (count == 0 || maxCols <= 0) return 0;
+
+  // 열 하나에 묶을 버킷 수 (합계형 지표는 더하고, 평균형 지표는 평균)
+  int group = (count + maxCols - 1) / maxCols;
+  int cols = (count + group - 1) / group;
+  bool additive = (metric == METRIC_SERVED || metric == METRIC_ISSUED);
+  uint16_t values[SERIES_DAY_BUCKETS];
+  uint16_t estimates[SERIES_DAY_BUCKETS];
+
+  for (int c = 0; c < cols; c++) {
+    uint32_t sum = 0, estSum = 0;
+    int n = 0;
+    for (int i = c * group; i < (c + 1) * group && i < count; i++, n++) {
+      const SeriesBucket& b = bucketAt(res, i);
+      sum += metricValue(b, metric);
+      estSum += b.estWaitSec;
+    }
+    uint32_t v = additive ? sum : sum / n;
+    values[c] = (v > 0xFFFF) ? 0xFFFF : (uint16_t)v;
+    estimates[c] = (uint16_t)(estSum / n);
+    if (values[c] > peak) peak = values[c];
+    if (metric == METRIC_WAIT && estimates[c] > peak) peak = estimates[c];
+  }
+
+  for (int c = 0; c < cols; c++) {
+    heights[c] = peak ? (uint8_t)((uint32_t)values[c] * maxHeight / peak) : 0;
+    if (markers) {
+      markers[c] = (peak && metric == METRIC_WAIT) ? (uint8_t)((uint32_t)estimates[c] * maxHeight / peak) : 0;
+    }
+  }
+  return cols;
+}
@@ -0,0 +1,163 @@
+#include "ticket_log.h"
+
+// ===== StreamingQuantile (P² 알고리즘) =====
+
+StreamingQuantile::StreamingQuantile(float quantile) : p(quantile) {
+  reset();
+}
+
+void StreamingQuantile::reset() {
+  count = 0;
+  for (int i = 0; i < 5; i++) {
+    q[i] = 0;
+    n[i] = i;
+  }
+  np[0] = 0;
+  np[1] = 2 * p;
+  np[2] = 4 * p;
+  np[3] = 2 + 2 * p;
+  np[4] = 4;
+  dn[0] = 0;
+  dn[1] = p / 2;
+  dn[2] = p;
+  dn[3] = (1 + p) / 2;
+  dn[4] = 1;
+}
+
+void StreamingQuantile::add(float x) {
+  // 처음 5개는 정렬해서 마커 초기값으로 사용
+  if (count < 5) {
+    int i = count;
+    while (i > 0 && q[i - 1] > x) {
+      q[i] = q[i - 1];
+      i--;
+    }
+    q[i] = x;
+    count++;
+    return;
+  }
+  count++;
+
+  // x가 들어갈 구간 찾기 (양 끝 마커는 최소/최대로 갱신)
+  int k;
+  if (x < q[0]) {
+    q[0] = x;
+    k = 0;
+  } else if (x >= q[4]) {
+    q[4] = x;
+    k = 3;
+  } else {
+    k = 0;
+    while (k < 3 && x >= q[k + 1]) k++;
+  }
+
+  for (int i = k + 1; i < 5; i++) n[i] += 1;
+  for (int i = 0; i < 5; i++) np[i] += dn[i];
+
+  // 중간 마커 3개를 목표 위치로 보정
+  for (int i = 1; i < 4; i++) {
+    float d = np[i] - n[i];
+    if ((d >= 1 && n[i + 1] - n[i] > 1) || (d <= -1 && n[i - 1] - n[i] < -1)) {
+      float ds = (d > 0) ? 1.0f : -1.0f;
+      // 포물선 보간
+      float qp = q[i] + ds / (n[i + 1] - n[i - 1]) *
+                 ((n[i] - n[i - 1] + ds) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                  (n[i + 1] - n[i] - ds) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+      if (q[i - 1] < qp && qp < q[i + 1]) {
+        q[i] = qp;
+      } else {
+        // 단조성이 깨지면 선형 보간
+        int j = i + (int)ds;
+        q[i] = q[i] + ds * (q[j] - q[i]) / (n[j] - n[i]);
+      }
+      n[i] += ds;
+    }
+  }
+}
+
+float StreamingQuantile::value() const {
+  if (count == 0) return 0;
+  if (count <= 5) {
+    // 표본이 적을 때는 정렬된 값에서 직접 선택 (5개째까지는 마커가 아직 보정 전이라 q[2] 는 항상 중앙값)
+    return q[(int)(p * (count - 1) + 0.5f)];
+  }
+  return q[2];
+}
+
+// ===== TicketLog =====
+
+TicketLog::TicketLog()
+    : baseMs(0), waitP50(0.5f), waitP90(0.9f), serviceP50(0.5f), serviceP90(0.9f) {
+  for (int i = 0; i < TICKET_ARENA_SIZE; i++) {
+    ids[i] = 0;
+    issueMs[i] = TICKET_TIME_NONE;
+    callMs[i] = TICKET_TIME_NONE;
+    serveMs[i] = TICKET_TIME_NONE;
+    classes[i] = TICKET_CLASS_KIOSK;
+  }
+}
+
+void TicketLog::begin(unsigned long nowMs) {
+  baseMs = nowMs;
+}
+
+int TicketLog::findSlot(uint16_t id) const {
+  int slot = id % TICKET_ARENA_SIZE;
+  if (ids[slot] != id || issueMs[slot] == TICKET_TIME_NONE) return -1;
+  return slot;
+}
+
+void TicketLog::issue(uint16_t id, uint8_t ticketClass, unsigned long nowMs) {
+  int slot = id % TICKET_ARENA_SIZE;
+  ids[slot] = id;
+  issueMs[slot] = nowMs - baseMs;
+  callMs[slot] = TICKET_TIME_NONE;
+  serveMs[slot] = TICKET_TIME_NONE;
+  classes[slot] = ticketClass;
+}
+
+void TicketLog::call(uint16_t id, unsigned long nowMs) {
+  int slot = findSlot(id);
+  if (slot < 0 || callMs[slot] != TICKET_TIME_NONE) return;
+  callMs[slot] = nowMs - baseMs;
+}
+
+bool TicketLog::serve(uint16_t id, unsigned long nowMs) {
+  int slot = findSlot(id);
+  if (slot < 0 || serveMs[slot] != TICKET_TIME_NONE) return false;
+
+  uint32_t now = nowMs - baseMs;
+  if (callMs[slot] == TICKET_TIME_NONE) callMs[slot] = now;
+  serveMs[slot] = now;
+
+  // 처리 완료 시점에 통계 갱신 (과거 레코드 재탐색 없음)
+  float waitMs = (float)(callMs[slot] - issueMs[slot]);
+  float serviceMs = (float)(serveMs[slot] - callMs[slot]);
+  waitP50.add(waitMs);
+  waitP90.add(waitMs);
+  serviceP50.add(serviceMs);
+  serviceP90.add(serviceMs);
+  return true;
+}
+
+void TicketLog::cancel(uint16_t id) {
+  int slot = findSlot(id);
+  // 처리 완료된 레코드는 통계에 이미 반영됐으므로 유지
+  if (slot < 0 || serveMs[slot] != TICKET_TIME_NONE) return;
+  issueMs[slot] = TICKET_TIME_NONE;
+}
+
+uint32_t TicketLog::issuedAt(uint16_t id) const {
+  int slot = findSlot(id);
+  return (slot < 0) ? TICKET_TIME_NONE : issueMs[slot];
+}
+
+uint32_t TicketLog::calledAt(uint16_t id) const {
+  int slot = findSlot(id);
+  return (slot < 0) ? TICKET_TIME_NONE : callMs[slot];
+}
+
+uint32_t TicketLog::servedAt(uint16_t id) const {
+  int slot = findSlot(id);
+  return (slot < 0) ? TICKET_TIME_NONE : serveMs[slot];
+}
@@ -1,13 +1,77 @@
 #include "touch.h"
+#include "spi_bus.h"
+#include "profile.h"
 #include <Arduino.h>
 
+#if defined(TOUCH_HAS_OWN_BUS) && defined(ARDUINO_ARCH_ESP32)
+#define TOUCH_TASK_SUPPORTED 1
+static portMUX_TYPE latestMux = portMUX_INITIALIZER_UNLOCKED;
+static uint32_t samplingPeriodMs = TOUCH_TASK_PERIOD_MS;
+#endif
+
 TouchModule::TouchModule(int width, int height) 
-    : ts(TOUCH_CS, TOUCH_IRQ), screenWidth(width), screenHeight(height) {}
+    : ts(TOUCH_CS, TOUCH_IRQ), screenWidth(width), screenHeight(height),
+      replaying(false), replayStartUs(0), samplingTask(false) {
+    latest.timeUs = 0;
+    latest.down = false;
+    latest.x = latest.y = latest.z = 0;
+}
 
 void TouchModule::begin() {
     ts.begin();
 }
 
+bool TouchModule::startSamplingTask(uint32_t periodMs) {
+#ifdef TOUCH_TASK_SUPPORTED
+    if (samplingTask || periodMs == 0) return samplingTask;
+    samplingPeriodMs = periodMs;
+    // loop() 는 코어 1 에서 돌기 때문에 샘플링은 코어 0 에 둠
+    samplingTask = xTaskCreatePinnedToCore(samplingLoop, "touch", 3072, this, 2, nullptr, 0) == pdPASS;
+    return samplingTask;
+#else
+    (void)periodMs;
+    return false;
+#endif
+}
+
+void TouchModule::samplingLoop(void* arg) {
+#ifdef TOUCH_TASK_SUPPORTED
+    TouchModule* self = (TouchModule*)arg;
+    for (;;) {
+        TouchSample s = self->readLive();
+        portENTER_CRITICAL(&latestMux);
+        self->latest = s;
+        portEXIT_CRITICAL(&latestMux);
+        vTaskDelay(pdMS_TO_TICKS(samplingPeriodMs));
+    }
+#else
+    (void)arg;
+#endif
+}
+
+// 컨트롤러에서 직접 한 샘플 읽기
+TouchSample TouchModule::readLive() {
+    QMS_PROFILE_SCOPE("touch read");
+    TouchSample s;
+#if QMS_TOUCH_BUS == TOUCH_BUS_SHARED
+    // TFT 와 같은 버스 - 전송 중이면 끝날 때까지 대기 (별도 버스 드라이버는 자체적으로 잠금)
+    touchBus.acquire(touchDevice);
+#endif
+    s.timeUs = micros();
+    s.down = isTouched();
+    s.x = s.y = s.z = 0;
+    if (s.down) {
+        TS_Point p = getRawPoint();
+        s.x = p.x;
+        s.y = p.y;
+        s.z = p.z;
+    }
+#if QMS_TOUCH_BUS == TOUCH_BUS_SHARED
+    touchBus.release();
+#endif
+    return s;
+}
+
 bool TouchModule::isTouched() {
     return ts.touched();
 }
@@ -44,3 +108,61 @@ void TouchModule::printRawCoordinates() {
         Serial.println(p.y);
     }
 }
+
+TouchSample TouchModule::sample() {
+    TouchSample s;
+    
+    if (replaying) {
+        // 기록 당시 간격에 맞춰 한 샘플씩 공급
+        uint32_t offsetUs;
+        if (player.peekTime(offsetUs)) {
+            while (micros() - replayStartUs < offsetUs) {
+                yield();
+            }
+        }
+        if (player.next(s)) {
+            return s;
+        }
+        replaying = false;
+    }
+    
+#ifdef TOUCH_TASK_SUPPORTED
+    if (samplingTask) {
+        // 샘플링 태스크가 마지막으로 읽은 값
+        portENTER_CRITICAL(&latestMux);
+        s = latest;
+        portEXIT_CRITICAL(&latestMux);
+    } else {
+        s = readLive();
+    }
+#else
+    s = readLive();
+#endif
+    if (recorder.active()) {
+        recorder.add(s);
+    }
+    return s;
+}
+
+void TouchModule::toScreen(const TouchSample& s, int& screenX, int& screenY) {
+    // 축 교환: Raw X → Screen Y, Raw Y → Screen X
+    screenX = mapY(s.y);
+    screenY = mapX(s.x);
+}
+
+void TouchModule::startRecording(Print& output) {
+    recorder.begin(output, micros());
+}
+
+uint32_t TouchModule::stopRecording() {
+    uint32_t count = recorder.samples();
+    recorder.end();
+    return count;
+}
+
+bool TouchModule::startReplay(const uint8_t* buffer, size_t len) {
+    if (!player.begin(buffer, len)) return false;
+    replaying = true;
+    replayStartUs = micros();
+    return true;
+}
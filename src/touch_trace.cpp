@@ -0,0 +1,146 @@
+#include "touch_trace.h"
+
+uint8_t traceCrc8(const uint8_t* data, size_t len) {
+  // CRC-8 (다항식 0x07)
+  uint8_t crc = 0;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (int b = 0; b < 8; b++) {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static uint8_t encodeVarint(uint32_t value, uint8_t* out) {
+  uint8_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+static uint16_t clamp12(int16_t v) {
+  if (v < 0) return 0;
+  if (v > 4095) return 4095;
+  return (uint16_t)v;
+}
+
+// ===== TouchTraceWriter =====
+
+TouchTraceWriter::TouchTraceWriter() : out(nullptr), used(0), lastUs(0), sampleCount(0) {}
+
+void TouchTraceWriter::begin(Print& output, uint32_t nowUs) {
+  out = &output;
+  used = 0;
+  lastUs = nowUs;
+  sampleCount = 0;
+  put((const uint8_t*)TRACE_MAGIC, TRACE_MAGIC_LEN);
+}
+
+void TouchTraceWriter::put(const uint8_t* data, uint8_t len) {
+  // 레코드가 프레임 경계에 걸리지 않게 먼저 비움
+  if (used + len > TRACE_FRAME_MAX) flush();
+  memcpy(frame + used, data, len);
+  used += len;
+}
+
+void TouchTraceWriter::flush() {
+  if (!out || used == 0) return;
+  uint8_t head[3] = {TRACE_FRAME_SYNC, TRACE_FRAME_TYPE, used};
+  out->write(head, 3);
+  out->write(frame, used);
+  out->write(traceCrc8(frame, used));
+  used = 0;
+}
+
+void TouchTraceWriter::add(const TouchSample& sample) {
+  if (!out) return;
+  uint8_t rec[10];
+  uint32_t dt = sample.timeUs - lastUs;
+  lastUs = sample.timeUs;
+  // 시간차가 31비트를 넘으면 잘라서 기록 (71분 이상 공백)
+  if (dt > 0x7FFFFFFFUL) dt = 0x7FFFFFFFUL;
+  uint8_t n = encodeVarint((dt << 1) | (sample.down ? 1 : 0), rec);
+  if (sample.down) {
+    uint16_t x = clamp12(sample.x), y = clamp12(sample.y), z = clamp12(sample.z);
+    rec[n++] = x & 0xFF;
+    rec[n++] = (uint8_t)((x >> 8) | ((y & 0x0F) << 4));
+    rec[n++] = (uint8_t)(y >> 4);
+    rec[n++] = z & 0xFF;
+    rec[n++] = (uint8_t)(z >> 8);
+  }
+  put(rec, n);
+  sampleCount++;
+}
+
+void TouchTraceWriter::end() {
+  flush();
+  out = nullptr;
+}
+
+// ===== TouchTraceReader =====
+
+TouchTraceReader::TouchTraceReader() : data(nullptr), length(0), pos(0), timeUs(0) {}
+
+bool TouchTraceReader::begin(const uint8_t* buffer, size_t len) {
+  data = nullptr;
+  if (len < TRACE_MAGIC_LEN || memcmp(buffer, TRACE_MAGIC, TRACE_MAGIC_LEN) != 0) return false;
+  data = buffer;
+  length = len;
+  pos = TRACE_MAGIC_LEN;
+  timeUs = 0;
+  return true;
+}
+
+bool TouchTraceReader::peekTime(uint32_t& nextUs) const {
+  if (atEnd()) return false;
+  uint32_t value = 0;
+  size_t p = pos;
+  for (int shift = 0; p < length && shift < 35; shift += 7) {
+    uint8_t b = data[p++];
+    value |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) {
+      nextUs = timeUs + (value >> 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool TouchTraceReader::next(TouchSample& sample) {
+  if (atEnd()) return false;
+  uint32_t value = 0;
+  bool done = false;
+  for (int shift = 0; pos < length && shift < 35; shift += 7) {
+    uint8_t b = data[pos++];
+    value |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) {
+      done = true;
+      break;
+    }
+  }
+  if (!done) {
+    pos = length;
+    return false;
+  }
+
+  timeUs += value >> 1;
+  sample.timeUs = timeUs;
+  sample.down = value & 1;
+  sample.x = sample.y = sample.z = 0;
+  if (sample.down) {
+    if (pos + 5 > length) {
+      pos = length;
+      return false;
+    }
+    const uint8_t* r = data + pos;
+    sample.x = r[0] | ((r[1] & 0x0F) << 8);
+    sample.y = (r[1] >> 4) | (r[2] << 4);
+    sample.z = r[3] | ((r[4] & 0x0F) << 8);
+    pos += 5;
+  }
+  return true;
+}
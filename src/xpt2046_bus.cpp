@@ -0,0 +1,122 @@
+#include "xpt2046_bus.h"
+#include "board.h"
+
+#define XPT_Z_THRESHOLD   300
+#define XPT_MSEC_THRESHOLD 3   // 이보다 짧은 간격의 재측정은 이전 값 사용
+
+// 비트뱅 반주기 (us) - XPT2046 최대 2.5MHz 보다 충분히 느리게
+#define XPT_SOFT_HALF_PERIOD_US ((500000UL / TOUCH_SPI_HZ) > 0 ? (500000UL / TOUCH_SPI_HZ) : 1)
+
+Xpt2046Bus::Xpt2046Bus(uint8_t cs, uint8_t irq)
+  : csPin(cs), irqPin(irq), xraw(0), yraw(0), zraw(0), msraw(0x80000000) {}
+
+bool Xpt2046Bus::begin() {
+  pinMode(csPin, OUTPUT);
+  digitalWrite(csPin, HIGH);
+  if (irqPin != 255) pinMode(irqPin, INPUT);
+  touchBus.begin();
+#if QMS_TOUCH_BUS == TOUCH_BUS_SOFT
+  pinMode(TOUCH_SCLK, OUTPUT);
+  pinMode(TOUCH_MOSI, OUTPUT);
+  pinMode(TOUCH_MISO, INPUT);
+  digitalWrite(TOUCH_SCLK, LOW);
+#else
+  touchBus.spi().begin(TOUCH_SCLK, TOUCH_MISO, TOUCH_MOSI, -1);
+#endif
+  return true;
+}
+
+bool Xpt2046Bus::touched() {
+  update();
+  return zraw >= XPT_Z_THRESHOLD;
+}
+
+TS_Point Xpt2046Bus::getPoint() {
+  update();
+  return TS_Point(xraw, yraw, zraw);
+}
+
+void Xpt2046Bus::select() {
+  touchBus.acquire(touchDevice);
+#if QMS_TOUCH_BUS != TOUCH_BUS_SOFT
+  touchBus.spi().beginTransaction(touchDevice.settings);
+#endif
+  digitalWrite(csPin, LOW);
+}
+
+void Xpt2046Bus::deselect() {
+  digitalWrite(csPin, HIGH);
+#if QMS_TOUCH_BUS != TOUCH_BUS_SOFT
+  touchBus.spi().endTransaction();
+#endif
+  touchBus.release();
+}
+
+uint8_t Xpt2046Bus::transfer(uint8_t data) {
+#if QMS_TOUCH_BUS == TOUCH_BUS_SOFT
+  // SPI 모드 0, MSB 먼저
+  uint8_t in = 0;
+  for (int bit = 7; bit >= 0; bit--) {
+    digitalWrite(TOUCH_MOSI, (data >> bit) & 1);
+    delayMicroseconds(XPT_SOFT_HALF_PERIOD_US);
+    digitalWrite(TOUCH_SCLK, HIGH);
+    in = (in << 1) | (digitalRead(TOUCH_MISO) & 1);
+    delayMicroseconds(XPT_SOFT_HALF_PERIOD_US);
+    digitalWrite(TOUCH_SCLK, LOW);
+  }
+  return in;
+#else
+  return touchBus.spi().transfer(data);
+#endif
+}
+
+uint16_t Xpt2046Bus::transfer16(uint16_t data) {
+  uint16_t high = transfer(data >> 8);
+  return (high << 8) | transfer(data & 0xFF);
+}
+
+// 세 측정값 중 가장 가까운 두 값의 평균
+static int16_t bestTwoAverage(int16_t x, int16_t y, int16_t z) {
+  int16_t da = (x > y) ? x - y : y - x;
+  int16_t db = (x > z) ? x - z : z - x;
+  int16_t dc = (z > y) ? z - y : y - z;
+  if (da <= db && da <= dc) return (x + y) >> 1;
+  if (db <= da && db <= dc) return (x + z) >> 1;
+  return (y + z) >> 1;
+}
+
+void Xpt2046Bus::update() {
+  uint32_t now = millis();
+  if (now - msraw < XPT_MSEC_THRESHOLD) return;
+
+  int16_t data[6];
+  select();
+  transfer(0xB1);                            // Z1
+  int16_t z1 = transfer16(0xC1) >> 3;        // Z2
+  int z = z1 + 4095;
+  int16_t z2 = transfer16(0x91) >> 3;        // X
+  z -= z2;
+  if (z >= XPT_Z_THRESHOLD) {
+    transfer16(0x91);                        // 첫 X 측정은 노이즈가 커서 버림
+    data[0] = transfer16(0xD1) >> 3;
+    data[1] = transfer16(0x91) >> 3;
+    data[2] = transfer16(0xD1) >> 3;
+    data[3] = transfer16(0x91) >> 3;
+  } else {
+    data[0] = data[1] = data[2] = data[3] = 0;
+  }
+  data[4] = transfer16(0xD0) >> 3;           // 마지막 Y 측정 후 전원 절약 모드
+  data[5] = transfer16(0) >> 3;
+  deselect();
+
+  if (z < 0) z = 0;
+  if (z < XPT_Z_THRESHOLD) {
+    zraw = 0;
+    return;
+  }
+  zraw = z;
+  // 응답은 다음 명령을 보낼 때 나옴 → data 짝수 = X, 홀수 = Y (라이브러리 기본 회전 1 과 동일)
+  xraw = bestTwoAverage(data[0], data[2], data[4]);
+  yraw = bestTwoAverage(data[1], data[3], data[5]);
+  msraw = now;
+}
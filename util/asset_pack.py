@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""
+에셋 파티션 이미지 패커
+- util/sprite_atlas.py 와 같은 방식으로 아이콘들을 팔레트 인덱스 아틀라스로 묶어
+  펌웨어가 esp_partition_mmap 으로 매핑해서 복사 없이 바로 그리는 바이너리 이미지로 저장
+- 펌웨어는 이름으로 스프라이트를 찾으므로 (include/ui_atlas.h 의 이름) 순서는 상관없음
+- 브랜딩을 바꿀 때 펌웨어를 다시 빌드하지 않고 이 이미지만 assets 파티션에 올림
+
+포맷은 include/asset_partition.h 참고
+"""
+
+import argparse
+import importlib.util
+import os
+import struct
+import sys
+import zlib
+
+_spec = importlib.util.spec_from_file_location(
+    "sprite_atlas", os.path.join(os.path.dirname(os.path.abspath(__file__)), "sprite_atlas.py"))
+sprite_atlas = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(sprite_atlas)
+icon_input = sprite_atlas.icon_input
+
+MAGIC = b"QMSA"
+VERSION = 1
+HEADER_SIZE = 48
+RECT_SIZE = 12      # SpriteRect (uint32 + uint16 x3 + 패딩)
+NAME_LEN = 16       # ASSET_NAME_LEN
+PARTITION_SIZE = 0x10000  # partitions.csv 의 assets 크기
+
+
+def align(n, k):
+    return (n + k - 1) // k * k
+
+
+def pack(sprites, bits, palette_mode):
+    mode, palette, data, rects, lossy = sprite_atlas.build_atlas(sprites, bits, palette_mode)
+
+    rects_offset = HEADER_SIZE
+    names_offset = rects_offset + len(rects) * RECT_SIZE
+    palette_offset = names_offset + len(rects) * NAME_LEN
+    pixels_offset = align(palette_offset + len(palette) * 2, 4)
+    image_size = align(pixels_offset + len(data), 4)
+
+    body = bytearray(image_size - HEADER_SIZE)
+
+    def put(offset, blob):
+        body[offset - HEADER_SIZE:offset - HEADER_SIZE + len(blob)] = blob
+
+    for i, (name, offset, width, height, base) in enumerate(rects):
+        encoded = name.encode('ascii')
+        if len(encoded) >= NAME_LEN:
+            raise ValueError(f"이름이 너무 깁니다 (최대 {NAME_LEN - 1}자): {name}")
+        put(rects_offset + i * RECT_SIZE, struct.pack('<IHHHxx', offset, width, height, base))
+        put(names_offset + i * NAME_LEN, encoded.ljust(NAME_LEN, b'\0'))
+    put(palette_offset, struct.pack(f'<{len(palette)}H', *[icon_input.swap_bytes(c) for c in palette]))
+    put(pixels_offset, bytes(data))
+
+    header = struct.pack('<4sHHB3xIHxxIIIIIII', MAGIC, VERSION, len(rects), bits,
+                         palette_offset, len(palette), pixels_offset, len(data),
+                         rects_offset, names_offset, image_size, zlib.crc32(body), 0)
+    assert len(header) == HEADER_SIZE
+    return header + body, mode, palette, rects, lossy
+
+
+def dump(path):
+    with open(path, 'rb') as f:
+        image = f.read()
+    (magic, version, count, bits, palette_offset, palette_count, pixels_offset, pixels_size,
+     rects_offset, names_offset, image_size, crc, _) = struct.unpack_from('<4sHHB3xIHxxIIIIIII', image)
+    ok = magic == MAGIC and zlib.crc32(image[HEADER_SIZE:image_size]) == crc
+    print(f"{path}: {magic.decode(errors='replace')} v{version}, {count}개, {bits}비트, "
+          f"팔레트 {palette_count}색, {image_size}바이트, CRC {'OK' if ok else '불일치'}")
+    for i in range(count):
+        offset, width, height, base = struct.unpack_from('<IHHHxx', image, rects_offset + i * RECT_SIZE)
+        name = image[names_offset + i * NAME_LEN:names_offset + (i + 1) * NAME_LEN].rstrip(b'\0').decode()
+        print(f"  [{i}] {name:<15} {width}x{height}  인덱스 +{offset}  팔레트 +{base}")
+    return 0 if ok else 1
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="아이콘들을 에셋 파티션 이미지(assets.bin)로 묶음",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+사용 예시:
+  python util/asset_pack.py util/image/GoAdminBtn.png util/image/GoUserBtn.png -s 32x32 -o assets.bin
+  python util/asset_pack.py --dump assets.bin
+  esptool.py write_flash 0x3F0000 assets.bin   (partitions.csv 의 assets 위치)
+
+호스트 빌드는 QMS_HOST_PARTITIONS=<디렉터리> 에서 <파티션 이름>.bin 을 매핑
+        """
+    )
+    parser.add_argument('images', nargs='*', help='묶을 이미지 파일들 또는 헤더 (.h)')
+    parser.add_argument('-o', '--output', default='assets.bin', help='출력 이미지 경로')
+    parser.add_argument('-s', '--size', type=icon_input.parse_size, default=None,
+                        help='이미지 입력을 이 크기로 조정 WxH (기본: 원본 크기)')
+    parser.add_argument('-b', '--bits', type=int, choices=[4, 8], default=8, help='픽셀당 인덱스 비트 (기본 8)')
+    parser.add_argument('--palette', choices=['auto', 'shared', 'sprite'], default='auto',
+                        help='팔레트 공유 방식 (기본 auto)')
+    parser.add_argument('--no-invert', action='store_true', help='패널 색 반전을 적용하지 않음')
+    parser.add_argument('--dump', metavar='IMAGE', help='이미지 내용을 출력')
+    args = parser.parse_args()
+
+    if args.dump:
+        return dump(args.dump)
+    if not args.images:
+        parser.error("묶을 이미지가 없습니다")
+
+    try:
+        sprites = sprite_atlas.load_sprites(args.images, args.size, not args.no_invert)
+        image, mode, palette, rects, lossy = pack(sprites, args.bits, args.palette)
+    except ValueError as e:
+        print(f"❌ {e}")
+        return 1
+    if len(image) > PARTITION_SIZE:
+        print(f"❌ 이미지 {len(image)}바이트가 파티션({PARTITION_SIZE}바이트)보다 큽니다")
+        return 1
+
+    with open(args.output, 'wb') as f:
+        f.write(image)
+    print(f"✅ 에셋 이미지 생성: {args.output}")
+    print(f"   스프라이트 {len(rects)}개, {args.bits}비트 인덱스, "
+          f"{'공유' if mode == 'shared' else '스프라이트별'} 팔레트 {len(palette)}색, {len(image)}바이트")
+    if lossy:
+        print(f"⚠️  색 수를 줄임 (손실): {', '.join(lossy)}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,57 @@
+// 호스트 빌드용 Adafruit_SPITFT 대체 헤더
+// 패널 GRAM 을 메모리 프레임버퍼로 흉내 낸다.
+// setAddrWindow/startWrite/endWrite 는 실제 라이브러리처럼 가상 함수라
+// 파생 클래스에서 SPI 비용을 집계할 수 있다.
+#ifndef HOST_ADAFRUIT_SPITFT_H
+#define HOST_ADAFRUIT_SPITFT_H
+
+#include <Adafruit_GFX.h>
+#include <SPI.h>
+
+class Adafruit_SPITFT : public Adafruit_GFX {
+public:
+  Adafruit_SPITFT(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {}
+
+  virtual void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) = 0;
+
+  void startWrite() override {}
+  void endWrite() override {}
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void writePixel(int16_t x, int16_t y, uint16_t color) override;
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h);
+  using Adafruit_GFX::drawRGBBitmap;
+
+  void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false);
+  void writeColor(uint16_t color, uint32_t len);
+  void pushColor(uint16_t color) { writeColor(color, 1); }
+  void writeCommand(uint8_t cmd) { lastCommand = cmd; }
+  void sendCommand(uint8_t commandByte, const uint8_t *dataBytes = nullptr, uint8_t numDataBytes = 0);
+  void setSPISpeed(uint32_t freq) { spiFreq = freq; }
+  void initSPI(uint32_t freq = 0, uint8_t spiMode = 0) { spiFreq = freq; }
+  void SPI_WRITE16(uint16_t w) { writeColor(w, 1); }
+
+  // ===== 호스트 전용: 패널 상태 조회 =====
+  const uint16_t *hostGram() const { return gram; }
+  uint16_t hostGramAt(int16_t x, int16_t y) const { return gram[y * WIDTH + x]; }
+  // 수직 스크롤(VSCRDEF/VSCSAD)을 반영해 실제 보이는 화면을 out 에 복사
+  void hostScanout(uint16_t *out) const;
+
+protected:
+  void hostWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+  uint16_t gram[320 * 240] = {0};
+  uint16_t winX = 0, winY = 0, winW = 0, winH = 0;
+  uint32_t winPos = 0;
+  uint8_t lastCommand = 0;
+  uint32_t spiFreq = 0;
+  int8_t _rst = -1;
+  uint16_t scrollTop = 0, scrollArea = 320, scrollBottom = 0, scrollStart = 0;
+};
+
+#endif
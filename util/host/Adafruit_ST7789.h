@@ -0,0 +1,18 @@
+// 호스트 빌드용 Adafruit_ST7789 대체 헤더
+#ifndef HOST_ADAFRUIT_ST7789_H
+#define HOST_ADAFRUIT_ST7789_H
+
+#include <Adafruit_ST77xx.h>
+
+class Adafruit_ST7789 : public Adafruit_ST77xx {
+public:
+  Adafruit_ST7789(int8_t cs, int8_t dc, int8_t rst) : Adafruit_ST77xx(240, 320) { _rst = rst; }
+  Adafruit_ST7789(SPIClass *spiClass, int8_t cs, int8_t dc, int8_t rst) : Adafruit_ST77xx(240, 320) {}
+  void init(uint16_t width, uint16_t height, uint8_t spiMode = SPI_MODE0) {
+    WIDTH = _width = width;
+    HEIGHT = _height = height;
+  }
+  void setRotation(uint8_t m) override { rotation = m & 3; }
+};
+
+#endif
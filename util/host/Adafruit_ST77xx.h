@@ -0,0 +1,28 @@
+// 호스트 빌드용 Adafruit_ST77xx 대체 헤더
+#ifndef HOST_ADAFRUIT_ST77XX_H
+#define HOST_ADAFRUIT_ST77XX_H
+
+#include <Adafruit_SPITFT.h>
+
+#define ST77XX_SWRESET 0x01
+#define ST77XX_SLPOUT 0x11
+#define ST77XX_NORON 0x13
+#define ST77XX_INVON 0x21
+#define ST77XX_DISPON 0x29
+#define ST77XX_CASET 0x2A
+#define ST77XX_RASET 0x2B
+#define ST77XX_RAMWR 0x2C
+#define ST77XX_MADCTL 0x36
+#define ST77XX_COLMOD 0x3A
+#define ST77XX_MADCTL_MY 0x80
+#define ST77XX_MADCTL_MX 0x40
+#define ST77XX_MADCTL_RGB 0x00
+
+class Adafruit_ST77xx : public Adafruit_SPITFT {
+public:
+  Adafruit_ST77xx(uint16_t w, uint16_t h) : Adafruit_SPITFT(w, h) {}
+  void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) override { hostWindow(x, y, w, h); }
+  void enableDisplay(bool) {}
+};
+
+#endif
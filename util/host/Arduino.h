@@ -0,0 +1,133 @@
+// 호스트(native) 빌드용 Arduino 런타임 대체 헤더
+// - 시간은 hostClock으로 제어되는 가상 시계 (결정적 재생용)
+// - Serial 출력은 hostSerialSink 가 설정된 경우에만 기록
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#define PROGMEM
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+// ===== 가상 시계 =====
+extern uint64_t hostClockUs;
+inline unsigned long millis() { return (unsigned long)(hostClockUs / 1000); }
+inline unsigned long micros() { return (unsigned long)hostClockUs; }
+inline void delay(unsigned long ms) { hostClockUs += (uint64_t)ms * 1000; }
+inline void delayMicroseconds(unsigned int us) { hostClockUs += us; }
+inline void yield() {}
+
+// ESP32 CPU 사이클 카운터 (CCOUNT) - 가상 시계를 240MHz 로 환산
+class EspClass {
+public:
+  uint32_t getCycleCount() { return (uint32_t)(hostClockUs * 240); }
+  uint32_t getCpuFreqMHz() { return 240; }
+};
+extern EspClass ESP;
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::abs;
+using std::min;
+using std::max;
+
+// ===== String (사용하는 부분만) =====
+class String {
+public:
+  String() {}
+  String(const char *s) : s_(s ? s : "") {}
+  String(const std::string &s) : s_(s) {}
+  String(int v) : s_(std::to_string(v)) {}
+  String(unsigned int v) : s_(std::to_string(v)) {}
+  String(long v) : s_(std::to_string(v)) {}
+  String(unsigned long v) : s_(std::to_string(v)) {}
+  unsigned int length() const { return (unsigned int)s_.size(); }
+  const char *c_str() const { return s_.c_str(); }
+  char operator[](unsigned int i) const { return s_[i]; }
+  void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < s_.size()) s_.erase(index, count); }
+  String &operator+=(const char *s) { s_ += s; return *this; }
+  String &operator+=(const String &s) { s_ += s.s_; return *this; }
+  String &operator+=(char c) { s_ += c; return *this; }
+  bool operator==(const String &o) const { return s_ == o.s_; }
+  bool operator==(const char *o) const { return s_ == o; }
+  bool operator!=(const String &o) const { return s_ != o.s_; }
+  friend String operator+(const String &a, const String &b) { return String(a.s_ + b.s_); }
+private:
+  std::string s_;
+};
+
+// ===== Print / Serial =====
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buf, size_t n) {
+    for (size_t i = 0; i < n; i++) write(buf[i]);
+    return n;
+  }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(const char *s) { return write(s); }
+  size_t print(const String &s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v) { return printNum(std::to_string(v)); }
+  size_t print(unsigned int v) { return printNum(std::to_string(v)); }
+  size_t print(long v) { return printNum(std::to_string(v)); }
+  size_t print(unsigned long v) { return printNum(std::to_string(v)); }
+  size_t print(long long v) { return printNum(std::to_string(v)); }
+  size_t print(unsigned long long v) { return printNum(std::to_string(v)); }
+  size_t print(double v, int digits = 2) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return write(buf);
+  }
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T &v) { size_t n = print(v); return n + println(); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+private:
+  size_t printNum(const std::string &s) { return write(s.c_str()); }
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  void setRxBufferSize(size_t) {}
+  operator bool() const { return true; }
+  int available();
+  int read();
+  size_t read(uint8_t *buffer, size_t size);
+  int peek();
+  void flush() {}
+  size_t write(uint8_t c) override;
+  using Print::write;
+};
+extern HardwareSerial Serial;
+
+// 호스트 측 Serial 제어: 출력 싱크와 입력 주입
+extern FILE *hostSerialSink;
+void hostSerialInject(const uint8_t *data, size_t len);
+
+#endif
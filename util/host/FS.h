@@ -0,0 +1,44 @@
+// 호스트 빌드용 FS 대체 헤더
+// 파일은 QMS_HOST_FS 환경변수 디렉터리(기본 ./data) 아래의 실제 파일로 연결
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class File {
+public:
+  File(FILE *f = nullptr) : f(f) {}
+  operator bool() const { return f != nullptr; }
+  size_t size() const;
+  size_t read(uint8_t *buf, size_t len) { return f ? fread(buf, 1, len, f) : 0; }
+  int read() { return f ? fgetc(f) : -1; }
+  size_t write(const uint8_t *buf, size_t len) { return f ? fwrite(buf, 1, len, f) : 0; }
+  size_t write(uint8_t c) { return write(&c, 1); }
+  bool seek(uint32_t pos) { return f && fseek(f, pos, SEEK_SET) == 0; }
+  size_t position() const { return f ? ftell(f) : 0; }
+  void close() {
+    if (f) fclose(f);
+    f = nullptr;
+  }
+private:
+  FILE *f;
+};
+
+class FS {
+public:
+  File open(const char *path, const char *mode = FILE_READ);
+  bool exists(const char *path);
+  bool remove(const char *path);
+};
+
+}  // namespace fs
+
+using fs::File;
+
+#endif
@@ -0,0 +1,38 @@
+// 호스트 빌드용 SPI 대체 헤더 (버스 동작 없음)
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0
+#define SPI_MODE1 1
+#define SPI_MODE2 2
+#define SPI_MODE3 3
+#define MSBFIRST 1
+#define VSPI 3
+#define HSPI 2
+
+class SPISettings {
+public:
+  SPISettings() {}
+  SPISettings(uint32_t clock, uint8_t bitOrder, uint8_t dataMode)
+      : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+  uint32_t clock = 1000000;
+  uint8_t bitOrder = MSBFIRST;
+  uint8_t dataMode = SPI_MODE0;
+};
+
+class SPIClass {
+public:
+  explicit SPIClass(uint8_t bus = VSPI) : bus(bus) {}
+  void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+  void end() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  uint8_t transfer(uint8_t) { return 0; }
+  uint16_t transfer16(uint16_t) { return 0; }
+  uint8_t bus;
+};
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,14 @@
+// 호스트 빌드용 SPIFFS 대체 헤더
+#ifndef HOST_SPIFFS_H
+#define HOST_SPIFFS_H
+
+#include <FS.h>
+
+class SPIFFSFS : public fs::FS {
+public:
+  bool begin(bool formatOnFail = false) { return true; }
+  void end() {}
+};
+extern SPIFFSFS SPIFFS;
+
+#endif
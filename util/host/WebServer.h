@@ -0,0 +1,53 @@
+// 호스트 빌드용 WebServer 대체 헤더 (ESP32 WebServer 에서 쓰는 부분만)
+// 127.0.0.1 에서 실제로 듣고, 요청 하나를 받을 때마다 응답 후 연결을 닫음
+// 포트 80 은 권한이 필요하므로 QMS_HOST_HTTP_PORT (기본 8080) 로 바꿔 엶
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_POST };
+
+class WebServer {
+public:
+  typedef void (*THandlerFunction)();
+
+  explicit WebServer(int port = 80);
+  ~WebServer();
+  void begin();
+  void handleClient();
+  void on(const char *uri, HTTPMethod method, THandlerFunction handler);
+  void on(const char *uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+  void onNotFound(THandlerFunction handler) { notFound = handler; }
+
+  bool hasArg(const char *name) const;
+  String arg(const char *name) const;
+  String uri() const { return String(path); }
+
+  void sendHeader(const char *name, const char *value);
+  void setContentLength(size_t length) { contentLength = length; }
+  void send(int code, const char *contentType, const String &content);
+  void sendContent(const char *content, size_t length);
+
+private:
+  struct Route {
+    std::string uri;
+    HTTPMethod method;
+    THandlerFunction handler;
+  };
+  int port;
+  int listenFd;
+  int clientFd;
+  std::vector<Route> routes;
+  THandlerFunction notFound;
+  std::string path;
+  std::vector<std::pair<std::string, std::string>> args;
+  std::string headers;
+  size_t contentLength;
+
+  void writeAll(const char *data, size_t length);
+};
+
+#endif
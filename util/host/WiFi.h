@@ -0,0 +1,19 @@
+// 호스트 빌드용 WiFi 대체 헤더 - 항상 연결된 것으로 보고 루프백 주소를 알림
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+#define WIFI_STA 1
+#define WL_CONNECTED 3
+
+class WiFiClass {
+public:
+  bool mode(int) { return true; }
+  int begin(const char *, const char *) { return WL_CONNECTED; }
+  int status() { return WL_CONNECTED; }
+  String localIP() { return String("127.0.0.1"); }
+};
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,34 @@
+// 호스트 빌드용 XPT2046_Touchscreen 대체 헤더
+// 터치 샘플은 hostTouch 로 주입한다.
+#ifndef HOST_XPT2046_TOUCHSCREEN_H
+#define HOST_XPT2046_TOUCHSCREEN_H
+
+#include <Arduino.h>
+#include <SPI.h>
+
+class TS_Point {
+public:
+  TS_Point() : x(0), y(0), z(0) {}
+  TS_Point(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+  bool operator==(TS_Point p) { return p.x == x && p.y == y && p.z == z; }
+  bool operator!=(TS_Point p) { return !(*this == p); }
+  int16_t x, y, z;
+};
+
+// 호스트 측 가상 터치 입력 (z == 0 이면 펜 업)
+extern TS_Point hostTouch;
+
+class XPT2046_Touchscreen {
+public:
+  XPT2046_Touchscreen(uint8_t cs, uint8_t tirq = 255) {}
+  bool begin(SPIClass &wspi = SPI) { return true; }
+  TS_Point getPoint() { return hostTouch; }
+  bool tirqTouched() { return hostTouch.z > 0; }
+  bool touched() { return hostTouch.z > 0; }
+  void readData(uint16_t *x, uint16_t *y, uint8_t *z) { *x = hostTouch.x; *y = hostTouch.y; *z = hostTouch.z; }
+  bool bufferEmpty() { return true; }
+  uint8_t bufferSize() { return 1; }
+  void setRotation(uint8_t n) {}
+};
+
+#endif
@@ -0,0 +1,35 @@
+// 호스트 빌드용 파일 시스템 구현부
+#include <SPIFFS.h>
+
+SPIFFSFS SPIFFS;
+
+static std::string hostPath(const char *path) {
+  const char *root = getenv("QMS_HOST_FS");
+  return std::string(root ? root : "data") + path;
+}
+
+namespace fs {
+
+size_t File::size() const {
+  if (!f) return 0;
+  long pos = ftell(f);
+  fseek(f, 0, SEEK_END);
+  long end = ftell(f);
+  fseek(f, pos, SEEK_SET);
+  return (size_t)end;
+}
+
+File FS::open(const char *path, const char *mode) {
+  std::string m = std::string(mode) + "b";
+  return File(fopen(hostPath(path).c_str(), m.c_str()));
+}
+
+bool FS::exists(const char *path) {
+  FILE *f = fopen(hostPath(path).c_str(), "rb");
+  if (f) fclose(f);
+  return f != nullptr;
+}
+
+bool FS::remove(const char *path) { return ::remove(hostPath(path).c_str()) == 0; }
+
+}  // namespace fs
@@ -0,0 +1,319 @@
+// 호스트 빌드용 Adafruit GFX / SPITFT 구현부
+#include <Adafruit_ST7789.h>
+#include <XPT2046_Touchscreen.h>
+
+extern const uint8_t hostClassicFont[95 * 5];
+
+SPIClass SPI(VSPI);
+TS_Point hostTouch;
+
+template <typename T> static void swapT(T &a, T &b) { T t = a; a = b; b = t; }
+
+// ===== Adafruit_GFX =====
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  if (rotation & 1) { _width = HEIGHT; _height = WIDTH; }
+  else { _width = WIDTH; _height = HEIGHT; }
+}
+
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { swapT(x0, y0); swapT(x1, y1); }
+  if (x0 > x1) { swapT(x0, x1); swapT(y0, y1); }
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+  for (; x0 <= x1; x0++) {
+    if (steep) writePixel(y0, x0, color);
+    else writePixel(x0, y0, color);
+    err -= dy;
+    if (err < 0) { y0 += ystep; err += dx; }
+  }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  startWrite();
+  writeLine(x, y, x, y + h - 1, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  startWrite();
+  writeLine(x, y, x + w - 1, y, color);
+  endWrite();
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  for (int16_t i = x; i < x + w; i++) writeFastVLine(i, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  if (x0 == x1) {
+    if (y0 > y1) swapT(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+  } else if (y0 == y1) {
+    if (x0 > x1) swapT(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+  } else {
+    startWrite();
+    writeLine(x0, y0, x1, y1, color);
+    endWrite();
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  writeFastHLine(x, y + h - 1, w, color);
+  writeFastVLine(x, y, h, color);
+  writeFastVLine(x + w - 1, y, h, color);
+  endWrite();
+}
+
+void Adafruit_GFX::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+}
+
+void Adafruit_GFX::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  int16_t a, b, y, last;
+  if (y0 > y1) { swapT(y0, y1); swapT(x0, x1); }
+  if (y1 > y2) { swapT(y2, y1); swapT(x2, x1); }
+  if (y0 > y1) { swapT(y0, y1); swapT(x0, x1); }
+
+  startWrite();
+  if (y0 == y2) {
+    a = b = x0;
+    if (x1 < a) a = x1; else if (x1 > b) b = x1;
+    if (x2 < a) a = x2; else if (x2 > b) b = x2;
+    writeFastHLine(a, y0, b - a + 1, color);
+    endWrite();
+    return;
+  }
+
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+  last = (y1 == y2) ? y1 : y1 - 1;
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) swapT(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) swapT(a, b);
+    writeFastHLine(a, y, b - a + 1, color);
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+  startWrite();
+  for (int16_t j = 0; j < h; j++, y++) {
+    for (int16_t i = 0; i < w; i++) writePixel(x + i, y, pgm_read_word(&bitmap[j * w + i]));
+  }
+  endWrite();
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size_x, uint8_t size_y) {
+  if ((x >= _width) || (y >= _height) || ((x + 6 * size_x - 1) < 0) || ((y + 8 * size_y - 1) < 0)) return;
+  startWrite();
+  for (int8_t i = 0; i < 5; i++) {
+    uint8_t line = (c >= 0x20 && c < 0x7F) ? hostClassicFont[(c - 0x20) * 5 + i] : 0;
+    for (int8_t j = 0; j < 8; j++, line >>= 1) {
+      if (line & 1) {
+        if (size_x == 1 && size_y == 1) writePixel(x + i, y + j, color);
+        else writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, color);
+      } else if (bg != color) {
+        if (size_x == 1 && size_y == 1) writePixel(x + i, y + j, bg);
+        else writeFillRect(x + i * size_x, y + j * size_y, size_x, size_y, bg);
+      }
+    }
+  }
+  if (bg != color) {
+    if (size_x == 1 && size_y == 1) writeFastVLine(x + 5, y, 8, bg);
+    else writeFillRect(x + 5 * size_x, y, size_x, 8 * size_y, bg);
+  }
+  endWrite();
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += textsize_y * 8;
+  } else if (c != '\r') {
+    if (wrap && ((cursor_x + textsize_x * 6) > _width)) {
+      cursor_x = 0;
+      cursor_y += textsize_y * 8;
+    }
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+    cursor_x += textsize_x * 6;
+  }
+  return 1;
+}
+
+// ===== GFXcanvas16 =====
+
+GFXcanvas16::GFXcanvas16(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+  buffer = (uint16_t *)calloc((size_t)w * h, sizeof(uint16_t));
+}
+
+GFXcanvas16::~GFXcanvas16() { free(buffer); }
+
+void GFXcanvas16::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  buffer[x + y * WIDTH] = color;
+}
+
+void GFXcanvas16::fillScreen(uint16_t color) {
+  for (uint32_t i = 0; i < (uint32_t)WIDTH * HEIGHT; i++) buffer[i] = color;
+}
+
+uint16_t GFXcanvas16::getPixel(int16_t x, int16_t y) const {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  return buffer[x + y * WIDTH];
+}
+
+// ===== Adafruit_SPITFT =====
+
+void Adafruit_SPITFT::hostWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  winX = x;
+  winY = y;
+  winW = w;
+  winH = h;
+  winPos = 0;
+}
+
+// 전송 시간만큼 가상 시계를 진행 (setSPISpeed 클럭 기준, 픽셀 데이터만)
+// 프레임 전송이 loop 를 얼마나 붙잡는지가 재생 결과에 드러나게 함
+static uint64_t spiBitBacklog = 0;
+
+static void hostWireTime(uint32_t spiFreq, uint32_t bits) {
+  if (spiFreq == 0) return;
+  spiBitBacklog += bits;
+  uint64_t us = spiBitBacklog * 1000000ULL / spiFreq;
+  hostClockUs += us;
+  spiBitBacklog -= us * spiFreq / 1000000ULL;
+}
+
+void Adafruit_SPITFT::writeColor(uint16_t color, uint32_t len) {
+  hostWireTime(spiFreq, len * 16);
+  while (len--) {
+    if (winW == 0 || winH == 0) return;
+    uint32_t px = winX + winPos % winW;
+    uint32_t py = winY + (winPos / winW) % winH;
+    if (px < (uint32_t)WIDTH && py < (uint32_t)HEIGHT) gram[py * WIDTH + px] = color;
+    winPos++;
+  }
+}
+
+void Adafruit_SPITFT::writePixels(uint16_t *colors, uint32_t len, bool block, bool bigEndian) {
+  for (uint32_t i = 0; i < len; i++) {
+    uint16_t c = colors[i];
+    if (bigEndian) c = (uint16_t)((c >> 8) | (c << 8));
+    writeColor(c, 1);
+  }
+}
+
+void Adafruit_SPITFT::sendCommand(uint8_t commandByte, const uint8_t *dataBytes, uint8_t numDataBytes) {
+  lastCommand = commandByte;
+  if (commandByte == 0x33 && numDataBytes == 6) {  // VSCRDEF
+    scrollTop = (dataBytes[0] << 8) | dataBytes[1];
+    scrollArea = (dataBytes[2] << 8) | dataBytes[3];
+    scrollBottom = (dataBytes[4] << 8) | dataBytes[5];
+  } else if (commandByte == 0x37 && numDataBytes == 2) {  // VSCSAD
+    scrollStart = (dataBytes[0] << 8) | dataBytes[1];
+  }
+}
+
+void Adafruit_SPITFT::hostScanout(uint16_t *out) const {
+  for (int16_t y = 0; y < HEIGHT; y++) {
+    int16_t src = y;
+    if (y >= scrollTop && y < scrollTop + scrollArea && scrollArea > 0) {
+      int16_t off = (int16_t)(scrollStart >= scrollTop ? scrollStart - scrollTop : 0);
+      src = scrollTop + (y - scrollTop + off) % scrollArea;
+    }
+    memcpy(&out[y * WIDTH], &gram[src * WIDTH], WIDTH * sizeof(uint16_t));
+  }
+}
+
+void Adafruit_SPITFT::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+    startWrite();
+    setAddrWindow(x, y, 1, 1);
+    SPI_WRITE16(color);
+    endWrite();
+  }
+}
+
+void Adafruit_SPITFT::writePixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x >= 0) && (x < _width) && (y >= 0) && (y < _height)) {
+    setAddrWindow(x, y, 1, 1);
+    SPI_WRITE16(color);
+  }
+}
+
+void Adafruit_SPITFT::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (w < 0) { x += w + 1; w = -w; }
+  if (h < 0) { y += h + 1; h = -h; }
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w <= 0 || h <= 0) return;
+  setAddrWindow(x, y, w, h);
+  writeColor(color, (uint32_t)w * h);
+}
+
+void Adafruit_SPITFT::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (y < 0 || y >= _height) return;
+  writeFillRect(x, y, w, 1, color);
+}
+
+void Adafruit_SPITFT::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (x < 0 || x >= _width) return;
+  writeFillRect(x, y, 1, h, color);
+}
+
+void Adafruit_SPITFT::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  startWrite();
+  writeFillRect(x, y, w, h, color);
+  endWrite();
+}
+
+void Adafruit_SPITFT::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  startWrite();
+  writeFastHLine(x, y, w, color);
+  endWrite();
+}
+
+void Adafruit_SPITFT::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  startWrite();
+  writeFastVLine(x, y, h, color);
+  endWrite();
+}
+
+void Adafruit_SPITFT::drawRGBBitmap(int16_t x, int16_t y, uint16_t *pcolors, int16_t w, int16_t h) {
+  if (x >= _width || y >= _height || x + w <= 0 || y + h <= 0) return;
+  startWrite();
+  for (int16_t j = 0; j < h; j++) {
+    if (y + j < 0 || y + j >= _height) continue;
+    for (int16_t i = 0; i < w; i++) writePixel(x + i, y + j, pcolors[j * w + i]);
+  }
+  endWrite();
+}
@@ -0,0 +1,444 @@
+// 화면별 기준 이미지(golden) 비교 + SPI 예산 검사
+//
+// 모든 ScreenState 화면(+ 목록 스크롤 등 추가 동작)을 고정된 상태(대기열, 통계, 입력 버퍼)로 그린 뒤
+//   1) 보이는 화면(스크롤 반영)을 util/golden/<화면>.qgi 와 픽셀 단위로 비교
+//   2) 그리는 동안의 SPI 바이트/트랜잭션 수를 util/golden/budgets.txt 의 예산과 비교
+// 하나라도 다르거나 넘으면 종료 코드 1. 불일치 화면은 golden_out/<화면>.ppm 으로 저장.
+//
+//   ./qms_native --golden check  [dir]   검사 (기본 dir = util/golden)
+//   ./qms_native --golden update [dir]   현재 결과로 기준 이미지/예산 갱신
+//
+// .qgi 포맷 (리틀 엔디안): "QGI1" u16 width u16 height, 이후 (u16 길이, u16 색) 런 반복
+
+#include <Arduino.h>
+#include <sys/stat.h>
+#include <vector>
+#include "display.h"
+#include "qms_queue.h"
+#include "throughput_series.h"
+#include "admission.h"
+
+// main.cpp 의 화면 상태와 그리기 함수
+enum ScreenState : int;
+extern ScreenState currentScreen;
+extern QmsDisplay tft;
+extern const char* screenNames[];
+extern int currentTicket;
+extern int issuedTicket;
+extern int issuedTicketWaitTime;
+extern int callWaitPosition;
+extern String adminPassword;
+extern String newPassword;
+extern int selectedQueueIndex;
+extern ThroughputSeries throughputSeries;
+extern AdmissionPolicy admissionPolicy;
+extern AdmissionDecision lastAdmission;
+void setup();
+void drawUserMode();
+void drawAdminLogin();
+void drawAdminMode();
+void drawTicketIssued();
+void drawQueueFull();
+void drawQueueList();
+void drawTimeSetting();
+void drawPasswordChange();
+void drawStatsChart();
+void prepareChartColumns();
+void updatePressFeedback(bool down, int x, int y);
+void openModal(ScreenState screen);
+void closeModal();
+#include "queue_view.h"
+#include "modal.h"
+#include "background_image.h"
+#include "digit_roll.h"
+extern QueueListView queueView;
+extern ModalOverlay modal;
+extern BackgroundImage userBackground;
+extern DigitRoll waitRoll;
+void loadUserBackground();
+void formatMinSec(char* out, size_t size, int totalSec);
+
+static std::string goldenDirectory;
+
+// 화면 외 추가 검사: 긴 대기열에서 한 줄 스크롤 (준비 단계는 비용에 포함하지 않음)
+// 버튼 누름 표시 / 되돌리기: 버튼 영역만 전송되고 되돌린 결과는 USER_MODE 와 같아야 함
+static void prepareUserMode() {
+  currentScreen = (ScreenState)0;  // USER_MODE
+  tft.beginFrame();
+  drawUserMode();
+  tft.endFrame();
+}
+
+static void preparePressed() {
+  prepareUserMode();
+  updatePressFeedback(true, 120, 235);
+}
+
+static void drawPressed() {
+  updatePressFeedback(true, 120, 235);  // Join Queue
+}
+
+static void drawReleased() {
+  updatePressFeedback(false, 0, 0);
+}
+
+static void prepareQueueScroll() {
+  unsigned long nowMs = millis();
+  while (queueCount < 60) {
+    currentTicket++;
+    addToQueue(currentTicket, nowMs);
+  }
+  currentScreen = (ScreenState)6;  // QUEUE_LIST
+  tft.beginFrame();
+  drawQueueList();
+  queueView.scrollBy(tft, queueView.rowPitch() * 5);
+  tft.endFrame();
+}
+
+static void drawQueueScrollStep() {
+  queueView.scrollBy(tft, queueView.rowPitch());
+}
+
+// 모달 화면: 아래 화면(관리자 / 목록) 위에 겹쳐 연 모습
+static void drawCallModalOverAdmin() {
+  currentScreen = (ScreenState)2;  // ADMIN_MODE
+  drawAdminMode();
+  openModal((ScreenState)5);  // CALL_MODAL
+}
+
+static void drawDeleteConfirmOverList() {
+  currentScreen = (ScreenState)6;  // QUEUE_LIST
+  drawQueueList();
+  openModal((ScreenState)7);  // QUEUE_DELETE_CONFIRM
+}
+
+// 모달 닫기: 가렸던 영역만 전송되고 결과는 아래 화면과 같아야 함
+static void prepareCallModal() {
+  tft.beginFrame();
+  drawCallModalOverAdmin();
+  tft.endFrame();
+}
+
+// 스크롤된 목록 위 확인 창 - 복원이 되감긴 메모리 줄로 나뉘어 가야 함
+static void prepareDeleteConfirmScrolled() {
+  prepareQueueScroll();
+  tft.beginFrame();
+  openModal((ScreenState)7);  // QUEUE_DELETE_CONFIRM
+  tft.endFrame();
+}
+
+// 배경 이미지: <dir>/<sub>/bg_user.jpg (util/jpeg_fixture.py 로 만든 기준 JPEG) 를 SPIFFS 로 열어 깜
+// (applyUserBackground 와 같이 숫자 굴림은 페이드 없이 - 지운 자리를 이미지로 되돌림)
+static void loadBackground(const char* sub) {
+  setenv("QMS_HOST_FS", (goldenDirectory + "/" + sub).c_str(), 1);
+  loadUserBackground();
+  waitRoll.setFade(false);
+}
+
+// 4:2:0 + 재시작 표식(DRI), 화면보다 작음 - 나머지는 배경색
+static void prepareBackground420() {
+  loadBackground("bg_420");
+  currentScreen = (ScreenState)0;  // USER_MODE
+}
+
+// 회색조, 화면 크기
+static void prepareBackgroundGray() {
+  loadBackground("bg_gray");
+  currentScreen = (ScreenState)0;  // USER_MODE
+}
+
+static void prepareBackgroundTick() {
+  loadBackground("bg_420");
+  prepareUserMode();
+}
+
+// 대기시간이 1초 줄어 바뀐 숫자 칸만 굴림 - 지운 자리는 이미지 조각으로 되돌려야 함
+static void drawBackgroundTick() {
+  char text[24];
+  formatMinSec(text, sizeof(text), expectedWaitSec(millis()) - 1);
+  if (waitRoll.change(tft, text)) waitRoll.render(tft, DIGIT_ROLL_LINES);
+}
+
+struct GoldenExtra {
+  const char* name;
+  void (*prepare)();
+  void (*draw)();
+};
+
+static const GoldenExtra goldenExtras[] = {
+  {"USER_MODE_PRESSED", prepareUserMode, drawPressed},
+  {"USER_MODE_RELEASED", preparePressed, drawReleased},
+  {"QUEUE_LIST_SCROLL", prepareQueueScroll, drawQueueScrollStep},
+  {"CALL_MODAL_CLOSE", prepareCallModal, closeModal},
+  {"QUEUE_DELETE_CANCEL", prepareDeleteConfirmScrolled, closeModal},
+  {"USER_MODE_BG", prepareBackground420, drawUserMode},
+  {"USER_MODE_BG_TICK", prepareBackgroundTick, drawBackgroundTick},
+  {"USER_MODE_BG_GRAY", prepareBackgroundGray, drawUserMode}
+};
+static const int GOLDEN_EXTRA_COUNT = sizeof(goldenExtras) / sizeof(goldenExtras[0]);
+
+#define GOLDEN_W 240
+#define GOLDEN_H 320
+
+struct GoldenScreen {
+  void (*draw)();
+};
+
+// ScreenState 순서와 동일
+static const GoldenScreen goldenScreens[] = {
+  {drawUserMode}, {drawAdminLogin}, {drawAdminMode}, {drawTicketIssued}, {drawQueueFull},
+  {drawCallModalOverAdmin}, {drawQueueList}, {drawDeleteConfirmOverList}, {drawTimeSetting},
+  {drawPasswordChange}, {drawStatsChart}
+};
+static const int GOLDEN_SCREEN_COUNT = sizeof(goldenScreens) / sizeof(goldenScreens[0]);
+
+struct GoldenBudget {
+  std::string name;
+  uint32_t bytes;
+  uint32_t transactions;
+};
+
+// 고정 상태: 같은 코드면 항상 같은 화면이 나오도록 시계와 입력을 모두 정함
+static void buildFixture() {
+  hostSerialSink = nullptr;
+  setup();
+
+  // 90분 동안의 발행/처리 기록 (차트용)
+  for (int m = 1; m <= 90; m++) {
+    for (int i = 0; i < (m * 7) % 5; i++) throughputSeries.recordIssue(60 + (m * 13) % 240);
+    for (int i = 0; i < (m * 3) % 4; i++) throughputSeries.recordServe(45 + (m * 29) % 300);
+    throughputSeries.update((unsigned long)m * 60000UL, m % 9);
+  }
+
+  hostClockUs = 91ULL * 60 * 1000000;
+  unsigned long nowMs = millis();
+
+  userProcessTimeSec = 60;
+  for (int i = 0; i < 7; i++) {
+    currentTicket++;
+    addToQueue(currentTicket, nowMs);
+  }
+  lastProcessTime = nowMs - 15000;
+
+  issuedTicket = currentTicket;
+  callWaitPosition = queueCount;
+  issuedTicketWaitTime = expectedWaitSec(nowMs);
+  adminPassword = "5A";
+  newPassword = "C3";
+  selectedQueueIndex = 2;
+
+  admissionPolicy.setClock(nowMs, 9L * 3600 + 30 * 60);
+  lastAdmission.result = ADMIT_WAIT_TOO_LONG;
+  lastAdmission.predictedWaitSec = 1925;
+  lastAdmission.nextSlotSec = 75;
+
+  prepareChartColumns();
+}
+
+static std::string goldenPath(const char* dir, const char* name, const char* ext) {
+  return std::string(dir) + "/" + name + ext;
+}
+
+static void put16(std::vector<uint8_t>& out, uint16_t v) {
+  out.push_back(v & 0xFF);
+  out.push_back(v >> 8);
+}
+
+static bool writeGolden(const std::string& path, const uint16_t* pixels) {
+  std::vector<uint8_t> out = {'Q', 'G', 'I', '1'};
+  put16(out, GOLDEN_W);
+  put16(out, GOLDEN_H);
+  const int total = GOLDEN_W * GOLDEN_H;
+  for (int i = 0; i < total;) {
+    int run = 1;
+    while (i + run < total && run < 0xFFFF && pixels[i + run] == pixels[i]) run++;
+    put16(out, run);
+    put16(out, pixels[i]);
+    i += run;
+  }
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  bool ok = fwrite(out.data(), 1, out.size(), f) == out.size();
+  fclose(f);
+  return ok;
+}
+
+static bool readGolden(const std::string& path, uint16_t* pixels) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  uint8_t header[8];
+  bool ok = fread(header, 1, 8, f) == 8 && memcmp(header, "QGI1", 4) == 0 &&
+            (header[4] | (header[5] << 8)) == GOLDEN_W && (header[6] | (header[7] << 8)) == GOLDEN_H;
+  int pos = 0;
+  uint8_t rec[4];
+  while (ok && pos < GOLDEN_W * GOLDEN_H && fread(rec, 1, 4, f) == 4) {
+    int run = rec[0] | (rec[1] << 8);
+    uint16_t color = rec[2] | (rec[3] << 8);
+    if (run == 0 || pos + run > GOLDEN_W * GOLDEN_H) ok = false;
+    for (int i = 0; ok && i < run; i++) pixels[pos++] = color;
+  }
+  fclose(f);
+  return ok && pos == GOLDEN_W * GOLDEN_H;
+}
+
+// 확인용 PPM (패널이 색을 반전하므로 다시 뒤집어서 실제 보이는 색으로 저장)
+static void writePpm(const std::string& path, const uint16_t* pixels) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return;
+  fprintf(f, "P6\n%d %d\n255\n", GOLDEN_W, GOLDEN_H);
+  for (int i = 0; i < GOLDEN_W * GOLDEN_H; i++) {
+    uint16_t c = ~pixels[i];
+    uint8_t rgb[3] = {(uint8_t)(((c >> 11) & 0x1F) << 3), (uint8_t)(((c >> 5) & 0x3F) << 2), (uint8_t)((c & 0x1F) << 3)};
+    fwrite(rgb, 1, 3, f);
+  }
+  fclose(f);
+}
+
+static std::vector<GoldenBudget> readBudgets(const std::string& path) {
+  std::vector<GoldenBudget> budgets;
+  FILE* f = fopen(path.c_str(), "r");
+  if (!f) return budgets;
+  char line[128], name[64];
+  unsigned long bytes, transactions;
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%63s %lu %lu", name, &bytes, &transactions) == 3) {
+      budgets.push_back({name, (uint32_t)bytes, (uint32_t)transactions});
+    }
+  }
+  fclose(f);
+  return budgets;
+}
+
+static const GoldenBudget* findBudget(const std::vector<GoldenBudget>& budgets, const char* name) {
+  for (const GoldenBudget& b : budgets) {
+    if (b.name == name) return &b;
+  }
+  return nullptr;
+}
+
+int runGolden(const char* mode, const char* dir) {
+  bool update = strcmp(mode, "update") == 0;
+  if (!update && strcmp(mode, "check") != 0) {
+    fprintf(stderr, "golden: mode must be check or update\n");
+    return 2;
+  }
+
+  goldenDirectory = dir;
+  buildFixture();
+
+  std::string budgetPath = std::string(dir) + "/budgets.txt";
+  std::vector<GoldenBudget> budgets = readBudgets(budgetPath);
+  std::vector<GoldenBudget> measured;
+  static uint16_t actual[GOLDEN_W * GOLDEN_H];
+  static uint16_t expected[GOLDEN_W * GOLDEN_H];
+  int failures = 0;
+
+  uint64_t fixtureClockUs = hostClockUs;
+  for (int s = 0; s < GOLDEN_SCREEN_COUNT + GOLDEN_EXTRA_COUNT; s++) {
+    const char* name;
+    // 각 화면은 같은 시각(전송 시간만큼 시계가 흐르므로), 스크롤 없는 상태에서 시작
+    hostClockUs = fixtureClockUs;
+    queueView.hide(tft);
+    modal.cancel();
+    userBackground.end();
+    waitRoll.setFade(true);
+    if (s < GOLDEN_SCREEN_COUNT) {
+      name = screenNames[s];
+      currentScreen = (ScreenState)s;
+      tft.stats.reset();
+      tft.beginFrame();
+      goldenScreens[s].draw();
+      tft.endFrame();
+    } else {
+      const GoldenExtra& extra = goldenExtras[s - GOLDEN_SCREEN_COUNT];
+      name = extra.name;
+      extra.prepare();
+      tft.stats.reset();
+      tft.beginFrame();
+      extra.draw();
+      tft.endFrame();
+    }
+    SpiStats stats = tft.stats;
+    tft.hostScanout(actual);
+    measured.push_back({name, stats.bytes, stats.transactions});
+
+    printf("%-22s bytes=%-8u tx=%-6u win=%-6u", name, stats.bytes, stats.transactions, stats.windows);
+
+    std::string imagePath = goldenPath(dir, name, ".qgi");
+    if (update) {
+      if (!writeGolden(imagePath, actual)) {
+        printf(" write failed: %s\n", imagePath.c_str());
+        failures++;
+        continue;
+      }
+      printf(" updated\n");
+      continue;
+    }
+
+    bool failed = false;
+    if (!readGolden(imagePath, expected)) {
+      printf(" missing reference %s", imagePath.c_str());
+      failed = true;
+    } else {
+      int diff = 0, x0 = GOLDEN_W, y0 = GOLDEN_H, x1 = -1, y1 = -1;
+      for (int i = 0; i < GOLDEN_W * GOLDEN_H; i++) {
+        if (actual[i] == expected[i]) continue;
+        int x = i % GOLDEN_W, y = i / GOLDEN_W;
+        diff++;
+        x0 = min(x0, x); y0 = min(y0, y);
+        x1 = max(x1, x); y1 = max(y1, y);
+      }
+      if (diff > 0) {
+        printf(" PIXELS %d differ in (%d,%d)-(%d,%d)", diff, x0, y0, x1, y1);
+        failed = true;
+      }
+    }
+
+    const GoldenBudget* budget = findBudget(budgets, name);
+    if (!budget) {
+      printf(" no budget");
+      failed = true;
+    } else {
+      if (stats.bytes > budget->bytes) {
+        printf(" BYTES over budget %u", budget->bytes);
+        failed = true;
+      }
+      if (stats.transactions > budget->transactions) {
+        printf(" TX over budget %u", budget->transactions);
+        failed = true;
+      }
+      if (!failed && (stats.bytes < budget->bytes || stats.transactions < budget->transactions)) {
+        printf(" (under budget - update to tighten)");
+      }
+    }
+
+    if (failed) {
+      mkdir("golden_out", 0755);
+      writePpm(std::string("golden_out/") + name + ".ppm", actual);
+      failures++;
+      printf(" FAIL\n");
+    } else {
+      printf(" ok\n");
+    }
+  }
+
+  if (update) {
+    FILE* f = fopen(budgetPath.c_str(), "w");
+    if (!f) {
+      perror(budgetPath.c_str());
+      return 1;
+    }
+    fprintf(f, "# screen bytes transactions  (qms_native --golden update 로 갱신)\n");
+    for (const GoldenBudget& b : measured) {
+      fprintf(f, "%s %u %u\n", b.name.c_str(), b.bytes, b.transactions);
+    }
+    fclose(f);
+  }
+
+  if (failures > 0) {
+    printf("%d screen(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,89 @@
+// 호스트(native) 빌드 진입점: 터치 트레이스 재생
+//
+// 펌웨어 main.cpp 를 Arduino/GFX 대체 헤더(util/host)와 함께 그대로 빌드하고,
+// .qtt 트레이스를 가상 시계에 맞춰 loop() 에 공급한다.
+// 화면 전환과 SPI 비용 로그가 표준 출력으로 나오며 같은 트레이스면 항상 같은 결과.
+//
+// 빌드 (저장소 루트에서):
+//   g++ -O2 -std=gnu++17 -Iutil/host -Iinclude src/*.cpp util/host/*.cpp -o qms_native
+// 실행:
+//   ./qms_native touch.qtt            재생 로그만 출력
+//   ./qms_native touch.qtt --serial   펌웨어 Serial 출력도 stderr 로 함께 출력
+//   ./qms_native --golden check       화면별 기준 이미지/SPI 예산 검사 (host_golden.cpp)
+//   ./qms_native --replay check       util/replay 트레이스 재생 로그 검사 (host_replay.cpp)
+//   ./qms_native --pty [링크 경로]     가상 시리얼 포트로 실시간 구동 (host_pty.cpp)
+// 에셋 파티션: QMS_HOST_PARTITIONS=<디렉터리> 면 <디렉터리>/assets.bin 을 mmap (host_partition.cpp)
+
+#include <Arduino.h>
+#include "touch.h"
+
+extern TouchModule touchModule;
+extern Print* replayLog;
+bool beginTouchReplay(const uint8_t* buffer, size_t len);
+void setup();
+void loop();
+int runGolden(const char* mode, const char* dir);
+int runReplay(const char* mode, const char* dir);
+int runPty(const char* linkPath);
+
+class StdoutPrint : public Print {
+public:
+  size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+// 트레이스 파일을 끝까지 재생 (재생 로그는 log 로). 트레이스가 아니면 1
+int replayTraceFile(const char* path, Print& log) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    perror(path);
+    return 1;
+  }
+  std::string trace;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) trace.append(buf, n);
+  fclose(f);
+
+  replayLog = &log;
+  setup();
+
+  if (!beginTouchReplay((const uint8_t*)trace.data(), trace.size())) {
+    fprintf(stderr, "%s: not a QTT1 trace\n", path);
+    return 1;
+  }
+  // sample() 가 기다리지 않도록 다음 샘플 시각으로 시계를 먼저 옮김
+  uint64_t baseUs = hostClockUs;
+  while (touchModule.isReplaying()) {
+    uint32_t offsetUs;
+    if (touchModule.nextReplayTime(offsetUs) && baseUs + offsetUs > hostClockUs) {
+      hostClockUs = baseUs + offsetUs;
+    }
+    loop();
+  }
+  loop();
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s trace.qtt [--serial]\n"
+                    "       %s --golden check|update [dir]\n"
+                    "       %s --replay check|update [dir]\n"
+                    "       %s --pty [link]\n", argv[0], argv[0], argv[0], argv[0]);
+    return 2;
+  }
+  if (strcmp(argv[1], "--golden") == 0) {
+    return runGolden(argc > 2 ? argv[2] : "check", argc > 3 ? argv[3] : "util/golden");
+  }
+  if (strcmp(argv[1], "--replay") == 0) {
+    return runReplay(argc > 2 ? argv[2] : "check", argc > 3 ? argv[3] : "util/replay");
+  }
+  if (strcmp(argv[1], "--pty") == 0) {
+    return runPty(argc > 2 ? argv[2] : nullptr);
+  }
+  if (argc > 2 && strcmp(argv[2], "--serial") == 0) hostSerialSink = stderr;
+
+  StdoutPrint out;
+  return replayTraceFile(argv[1], out);
+}
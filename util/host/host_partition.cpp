@@ -0,0 +1,66 @@
+// 호스트 빌드용 파티션 구현부 - 파일을 읽기 전용으로 mmap
+#include <esp_partition.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define HOST_MAPS 4
+
+static esp_partition_t found;
+static std::string foundPath;
+
+static struct {
+  void* addr;
+  size_t len;
+} maps[HOST_MAPS];
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char* label) {
+  const char* dir = getenv("QMS_HOST_PARTITIONS");
+  if (!dir || !label) return nullptr;
+  std::string path = std::string(dir) + "/" + label + ".bin";
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) return nullptr;
+
+  foundPath = path;
+  memset(&found, 0, sizeof(found));
+  found.type = type;
+  found.subtype = subtype;
+  found.size = (uint32_t)st.st_size;
+  strncpy(found.label, label, sizeof(found.label) - 1);
+  return &found;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+                             spi_flash_mmap_memory_t memory, const void** out_ptr,
+                             spi_flash_mmap_handle_t* out_handle) {
+  if (partition != &found || offset + size > partition->size || size == 0) return ESP_FAIL;
+  for (spi_flash_mmap_handle_t h = 0; h < HOST_MAPS; h++) {
+    if (maps[h].addr) continue;
+    int fd = open(foundPath.c_str(), O_RDONLY);
+    if (fd < 0) return ESP_FAIL;
+    // 페이지 경계에서 매핑하고 offset 만큼 건너뛴 주소를 돌려줌 (실제 MMU 64KB 페이지와 같은 방식)
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t base = offset / page * page;
+    void* addr = mmap(nullptr, size + (offset - base), PROT_READ, MAP_PRIVATE, fd, (off_t)base);
+    close(fd);
+    if (addr == MAP_FAILED) return ESP_FAIL;
+    maps[h].addr = addr;
+    maps[h].len = size + (offset - base);
+    *out_ptr = (const uint8_t*)addr + (offset - base);
+    *out_handle = h;
+    return ESP_OK;
+  }
+  return ESP_FAIL;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t handle) {
+  if (handle >= HOST_MAPS || !maps[handle].addr) return;
+  munmap(maps[handle].addr, maps[handle].len);
+  maps[handle].addr = nullptr;
+}
@@ -0,0 +1,84 @@
+// 호스트 빌드 pty 모드: 보드 없이 가상 시리얼 포트로 펌웨어를 실시간 구동
+//
+// 펌웨어 Serial 입출력을 의사 터미널(pty)에 연결하고, 가상 시계를 실제 시간에 맞춰 loop() 를 계속 돌림.
+// 보드 대신 util/qms_link.py 나 터미널 프로그램을 슬레이브 경로에 붙여 바이너리/텍스트 명령을 시험.
+//   ./qms_native --pty            슬레이브 경로(/dev/pts/N)를 표준 출력에 한 줄로 알림
+//   ./qms_native --pty /tmp/qms   같은 경로를 심볼릭 링크로도 만듦 (끝날 때 지움)
+// 아무도 읽지 않으면 출력은 버려짐 (보드의 UART 와 같음)
+
+#include <Arduino.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+void setup();
+void loop();
+
+static volatile sig_atomic_t ptyStop = 0;
+
+static void onPtySignal(int) { ptyStop = 1; }
+
+static uint64_t monotonicUs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int runPty(const char* linkPath) {
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+    perror("pty");
+    return 1;
+  }
+  const char* slavePath = ptsname(master);
+  // 슬레이브를 열어 둔 채로 raw 설정 (개행 변환/에코 없이 바이트 그대로, 붙은 쪽이 없어도 EIO 없음)
+  int slave = open(slavePath, O_RDWR | O_NOCTTY);
+  struct termios tio;
+  if (slave < 0 || tcgetattr(slave, &tio) != 0) {
+    perror(slavePath);
+    return 1;
+  }
+  cfmakeraw(&tio);
+  tcsetattr(slave, TCSANOW, &tio);
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+  if (linkPath) {
+    unlink(linkPath);
+    if (symlink(slavePath, linkPath) != 0) perror(linkPath);
+  }
+  printf("%s\n", slavePath);
+  fflush(stdout);
+
+  signal(SIGINT, onPtySignal);
+  signal(SIGTERM, onPtySignal);
+  hostSerialSink = fdopen(dup(master), "w");
+
+  setup();
+  fflush(hostSerialSink);
+
+  // setup() 의 delay 로 앞서간 가상 시계는 실제 시간이 따라올 때까지 그대로
+  uint64_t baseUs = monotonicUs() - hostClockUs;
+  while (!ptyStop) {
+    uint8_t buf[1024];
+    ssize_t n;
+    while ((n = read(master, buf, sizeof(buf))) > 0) hostSerialInject(buf, (size_t)n);
+
+    uint64_t nowUs = monotonicUs() - baseUs;
+    if (nowUs > hostClockUs) hostClockUs = nowUs;
+    loop();
+    fflush(hostSerialSink);
+    clearerr(hostSerialSink);
+
+    // 입력이 오면 바로, 아니면 1ms 마다
+    struct pollfd p = {master, POLLIN, 0};
+    poll(&p, 1, 1);
+  }
+
+  if (linkPath) unlink(linkPath);
+  close(slave);
+  close(master);
+  return 0;
+}
@@ -0,0 +1,140 @@
+// 터치 트레이스 재생 로그 비교 (제스처/화면 흐름 회귀 검사)
+//
+// <dir>/*.qtt 를 하나씩 처음 상태에서 재생하고, 재생 로그와 펌웨어 Serial 출력을 합친 결과를
+// <dir>/<이름>.log 와 비교한다. 다르면 종료 코드 1, 결과는 replay_out/<이름>.log 로 남김.
+// 트레이스는 util/touch_trace.py synth 로 <이름>.txt 스크립트에서 만듦.
+//
+//   ./qms_native --replay check  [dir]   검사 (기본 dir = util/replay)
+//   ./qms_native --replay update [dir]   현재 결과로 기준 로그 갱신
+//
+// 펌웨어 상태가 전역 변수이므로 트레이스마다 fork 해서 서로 영향을 주지 않게 함
+
+#include <Arduino.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+
+int replayTraceFile(const char* path, Print& log);
+
+class FilePrint : public Print {
+private:
+  FILE* f;
+public:
+  explicit FilePrint(FILE* file) : f(file) {}
+  size_t write(uint8_t c) override { return fputc(c, f) == EOF ? 0 : 1; }
+  using Print::write;
+};
+
+static bool readText(const std::string& path, std::string& out) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  char buf[4096];
+  size_t n;
+  out.clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  fclose(f);
+  return true;
+}
+
+// 자식 프로세스에서 재생해 outPath 에 기록. 성공하면 true
+static bool replayInChild(const std::string& tracePath, const std::string& outPath) {
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    return false;
+  }
+  if (pid == 0) {
+    FILE* out = fopen(outPath.c_str(), "w");
+    if (!out) {
+      perror(outPath.c_str());
+      _exit(1);
+    }
+    // 재생 로그와 Serial 을 같은 파일로 - 순서가 실제 실행 순서와 같음
+    hostSerialSink = out;
+    FilePrint log(out);
+    int rc = replayTraceFile(tracePath.c_str(), log);
+    fclose(out);
+    _exit(rc);
+  }
+  int status = 0;
+  waitpid(pid, &status, 0);
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// 처음 다른 줄 번호 (같으면 0)
+static int firstDiffLine(const std::string& a, const std::string& b) {
+  int line = 1;
+  size_t n = min(a.size(), b.size());
+  for (size_t i = 0; i < n; i++) {
+    if (a[i] != b[i]) return line;
+    if (a[i] == '\n') line++;
+  }
+  return a.size() == b.size() ? 0 : line;
+}
+
+int runReplay(const char* mode, const char* dir) {
+  bool update = strcmp(mode, "update") == 0;
+  if (!update && strcmp(mode, "check") != 0) {
+    fprintf(stderr, "replay: mode must be check or update\n");
+    return 2;
+  }
+
+  std::vector<std::string> names;
+  DIR* d = opendir(dir);
+  if (!d) {
+    perror(dir);
+    return 1;
+  }
+  while (dirent* e = readdir(d)) {
+    std::string file = e->d_name;
+    if (file.size() > 4 && file.compare(file.size() - 4, 4, ".qtt") == 0) names.push_back(file.substr(0, file.size() - 4));
+  }
+  closedir(d);
+  std::sort(names.begin(), names.end());
+
+  int failures = 0;
+  mkdir("replay_out", 0755);
+  for (const std::string& name : names) {
+    std::string tracePath = std::string(dir) + "/" + name + ".qtt";
+    std::string expectedPath = std::string(dir) + "/" + name + ".log";
+    std::string outPath = update ? expectedPath : "replay_out/" + name + ".log";
+    printf("%-22s", name.c_str());
+
+    if (!replayInChild(tracePath, outPath)) {
+      printf(" replay failed FAIL\n");
+      failures++;
+      continue;
+    }
+    if (update) {
+      printf(" updated\n");
+      continue;
+    }
+
+    std::string actual, expected;
+    readText(outPath, actual);
+    if (!readText(expectedPath, expected)) {
+      printf(" missing reference %s FAIL\n", expectedPath.c_str());
+      failures++;
+      continue;
+    }
+    int line = firstDiffLine(expected, actual);
+    if (line > 0) {
+      printf(" differs from line %d (see %s) FAIL\n", line, outPath.c_str());
+      failures++;
+      continue;
+    }
+    remove(outPath.c_str());
+    printf(" ok\n");
+  }
+  rmdir("replay_out");
+
+  if (failures > 0) {
+    printf("%d trace(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
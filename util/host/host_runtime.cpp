@@ -0,0 +1,48 @@
+// 호스트 빌드용 Arduino 런타임 구현부
+#include <Arduino.h>
+#include <stdarg.h>
+#include <deque>
+
+uint64_t hostClockUs = 0;
+FILE *hostSerialSink = nullptr;
+HardwareSerial Serial;
+EspClass ESP;
+
+static std::deque<uint8_t> serialRx;
+
+size_t Print::printf(const char *fmt, ...) {
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  return write((const uint8_t *)buf, strlen(buf));
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (hostSerialSink) fputc(c, hostSerialSink);
+  return 1;
+}
+
+int HardwareSerial::available() { return (int)serialRx.size(); }
+
+int HardwareSerial::read() {
+  if (serialRx.empty()) return -1;
+  int c = serialRx.front();
+  serialRx.pop_front();
+  return c;
+}
+
+size_t HardwareSerial::read(uint8_t *buffer, size_t size) {
+  size_t n = std::min(size, serialRx.size());
+  std::copy(serialRx.begin(), serialRx.begin() + n, buffer);
+  serialRx.erase(serialRx.begin(), serialRx.begin() + n);
+  return n;
+}
+
+int HardwareSerial::peek() { return serialRx.empty() ? -1 : serialRx.front(); }
+
+void hostSerialInject(const uint8_t *data, size_t len) {
+  serialRx.insert(serialRx.end(), data, data + len);
+}
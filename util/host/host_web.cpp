@@ -0,0 +1,168 @@
+// 호스트 빌드용 WiFi/WebServer 구현부 (루프백 소켓)
+#include <WiFi.h>
+#include <WebServer.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+WebServer::WebServer(int port)
+    : port(port), listenFd(-1), clientFd(-1), notFound(nullptr), contentLength((size_t)-1) {}
+
+WebServer::~WebServer() {
+  if (listenFd >= 0) close(listenFd);
+}
+
+void WebServer::begin() {
+  const char *override = getenv("QMS_HOST_HTTP_PORT");
+  int hostPort = override ? atoi(override) : (port == 80 ? 8080 : port);
+
+  listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  int yes = 1;
+  setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(hostPort);
+  if (bind(listenFd, (sockaddr *)&addr, sizeof(addr)) != 0 || listen(listenFd, 4) != 0) {
+    perror("WebServer");
+    close(listenFd);
+    listenFd = -1;
+    return;
+  }
+  fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL) | O_NONBLOCK);
+  fprintf(stderr, "WebServer: http://127.0.0.1:%d\n", hostPort);
+}
+
+void WebServer::on(const char *uri, HTTPMethod method, THandlerFunction handler) {
+  routes.push_back({uri, method, handler});
+}
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+static std::string urlDecode(const std::string &s) {
+  std::string out;
+  for (size_t i = 0; i < s.size(); i++) {
+    if (s[i] == '+') {
+      out += ' ';
+    } else if (s[i] == '%' && i + 2 < s.size() && hexValue(s[i + 1]) >= 0 && hexValue(s[i + 2]) >= 0) {
+      out += (char)(hexValue(s[i + 1]) * 16 + hexValue(s[i + 2]));
+      i += 2;
+    } else {
+      out += s[i];
+    }
+  }
+  return out;
+}
+
+// 요청 하나를 받아 처리하고 닫음 (헤더가 100ms 안에 다 안 오면 버림)
+void WebServer::handleClient() {
+  if (listenFd < 0) return;
+  clientFd = accept(listenFd, nullptr, nullptr);
+  if (clientFd < 0) return;
+
+  std::string request;
+  char buf[1024];
+  while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+    pollfd p = {clientFd, POLLIN, 0};
+    if (poll(&p, 1, 100) <= 0) break;
+    ssize_t n = read(clientFd, buf, sizeof(buf));
+    if (n <= 0) break;
+    request.append(buf, (size_t)n);
+  }
+
+  // "GET /status?since=12 HTTP/1.1"
+  size_t methodEnd = request.find(' ');
+  size_t targetEnd = methodEnd == std::string::npos ? std::string::npos : request.find(' ', methodEnd + 1);
+  if (targetEnd != std::string::npos) {
+    std::string method = request.substr(0, methodEnd);
+    std::string target = request.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+    size_t q = target.find('?');
+    path = target.substr(0, q);
+    args.clear();
+    if (q != std::string::npos) {
+      std::string query = target.substr(q + 1);
+      size_t pos = 0;
+      while (pos <= query.size()) {
+        size_t amp = query.find('&', pos);
+        if (amp == std::string::npos) amp = query.size();
+        std::string pair = query.substr(pos, amp - pos);
+        size_t eq = pair.find('=');
+        if (!pair.empty()) {
+          args.push_back({urlDecode(pair.substr(0, eq)), eq == std::string::npos ? "" : urlDecode(pair.substr(eq + 1))});
+        }
+        pos = amp + 1;
+      }
+    }
+    headers.clear();
+    contentLength = (size_t)-1;
+
+    THandlerFunction handler = notFound;
+    for (const Route &r : routes) {
+      bool methodOk = r.method == HTTP_ANY || (r.method == HTTP_GET && method == "GET") ||
+                      (r.method == HTTP_POST && method == "POST");
+      if (r.uri == path && methodOk) {
+        handler = r.handler;
+        break;
+      }
+    }
+    if (handler) {
+      handler();
+    } else {
+      send(404, "text/plain", String("Not found"));
+    }
+  }
+  close(clientFd);
+  clientFd = -1;
+}
+
+bool WebServer::hasArg(const char *name) const {
+  for (const auto &a : args) {
+    if (a.first == name) return true;
+  }
+  return false;
+}
+
+String WebServer::arg(const char *name) const {
+  for (const auto &a : args) {
+    if (a.first == name) return String(a.second);
+  }
+  return String();
+}
+
+void WebServer::sendHeader(const char *name, const char *value) {
+  headers += std::string(name) + ": " + value + "\r\n";
+}
+
+void WebServer::writeAll(const char *data, size_t length) {
+  while (length > 0 && clientFd >= 0) {
+    ssize_t n = write(clientFd, data, length);
+    if (n <= 0) return;
+    data += n;
+    length -= (size_t)n;
+  }
+}
+
+void WebServer::send(int code, const char *contentType, const String &content) {
+  size_t length = contentLength != (size_t)-1 ? contentLength : content.length();
+  char head[256];
+  snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n",
+           code, code == 200 ? "OK" : code == 404 ? "Not Found" : "Error", contentType, length);
+  writeAll(head, strlen(head));
+  writeAll(headers.data(), headers.size());
+  writeAll("\r\n", 2);
+  writeAll(content.c_str(), content.length());
+}
+
+void WebServer::sendContent(const char *content, size_t length) {
+  writeAll(content, length);
+}
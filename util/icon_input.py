@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""
+아이콘 입력 읽기 (util/sprite_atlas.py, util/asset_pack.py 가 가져다 씀)
+- 이미지를 지정한 크기로 스케일링해서 RGB565 픽셀 목록으로 (PIL 필요)
+- 이전 형식(32x32 RGB565 배열) 헤더나 예전 QmsAsset(RAW/RLE) 헤더에서 픽셀 목록 복원
+  (원본 이미지 없이 아틀라스로 옮길 때)
+예전 32x32_img2header.py (아이콘별 RLE 헤더 생성기) 의 읽기 부분만 남긴 것.
+헤더 생성/RLE 압축과 펌웨어 QmsAsset 디코더는 스프라이트 아틀라스(include/sprite_atlas.h) 로 대체되어 지웠음.
+아이콘은 sprite_atlas.py 로 아틀라스 헤더를, 큰 이미지는 asset_pack.py 로 에셋 파티션을 만듦
+"""
+
+import re
+import argparse
+
+RUN_FLAG = 0x8000
+MAX_SPAN = 0x7FFF
+
+def rgb_to_rgb565(r, g, b):
+    """RGB (8,8,8) 값을 RGB565 (5,6,5) 포맷으로 변환"""
+    r5 = (r >> 3) & 0x1F
+    g6 = (g >> 2) & 0x3F
+    b5 = (b >> 3) & 0x1F
+    return (r5 << 11) | (g6 << 5) | b5
+
+def swap_bytes(color):
+    """CPU 순서 RGB565 → 패널 전송 순서 (빅엔디언)"""
+    return ((color >> 8) | (color << 8)) & 0xFFFF
+
+def load_image(image_path, size):
+    """이미지를 읽어 RGB565 픽셀 목록 반환 (size 가 None 이면 원본 크기)"""
+    from PIL import Image
+
+    img = Image.open(image_path)
+    original_size = img.size
+    img = img.convert('RGBA')
+    if size and size != original_size:
+        print(f"이미지 크기를 {original_size}에서 {size}로 조정합니다.")
+        img = img.resize(size, Image.Resampling.LANCZOS)
+    width, height = img.size
+
+    pixels = []
+    for row in range(height):
+        for col in range(width):
+            r, g, b, a = img.getpixel((col, row))
+            if a < 128:  # 투명한 픽셀은 검은색
+                r, g, b = 0, 0, 0
+            pixels.append(rgb_to_rgb565(r, g, b))
+    return pixels, width, height, original_size
+
+def load_legacy_header(header_path, size):
+    """이전 형식 헤더(반전 전 RGB565 배열)에서 픽셀 목록 반환"""
+    with open(header_path, encoding='utf-8') as f:
+        text = f.read()
+    body = text[text.index('{') + 1:text.index('}')]
+    body = re.sub(r'//[^\n]*', '', body)
+    pixels = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{1,4}', body)]
+
+    width, height = size or (32, 32)
+    if len(pixels) != width * height:
+        raise ValueError(f"픽셀 수 {len(pixels)}가 {width}x{height}와 맞지 않습니다 (--size 지정)")
+    match = re.search(r'원본 크기: (\d+)x(\d+)', text)
+    original_size = (int(match.group(1)), int(match.group(2))) if match else (width, height)
+    return pixels, width, height, original_size
+
+def load_asset_header(header_path):
+    """예전 이 변환기가 만든 QmsAsset 헤더에서 (반전 전) 픽셀 목록 반환"""
+    with open(header_path, encoding='utf-8') as f:
+        text = f.read()
+    match = re.search(r'QmsAsset \w+ = \{(\d+), (\d+), ASSET_(RAW|RLE), (\d+)', text)
+    width, height = int(match.group(1)), int(match.group(2))
+    body = text[text.index('{') + 1:text.index('}')]
+    words = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]{1,4}', body)]
+    pixels = decode(words, match.group(3).lower(), width * height)
+    if '반전 적용' in text:
+        pixels = [p ^ 0xFFFF for p in pixels]
+    match = re.search(r'원본 크기: (\d+)x(\d+)', text)
+    original_size = (int(match.group(1)), int(match.group(2))) if match else (width, height)
+    return pixels, width, height, original_size
+
+def load_header(header_path, size):
+    """헤더 입력 - QmsAsset 형식이면 그 크기 그대로, 아니면 이전 형식"""
+    with open(header_path, encoding='utf-8') as f:
+        if 'QmsAsset' in f.read():
+            return load_asset_header(header_path)
+    return load_legacy_header(header_path, size)
+
+def decode(words, fmt, count):
+    """QmsAsset 데이터 워드 풀기 (RAW: 패널 바이트 순서, RLE: 제어 워드 + 런 색/낱개 픽셀)"""
+    if fmt == 'raw':
+        return [swap_bytes(w) for w in words]
+    pixels = []
+    pos = 0
+    while pos < len(words):
+        control = words[pos]
+        pos += 1
+        if control & RUN_FLAG:
+            pixels.extend([words[pos]] * (control & MAX_SPAN))
+            pos += 1
+        else:
+            pixels.extend(swap_bytes(w) for w in words[pos:pos + control])
+            pos += control
+    assert len(pixels) == count
+    return pixels
+
+def parse_size(text):
+    if text == 'keep':
+        return None
+    match = re.fullmatch(r'(\d+)x(\d+)', text)
+    if not match:
+        raise argparse.ArgumentTypeError("크기는 WxH 또는 keep")
+    width, height = int(match.group(1)), int(match.group(2))
+    if not (0 < width <= 240 and 0 < height <= 320):
+        raise argparse.ArgumentTypeError("크기는 화면(240x320) 이하")
+    return (width, height)
+
+if __name__ == "__main__":
+    print("이 파일은 입력 읽기 모듈입니다. 아이콘은 util/sprite_atlas.py, 큰 이미지는 util/asset_pack.py 를 쓰세요.")
+    exit(1)
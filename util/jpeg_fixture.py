@@ -0,0 +1,337 @@
+#!/usr/bin/env python3
+"""
+배경 이미지(JpegDecoder) 회귀 검사용 baseline JPEG 만들기 / 확인
+- make  : 고정된 무늬를 baseline JPEG 로 부호화 (외부 라이브러리 없음, 같은 입력이면 항상 같은 파일)
+          util/golden/bg_420/bg_user.jpg   228x300 YCbCr 4:2:0, DRI 5 (재시작이 MCU 줄 중간에 걸림), 가장자리 MCU 잘림
+          util/golden/bg_gray/bg_user.jpg  240x320 흑백, 재시작 없음 (MCU 줄 40개 = JPEG_MAX_ROWS)
+- check : 호스트 골든(USER_MODE_BG*.qgi)에서 배경이 보이는 픽셀을 원본 무늬와 비교 (PSNR, 이미지 밖은 채움색과 일치)
+          펌웨어 디코더가 부호화기와 따로 맞는지 보는 검사 - 골든 비교는 그 결과가 바뀌지 않았는지만 봄
+
+  python3 util/jpeg_fixture.py make [util/golden]
+  python3 util/jpeg_fixture.py check [util/golden]
+"""
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+# ===== 무늬 =====
+
+FIXTURES = [
+    # (디렉터리, 너비, 높이, 색 여부, 재시작 간격)
+    ('bg_420', 228, 300, True, 5),
+    ('bg_gray', 240, 320, False, 0),
+]
+QUALITY = 85
+FILL_RGB565 = 0xDF1E  # main.cpp COLOR_USER_BG (이미지 밖 채움색)
+
+
+def pattern(x, y):
+    """부드러운 그라데이션 + 날카로운 경계(원, 줄무늬) - DC/AC 가 고르게 나오게"""
+    r = 128 + 90 * math.sin(x / 29.0) * math.cos(y / 41.0)
+    g = 40 + 0.5 * y + 20 * math.sin((x + y) / 17.0)
+    b = 200 - 0.6 * x + 30 * math.cos(y / 13.0)
+    if (x - 150) ** 2 + (y - 90) ** 2 < 45 ** 2:
+        r, g, b = 240, 200, 40
+    if 200 <= y < 240 and (x // 12) % 2 == 0:
+        r, g, b = r * 0.3, g * 0.3, b * 0.3
+    return tuple(max(0, min(255, int(round(c)))) for c in (r, g, b))
+
+
+def gray(rgb):
+    r, g, b = rgb
+    v = int(round(0.299 * r + 0.587 * g + 0.114 * b))
+    return (v, v, v)
+
+
+def source_pixels(width, height, color):
+    rows = []
+    for y in range(height):
+        row = []
+        for x in range(width):
+            p = pattern(x, y)
+            row.append(p if color else gray(p))
+        rows.append(row)
+    return rows
+
+# ===== 부호화 (ITU T.81 baseline, 부록 K 표) =====
+
+ZIGZAG = [
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+]
+
+LUMA_QUANT = [
+    16, 11, 10, 16, 24, 40, 51, 61, 12, 12, 14, 19, 26, 58, 60, 55,
+    14, 13, 16, 24, 40, 57, 69, 56, 14, 17, 22, 29, 51, 87, 80, 62,
+    18, 22, 37, 56, 68, 109, 103, 77, 24, 35, 55, 64, 81, 104, 113, 92,
+    49, 64, 78, 87, 103, 121, 120, 101, 72, 92, 95, 98, 112, 100, 103, 99,
+]
+CHROMA_QUANT = [
+    17, 18, 24, 47, 99, 99, 99, 99, 18, 21, 26, 66, 99, 99, 99, 99,
+    24, 26, 56, 99, 99, 99, 99, 99, 47, 66, 99, 99, 99, 99, 99, 99,
+] + [99] * 32
+
+DC_LUMA = ([0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0], list(range(12)))
+DC_CHROMA = ([0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0], list(range(12)))
+AC_LUMA = ([0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D], bytes.fromhex(
+    "01020300041105122131410613516107227114328191a1082342b1c11552d1f02433627282090a161718191a25262728292a3435"
+    "363738393a434445464748494a535455565758595a636465666768696a737475767778797a838485868788898a92939495969798"
+    "999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae1e2e3e4e5e6e7e8e9eaf1f2f3f4"
+    "f5f6f7f8f9fa"))
+AC_CHROMA = ([0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77], bytes.fromhex(
+    "000102031104052131061241510761711322328108144291a1b1c109233352f0156272d10a162434e125f11718191a262728292a"
+    "35363738393a434445464748494a535455565758595a636465666768696a737475767778797a82838485868788898a9293949596"
+    "9798999aa2a3a4a5a6a7a8a9aab2b3b4b5b6b7b8b9bac2c3c4c5c6c7c8c9cad2d3d4d5d6d7d8d9dae2e3e4e5e6e7e8e9eaf2f3f4"
+    "f5f6f7f8f9fa"))
+
+COS = [[math.cos((2 * x + 1) * u * math.pi / 16) * (math.sqrt(0.5) if u == 0 else 1.0) / 2 for x in range(8)]
+       for u in range(8)]
+
+
+def scaled_quant(table, quality):
+    scale = 5000 // quality if quality < 50 else 200 - quality * 2
+    return [max(1, min(255, (q * scale + 50) // 100)) for q in table]
+
+
+def huffman_codes(spec):
+    counts, values = spec
+    codes = {}
+    code = 0
+    k = 0
+    for length in range(1, 17):
+        for _ in range(counts[length - 1]):
+            codes[values[k]] = (code, length)
+            code += 1
+            k += 1
+        code <<= 1
+    return codes
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.count = 0
+
+    def put(self, value, length):
+        for i in range(length - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.count += 1
+            if self.count == 8:
+                self.out.append(self.acc)
+                if self.acc == 0xFF:
+                    self.out.append(0x00)
+                self.acc = 0
+                self.count = 0
+
+    def align(self):
+        # 남은 비트는 1 로 채움
+        while self.count:
+            self.put(1, 1)
+
+
+def category(v):
+    v = abs(v)
+    n = 0
+    while v:
+        n += 1
+        v >>= 1
+    return n
+
+
+def fdct_quant(block, quant):
+    """8x8 (0~255) → 지그재그 순서 양자화 계수"""
+    shifted = [[block[y][x] - 128 for x in range(8)] for y in range(8)]
+    tmp = [[sum(COS[u][x] * shifted[y][x] for x in range(8)) for u in range(8)] for y in range(8)]
+    coef = [0] * 64
+    for v in range(8):
+        for u in range(8):
+            value = sum(COS[v][y] * tmp[y][u] for y in range(8))
+            coef[v * 8 + u] = value
+    return [int(round(coef[ZIGZAG[k]] / quant[k])) for k in range(64)]
+
+
+def encode_block(bits, zz, prev_dc, dc_codes, ac_codes):
+    diff = zz[0] - prev_dc
+    n = category(diff)
+    bits.put(*dc_codes[n])
+    if n:
+        bits.put(diff if diff > 0 else diff + (1 << n) - 1, n)
+    run = 0
+    for k in range(1, 64):
+        v = zz[k]
+        if v == 0:
+            run += 1
+            continue
+        while run > 15:
+            bits.put(*ac_codes[0xF0])
+            run -= 16
+        n = category(v)
+        bits.put(*ac_codes[(run << 4) | n])
+        bits.put(v if v > 0 else v + (1 << n) - 1, n)
+        run = 0
+    if run:
+        bits.put(*ac_codes[0x00])
+    return zz[0]
+
+
+def plane_block(plane, bx, by):
+    height = len(plane)
+    width = len(plane[0])
+    return [[plane[min(by + y, height - 1)][min(bx + x, width - 1)] for x in range(8)] for y in range(8)]
+
+
+def encode(pixels, color, restart):
+    height = len(pixels)
+    width = len(pixels[0])
+    lq = scaled_quant(LUMA_QUANT, QUALITY)
+    cq = scaled_quant(CHROMA_QUANT, QUALITY)
+
+    if color:
+        ys, cbs, crs = [], [], []
+        for row in pixels:
+            ys.append([0.299 * r + 0.587 * g + 0.114 * b for r, g, b in row])
+            cbs.append([-0.168736 * r - 0.331264 * g + 0.5 * b + 128 for r, g, b in row])
+            crs.append([0.5 * r - 0.418688 * g - 0.081312 * b + 128 for r, g, b in row])
+
+        # 4:2:0 - 2x2 평균 (가장자리는 복제)
+        def down(plane):
+            h2, w2 = (height + 1) // 2, (width + 1) // 2
+            return [[sum(plane[min(2 * y + dy, height - 1)][min(2 * x + dx, width - 1)]
+                         for dy in (0, 1) for dx in (0, 1)) / 4 for x in range(w2)] for y in range(h2)]
+        cbs, crs = down(cbs), down(crs)
+        mcu = 16
+    else:
+        ys = [[r for r, _, _ in row] for row in pixels]
+        mcu = 8
+
+    dc_l, ac_l = huffman_codes(DC_LUMA), huffman_codes(AC_LUMA)
+    dc_c, ac_c = huffman_codes(DC_CHROMA), huffman_codes(AC_CHROMA)
+    bits = BitWriter()
+    mcus_x = (width + mcu - 1) // mcu
+    mcus_y = (height + mcu - 1) // mcu
+    total = mcus_x * mcus_y
+    dc = [0, 0, 0]
+    marker = 0
+    for index in range(total):
+        if restart and index and index % restart == 0:
+            bits.align()
+            bits.out += bytes([0xFF, 0xD0 + marker])
+            marker = (marker + 1) % 8
+            dc = [0, 0, 0]
+        mx, my = index % mcus_x, index // mcus_x
+        if color:
+            for by in (0, 8):
+                for bx in (0, 8):
+                    zz = fdct_quant(plane_block(ys, mx * 16 + bx, my * 16 + by), lq)
+                    dc[0] = encode_block(bits, zz, dc[0], dc_l, ac_l)
+            dc[1] = encode_block(bits, fdct_quant(plane_block(cbs, mx * 8, my * 8), cq), dc[1], dc_c, ac_c)
+            dc[2] = encode_block(bits, fdct_quant(plane_block(crs, mx * 8, my * 8), cq), dc[2], dc_c, ac_c)
+        else:
+            dc[0] = encode_block(bits, fdct_quant(plane_block(ys, mx * 8, my * 8), lq), dc[0], dc_l, ac_l)
+    bits.align()
+
+    def segment(marker_byte, body):
+        return bytes([0xFF, marker_byte]) + struct.pack('>H', len(body) + 2) + body
+
+    out = bytearray(b'\xFF\xD8')
+    out += segment(0xE0, b'JFIF\x00\x01\x01\x00\x00\x01\x00\x01\x00\x00')
+    out += segment(0xDB, bytes([0x00]) + bytes(lq) + (bytes([0x01]) + bytes(cq) if color else b''))
+    components = [(1, 0x22 if color else 0x11, 0)] + ([(2, 0x11, 1), (3, 0x11, 1)] if color else [])
+    sof = struct.pack('>BHHB', 8, height, width, len(components))
+    for cid, sampling, q in components:
+        sof += bytes([cid, sampling, q])
+    out += segment(0xC0, sof)
+    tables = [(0x00, DC_LUMA), (0x10, AC_LUMA)] + ([(0x01, DC_CHROMA), (0x11, AC_CHROMA)] if color else [])
+    for info, (counts, values) in tables:
+        out += segment(0xC4, bytes([info]) + bytes(counts) + bytes(values))
+    if restart:
+        out += segment(0xDD, struct.pack('>H', restart))
+    sos = bytes([len(components)])
+    for cid, _, q in components:
+        sos += bytes([cid, 0x00 if q == 0 else 0x11])
+    out += segment(0xDA, sos + bytes([0, 63, 0]))
+    out += bits.out
+    out += b'\xFF\xD9'
+    return bytes(out)
+
+# ===== 확인 =====
+
+def read_qgi(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'QGI1':
+        raise ValueError(f"{path}: QGI1 이 아닙니다")
+    width, height = struct.unpack_from('<HH', data, 4)
+    pixels = []
+    for pos in range(8, len(data), 4):
+        run, color = struct.unpack_from('<HH', data, pos)
+        pixels.extend([color] * run)
+    return width, height, pixels
+
+
+def rgb565(rgb):
+    r, g, b = rgb
+    return (r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3
+
+
+def channels565(c):
+    return ((c >> 11) & 0x1F) << 3, ((c >> 5) & 0x3F) << 2, (c & 0x1F) << 3
+
+
+def check(golden, plain, name, width, height, color):
+    """배경이 그대로 보이는 픽셀(단색 USER_MODE 에서 배경색인 곳)만 비교"""
+    gw, gh, bg = read_qgi(os.path.join(golden, name + '.qgi'))
+    _, _, base = read_qgi(os.path.join(golden, plain + '.qgi'))
+    fill_wire = FILL_RGB565 ^ 0xFFFF
+    source = source_pixels(width, height, color)
+    err = 0.0
+    compared = 0
+    fill_bad = 0
+    for y in range(gh):
+        for x in range(gw):
+            i = y * gw + x
+            if base[i] != fill_wire:
+                continue  # 위젯이 덮은 자리
+            shown = bg[i] ^ 0xFFFF
+            if x >= width or y >= height:
+                fill_bad += shown != FILL_RGB565
+                continue
+            a = channels565(shown)
+            b = channels565(rgb565(source[y][x]))
+            err += sum((p - q) ** 2 for p, q in zip(a, b)) / 3
+            compared += 1
+    psnr = 10 * math.log10(255 ** 2 / (err / compared)) if err else float('inf')
+    ok = psnr >= 30 and fill_bad == 0
+    print(f"{name:22s} {compared} px PSNR {psnr:.1f} dB, fill mismatches {fill_bad} {'ok' if ok else 'FAIL'}")
+    return ok
+
+
+def main():
+    parser = argparse.ArgumentParser(description="배경 이미지 회귀 검사용 JPEG 만들기 / 확인")
+    parser.add_argument('command', choices=['make', 'check'])
+    parser.add_argument('golden', nargs='?', default='util/golden', help='골든 디렉터리 (기본 util/golden)')
+    args = parser.parse_args()
+
+    if args.command == 'make':
+        for directory, width, height, color, restart in FIXTURES:
+            path = os.path.join(args.golden, directory, 'bg_user.jpg')
+            os.makedirs(os.path.dirname(path), exist_ok=True)
+            data = encode(source_pixels(width, height, color), color, restart)
+            with open(path, 'wb') as f:
+                f.write(data)
+            print(f"{path}: {width}x{height} {'4:2:0' if color else 'gray'} DRI {restart}, {len(data)} bytes")
+        return 0
+
+    ok = check(args.golden, 'USER_MODE', 'USER_MODE_BG', 228, 300, True)
+    ok &= check(args.golden, 'USER_MODE', 'USER_MODE_BG_GRAY', 240, 320, False)
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
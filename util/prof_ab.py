@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+핫 경로 배치 전후 비교표
+- 보드에서 같은 터치 기록을 -D QMS_IRAM_HOT=0 / 1 빌드로 재생(replay)하고 받은 시리얼 로그 두 개를 읽어
+  구간 프로파일(prof 표)의 평균 사이클을 자리별로 비교한 Markdown 표를 출력 (readme "핫 경로 배치"에 붙임)
+- 로그에서 "Profile (...)" 으로 시작하는 마지막 표를 씀 (재생 끝 출력 또는 prof 명령)
+- 호스트 빌드의 표는 가상 시계라 사이클이 0 이므로 받지 않음
+"""
+
+import argparse
+import re
+import sys
+
+HEADER = re.compile(r'^Profile \((\w+), (\d+) MHz\) cycles')
+
+
+def read_profile(path):
+    """로그의 마지막 prof 표 → (배치, {이름: (횟수, 평균, 최소, 최대)})"""
+    placement = None
+    sites = {}
+    with open(path, encoding='utf-8', errors='replace') as f:
+        for line in f:
+            line = line.rstrip('\r\n')
+            match = HEADER.match(line)
+            if match:
+                placement = match.group(1)
+                sites = {}
+                continue
+            if placement is None or not line.startswith('  '):
+                continue
+            fields = line.strip().split(' / ')
+            if len(fields) != 5:
+                continue
+            name, count = fields[0].rsplit(' ', 1)
+            sites[name] = (int(count), int(fields[1]), int(fields[2]), int(fields[3]))
+    if placement is None:
+        raise ValueError(f"{path}: Profile 표가 없습니다")
+    if placement == 'host':
+        raise ValueError(f"{path}: 호스트 빌드 표입니다 (사이클 없음) - 보드 로그를 주세요")
+    return placement, sites
+
+
+def main():
+    parser = argparse.ArgumentParser(description="QMS_IRAM_HOT=0 / 1 보드 재생 로그의 prof 표 비교")
+    parser.add_argument('flash_log', help='-D QMS_IRAM_HOT=0 빌드 로그')
+    parser.add_argument('iram_log', help='-D QMS_IRAM_HOT=1 빌드 로그')
+    args = parser.parse_args()
+
+    try:
+        before_place, before = read_profile(args.flash_log)
+        after_place, after = read_profile(args.iram_log)
+    except ValueError as e:
+        print(f"❌ {e}")
+        return 1
+    if before_place != 'flash' or after_place != 'IRAM':
+        print(f"❌ 배치가 flash / IRAM 이어야 합니다 (받은 것: {before_place} / {after_place})")
+        return 1
+
+    print("| 구간 | 횟수 | flash 평균 | IRAM 평균 | 변화 | flash 최대 | IRAM 최대 |")
+    print("|------|------|-----------|-----------|------|-----------|-----------|")
+    for name in sorted(set(before) | set(after)):
+        if name not in before or name not in after:
+            print(f"| {name} | - | {before.get(name, ('-', '-'))[1]} | {after.get(name, ('-', '-'))[1]} | - | - | - |")
+            continue
+        b, a = before[name], after[name]
+        change = f"{(a[1] - b[1]) * 100.0 / b[1]:+.1f} %" if b[1] else "-"
+        note = "" if a[0] == b[0] else f" (횟수 {b[0]} → {a[0]})"
+        print(f"| {name}{note} | {a[0]} | {b[1]} | {a[1]} | {change} | {b[3]} | {a[3]} |")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,405 @@
+#!/usr/bin/env python3
+"""
+관리용 바이너리 명령 도구 (시리얼)
+- ping    : 연결/버전 확인
+- enqueue : 번호 N 개 발행 (원격 발행, 수용 판단은 키오스크와 같음)
+- dequeue : 맨 앞부터 N 명 처리
+- delete  : 번호로 대기열에서 삭제
+- set     : 설정 변경 (process / maxwait / closing / clock)
+- dump    : 상태와 대기 번호 목록
+- load    : 발행/처리 배치를 겹쳐 보내며 초당 처리 건수와 응답 시간 측정
+- check   : 호스트 빌드를 pty 로 직접 띄워 정해진 순서의 명령/깨진 프레임을 보내고 결과 확인 (회귀 검사, 실패하면 종료 코드 1)
+
+보드 없이 시험할 때는 호스트 빌드를 pty 로 띄우고 그 경로를 --port 로 줌
+  ./qms_native --pty /tmp/qms &
+  python3 util/qms_link.py --port /tmp/qms dump
+  python3 util/qms_link.py check [--native ./qms_native]
+
+프레임 포맷은 include/admin_link.h 참고
+"""
+
+import argparse
+import os
+import signal
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+FRAME_SYNC = 0xA5
+FRAME_REQUEST = ord('C')
+FRAME_REPLY = ord('R')
+HEADER_LEN = 6
+PAYLOAD_MAX = 512
+
+PING, ENQUEUE, DEQUEUE, DELETE, SET, DUMP = 0x01, 0x10, 0x11, 0x12, 0x20, 0x30
+STATUS = ["OK", "BAD_OP", "BAD_LENGTH", "BAD_VALUE"]
+ADMISSION = ["OK", "QUEUE_FULL", "WAIT_TOO_LONG", "CLOSING"]
+SETTINGS = {'process': 1, 'maxwait': 2, 'closing': 3, 'clock': 4}
+SCREENS = ["USER_MODE", "ADMIN_LOGIN", "ADMIN_MODE", "TICKET_ISSUED", "QUEUE_FULL", "CALL_MODAL",
+           "QUEUE_LIST", "QUEUE_DELETE_CONFIRM", "TIME_SETTING", "PASSWORD_CHANGE", "STATS_CHART"]
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) & 0xFFFF if crc & 0x8000 else (crc << 1) & 0xFFFF
+    return crc
+
+
+def encode(seq, op, payload=b""):
+    body = struct.pack("<HBB", len(payload), seq, op) + payload
+    return bytes([FRAME_SYNC, FRAME_REQUEST]) + body + struct.pack("<H", crc16(body))
+
+
+class PosixPort:
+    """pyserial 이 없을 때 (pty/tty 를 raw 로 직접 엶)"""
+
+    def __init__(self, path, baud):
+        import termios
+        import tty
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+        tty.setraw(self.fd)
+        speed = getattr(termios, f"B{baud}", None)
+        if speed is not None:
+            attrs = termios.tcgetattr(self.fd)
+            attrs[4] = attrs[5] = speed
+            termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+        termios.tcflush(self.fd, termios.TCIFLUSH)
+
+    def write(self, data):
+        view = memoryview(data)
+        while view:
+            try:
+                view = view[os.write(self.fd, view):]
+            except BlockingIOError:
+                time.sleep(0.001)
+
+    def read(self, timeout):
+        import select
+        ready, _, _ = select.select([self.fd], [], [], timeout)
+        if not ready:
+            return b""
+        try:
+            return os.read(self.fd, 4096)
+        except BlockingIOError:
+            return b""
+
+    def close(self):
+        os.close(self.fd)
+
+
+class SerialPort:
+    def __init__(self, path, baud):
+        import serial
+        self.port = serial.Serial(path, baud, timeout=0)
+        self.port.reset_input_buffer()
+
+    def write(self, data):
+        self.port.write(data)
+
+    def read(self, timeout):
+        end = time.time() + timeout
+        while True:
+            data = self.port.read(4096)
+            if data or time.time() >= end:
+                return data
+            time.sleep(0.0005)
+
+    def close(self):
+        self.port.close()
+
+
+def open_port(path, baud):
+    try:
+        return SerialPort(path, baud)
+    except ImportError:
+        return PosixPort(path, baud)
+
+
+class Link:
+    def __init__(self, port):
+        self.port = port
+        self.rx = bytearray()
+        self.text = bytearray()   # 응답 프레임 사이에 섞인 텍스트 출력
+        self.seq = 0
+
+    def send(self, op, payload=b""):
+        self.seq = (self.seq + 1) & 0xFF
+        self.port.write(encode(self.seq, op, payload))
+        return self.seq
+
+    def replies(self, timeout):
+        """timeout 안에 도착한 응답 (seq, op, payload) - 사이에 섞인 텍스트 출력은 건너뜀"""
+        out = []
+        data = self.port.read(timeout)
+        self.rx += data
+        i = 0
+        while i + HEADER_LEN <= len(self.rx):
+            if self.rx[i] != FRAME_SYNC or self.rx[i + 1] != FRAME_REPLY:
+                self.text.append(self.rx[i])
+                i += 1
+                continue
+            n, seq, op = struct.unpack_from("<HBB", self.rx, i + 2)
+            end = i + HEADER_LEN + n
+            if n > PAYLOAD_MAX:
+                i += 1
+                continue
+            if end + 2 > len(self.rx):
+                break
+            if crc16(self.rx[i + 2:end]) != struct.unpack_from("<H", self.rx, end)[0]:
+                i += 1
+                continue
+            out.append((seq, op, bytes(self.rx[i + HEADER_LEN:end])))
+            i = end + 2
+        del self.rx[:i]
+        return out
+
+    def call(self, op, payload=b"", timeout=2.0):
+        seq = self.send(op, payload)
+        end = time.time() + timeout
+        while time.time() < end:
+            for rseq, rop, body in self.replies(0.05):
+                if rseq == seq and rop == op:
+                    if body[0] != 0:
+                        raise RuntimeError(f"status {STATUS[body[0]] if body[0] < len(STATUS) else body[0]}")
+                    return body[1:]
+        raise TimeoutError("no reply")
+
+
+def parse_setting(key, text):
+    """closing/clock 은 HH:MM 도 받음, closing off = -1"""
+    if key == 'closing' and text == 'off':
+        return -1
+    if key in ('closing', 'clock') and ':' in text:
+        hh, mm = text.split(':')
+        return int(hh) * 3600 + int(mm) * 60
+    return int(text)
+
+
+def print_dump(body):
+    (ticket, count, wait, process, maxwait, closing, served, frames, errors,
+     screen, listed) = struct.unpack_from("<HHIHiiIIIBH", body)
+    tickets = struct.unpack_from(f"<{listed}H", body, struct.calcsize("<HHIHiiIIIBH"))
+    print(f"screen {SCREENS[screen] if screen < len(SCREENS) else screen}, last ticket #{ticket}")
+    print(f"queue {count}, expected wait {wait // 60}m {wait % 60}s, process {process}s/person")
+    print(f"max wait {maxwait}s, closing {'off' if closing < 0 else f'{closing // 3600:02}:{closing // 60 % 60:02}'}")
+    print(f"served {served}, link frames {frames}, errors {errors}")
+    if tickets:
+        more = f" (+{count - listed})" if count > listed else ""
+        print("waiting: " + " ".join(f"#{t}" for t in tickets) + more)
+
+
+def run_load(link, seconds, batch, window):
+    """발행 batch 개 / 처리 batch 개를 번갈아 window 개까지 응답을 기다리지 않고 보냄"""
+    pending = {}
+    latencies = []
+    ops = frames = 0
+    toggle = False
+    end = time.time() + seconds
+    start = time.time()
+    while time.time() < end or pending:
+        while time.time() < end and len(pending) < window:
+            op = DEQUEUE if toggle else ENQUEUE
+            toggle = not toggle
+            seq = link.send(op, bytes([batch]))
+            pending[seq] = time.time()
+        for seq, op, body in link.replies(0.01):
+            sent = pending.pop(seq, None)
+            if sent is None:
+                continue
+            latencies.append(time.time() - sent)
+            frames += 1
+            if body[0] == 0:
+                ops += body[1]
+        if time.time() > end + 2:
+            break
+    elapsed = time.time() - start
+    latencies.sort()
+    print(f"{frames} frames, {ops} queue ops in {elapsed:.2f}s: {ops / elapsed:.0f} ops/s, "
+          f"{frames / elapsed:.0f} frames/s, lost {len(pending)}")
+    if latencies:
+        p50 = latencies[len(latencies) // 2] * 1000
+        p99 = latencies[min(len(latencies) - 1, len(latencies) * 99 // 100)] * 1000
+        print(f"round trip p50 {p50:.1f} ms, p99 {p99:.1f} ms (window {window}, batch {batch})")
+
+
+def run_check(native):
+    """qms_native --pty 에 정해진 순서로 보내고 응답/오류 수 확인 (빈 SPIFFS 디렉터리에서 시작)"""
+    fs = tempfile.TemporaryDirectory()
+    proc = subprocess.Popen([native, '--pty'], stdout=subprocess.PIPE,
+                            env=dict(os.environ, QMS_HOST_FS=fs.name))
+    path = proc.stdout.readline().decode().strip()
+    port = PosixPort(path, 115200)
+    link = Link(port)
+    failures = 0
+
+    def expect(name, ok, detail=""):
+        nonlocal failures
+        print(f"{name:22s} {'ok' if ok else 'FAIL'}{'' if ok else ' ' + detail}")
+        failures += not ok
+
+    def silent(frame, seq):
+        """버려야 할 프레임 뒤에 ping - ping 응답만 오고 버린 프레임의 응답은 없어야 함"""
+        port.write(frame)
+        ping = link.send(PING)
+        seqs = []
+        end = time.time() + 1.0
+        while time.time() < end and ping not in seqs:
+            seqs += [rseq for rseq, _, _ in link.replies(0.05)]
+        return ping in seqs and seq not in seqs, f"replies {seqs}"
+
+    def setting(key, value):
+        return struct.unpack("<i", link.call(SET, struct.pack("<Bi", SETTINGS[key], value)))[0]
+
+    def dump():
+        body = link.call(DUMP)
+        fields = struct.unpack_from("<HHIHiiIIIBH", body)
+        tickets = struct.unpack_from(f"<{fields[10]}H", body, struct.calcsize("<HHIHiiIIIBH"))
+        return fields, tickets
+
+    try:
+        time.sleep(0.3)   # setup() 출력이 지나가게
+        link.replies(0.05)
+        version, payload_max = struct.unpack("<BH", link.call(PING))
+        expect("ping", (version, payload_max) == (1, PAYLOAD_MAX), f"v{version} {payload_max}")
+        applied = [setting('clock', 9 * 3600), setting('closing', -1), setting('maxwait', 0), setting('process', 60)]
+        expect("set", applied == [9 * 3600, -1, 0, 60], str(applied))
+
+        (last, count, *_, frames, errors, _, _), _ = dump()
+        issued, first, stopped = struct.unpack("<BHB", link.call(ENQUEUE, bytes([30])))
+        expect("enqueue batch", (issued, first, stopped) == (30, last + 1, 0), f"{issued} #{first} stop {stopped}")
+        served = link.call(DEQUEUE, bytes([5]))[0]
+        expect("dequeue batch", served == 5, f"served {served}")
+        deleted = struct.unpack("<H", link.call(DELETE, struct.pack("<3H", first + 5, first + 6, 60000)))[0]
+        expect("delete batch", deleted == 2, f"deleted {deleted}")
+        (_, now_count, *_), tickets = dump()
+        expect("dump", now_count == count + 23 and first + 7 in tickets and first + 5 not in tickets,
+               f"queue {now_count}, {tickets[:4]}")
+        setting('closing', 9 * 3600)
+        issued, _, stopped = struct.unpack("<BHB", link.call(ENQUEUE, bytes([3])))
+        expect("enqueue closing", (issued, stopped) == (0, 3), f"{issued} stop {stopped}")
+        setting('closing', -1)
+
+        seq = (link.seq + 1) & 0xFF
+        frame = bytearray(encode(seq, PING))
+        frame[-1] ^= 0xFF
+        link.seq = seq
+        expect("bad crc", *silent(bytes(frame), seq))
+        # 길이가 최대를 넘는 프레임은 CRC 가 맞고 다 도착해도 버림 (나머지는 다음 0xA5 까지 건너뜀)
+        seq = (link.seq + 1) & 0xFF
+        frame = encode(seq, PING, bytes(PAYLOAD_MAX + 88))
+        link.seq = seq
+        expect("oversize length", *silent(frame, seq))
+        # 종류가 틀린 헤더 뒤의 줄은 텍스트 명령으로 넘기지 않고, 다음 줄부터 다시 텍스트
+        link.text.clear()
+        port.write(b"\xa5Xjunk\nlink\n")
+        end = time.time() + 1.0
+        while time.time() < end and b"Link:" not in link.text:
+            link.replies(0.05)
+        expect("resync to text", b"Link:" in link.text and b"Commands:" not in link.text, link.text.decode(errors='replace'))
+        # 헤더만 오고 끊긴 프레임은 잠시 뒤 버림
+        port.write(bytes([FRAME_SYNC, FRAME_REQUEST, 2, 0, 0, PING]))
+        time.sleep(0.4)
+        expect("stalled frame", *silent(b"", -1))
+
+        (*_, now_frames, now_errors, _, _), _ = dump()
+        # 기준 덤프 뒤 받은 요청: 발행 2 + 처리 + 삭제 + 설정 2 + ping 3 + 덤프 2 (이 덤프 포함)
+        # 버린 것: CRC, 길이 초과, 종류, 끊긴 프레임
+        expect("frame/error counts", (now_frames - frames, now_errors - errors) == (11, 4),
+               f"frames +{now_frames - frames}, errors +{now_errors - errors}")
+    except (RuntimeError, TimeoutError) as e:
+        expect("link", False, str(e))
+    finally:
+        port.close()
+        proc.send_signal(signal.SIGTERM)
+        proc.wait()
+        fs.cleanup()
+
+    if failures:
+        print(f"{failures} check(s) failed")
+        return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="관리용 바이너리 명령 (시리얼)")
+    parser.add_argument('--port', help='시리얼 포트 또는 qms_native --pty 경로 (check 는 필요 없음)')
+    parser.add_argument('--baud', type=int, default=115200)
+    sub = parser.add_subparsers(dest='cmd', required=True)
+
+    sub.add_parser('ping', help='연결/버전 확인')
+    p = sub.add_parser('enqueue', help='번호 N 개 발행')
+    p.add_argument('count', type=int)
+    p = sub.add_parser('dequeue', help='맨 앞부터 N 명 처리')
+    p.add_argument('count', type=int)
+    p = sub.add_parser('delete', help='번호로 삭제')
+    p.add_argument('tickets', type=int, nargs='+')
+    p = sub.add_parser('set', help='설정 변경')
+    p.add_argument('key', choices=sorted(SETTINGS))
+    p.add_argument('value', help='초, closing/clock 은 HH:MM, closing off')
+    sub.add_parser('dump', help='상태 덤프')
+    p = sub.add_parser('load', help='부하 시험')
+    p.add_argument('--seconds', type=float, default=10)
+    p.add_argument('--batch', type=int, default=20)
+    p.add_argument('--window', type=int, default=8)
+    p = sub.add_parser('check', help='호스트 빌드 pty 회귀 검사')
+    p.add_argument('--native', default='./qms_native', help='호스트 빌드 실행 파일')
+
+    args = parser.parse_args()
+    if args.cmd == 'check':
+        return run_check(args.native)
+    if not args.port:
+        parser.error('--port is required')
+    port = open_port(args.port, args.baud)
+    link = Link(port)
+    try:
+        if args.cmd == 'ping':
+            version, payload_max = struct.unpack("<BH", link.call(PING))
+            print(f"link v{version}, payload up to {payload_max} bytes")
+        elif args.cmd in ('enqueue', 'dequeue'):
+            op = ENQUEUE if args.cmd == 'enqueue' else DEQUEUE
+            remaining = args.count
+            while remaining > 0:
+                step = min(remaining, 255)
+                body = link.call(op, bytes([step]))
+                if op == ENQUEUE:
+                    issued, first, stopped = struct.unpack("<BHB", body)
+                    if issued:
+                        print(f"issued #{first}..#{first + issued - 1}")
+                    if stopped:
+                        print(f"stopped: {ADMISSION[stopped]}")
+                        break
+                else:
+                    issued = body[0]
+                    print(f"served {issued}")
+                if issued < step:
+                    break
+                remaining -= step
+        elif args.cmd == 'delete':
+            deleted = 0
+            per_frame = PAYLOAD_MAX // 2
+            for i in range(0, len(args.tickets), per_frame):
+                chunk = args.tickets[i:i + per_frame]
+                deleted += struct.unpack("<H", link.call(DELETE, struct.pack(f"<{len(chunk)}H", *chunk)))[0]
+            print(f"deleted {deleted} of {len(args.tickets)}")
+        elif args.cmd == 'set':
+            value = parse_setting(args.key, args.value)
+            applied = struct.unpack("<i", link.call(SET, struct.pack("<Bi", SETTINGS[args.key], value)))[0]
+            print(f"{args.key} = {applied}")
+        elif args.cmd == 'dump':
+            print_dump(link.call(DUMP))
+        else:
+            run_load(link, args.seconds, args.batch, args.window)
+    except (RuntimeError, TimeoutError) as e:
+        print(f"{args.cmd}: {e}", file=sys.stderr)
+        return 1
+    finally:
+        port.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
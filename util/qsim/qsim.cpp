@@ -0,0 +1,346 @@
+// 대기열 이산 사건 시뮬레이터 (호스트 전용)
+//
+// 펌웨어의 대기열/ETA 코드(src/qms_queue.cpp, src/ticket_log.cpp, src/admission.cpp)를
+// 그대로 링크하고, millis() 대신 가상 시계를 넘겨서 구동한다.
+// Arduino 런타임을 쓰지 않으며 같은 시드면 결과가 항상 같다.
+//
+// 빌드 (저장소 루트에서):
+//   g++ -O2 -std=c++17 -Iinclude util/qsim/qsim.cpp src/qms_queue.cpp src/ticket_log.cpp src/admission.cpp -o qsim
+// 대기열 크기를 바꿔 보려면 -DQUEUE_CAPACITY=400 -DTICKET_ARENA_SIZE=512 을 추가
+//
+// 사용 예시:
+//   ./qsim --customers 1000000 --rate 50 --service exp --process-time 60
+//   ./qsim --service firmware --rate 55 --capacity 15 --max-wait 900
+//   ./qsim --arrivals trace.txt   (한 줄에 "도착시각(초) [처리시간(초)]")
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+#include "qms_queue.h"
+#include "admission.h"
+
+#define MAX_COUNTERS 16
+#define HIST_BINS (7 * 24 * 3600)   // 1초 단위, 최대 1주
+#define NEVER 0xFFFFFFFFFFFFFFFFULL
+
+// ===== 결정적 난수 (splitmix64) =====
+
+static uint64_t rngState = 1;
+
+static uint64_t nextRandom() {
+  uint64_t z = (rngState += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// (0, 1] 구간 균등분포
+static double uniform01() {
+  return ((nextRandom() >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+static double gaussian() {
+  // Box-Muller (값 하나만 사용해 상태를 단순하게 유지)
+  return sqrt(-2.0 * log(uniform01())) * cos(6.283185307179586 * uniform01());
+}
+
+// ===== 설정 =====
+
+enum ServiceModel { SERVICE_FIRMWARE, SERVICE_FIXED, SERVICE_EXP, SERVICE_LOGNORMAL };
+
+struct SimConfig {
+  uint64_t customers = 1000000;
+  uint64_t seed = 1;
+  double arrivalsPerHour = 50;
+  ServiceModel service = SERVICE_EXP;
+  double serviceMeanSec = -1;   // -1 = process-time 과 동일
+  double serviceCv = 0.5;       // lognormal 변동계수
+  int processTimeSec = 60;      // 펌웨어 userProcessTimeSec (ETA 모델 입력)
+  int counters = 1;
+  int capacity = QUEUE_CAPACITY;
+  int maxWaitSec = 0;
+  long closingAfterSec = -1;    // 시작 후 몇 초 뒤 마감 (매일 같은 시각)
+  const char* traceFile = nullptr;
+};
+
+// ===== 통계 =====
+
+struct Histogram {
+  std::vector<uint32_t> bins;
+  uint64_t count = 0;
+  double sum = 0;
+  Histogram() : bins(HIST_BINS + 1, 0) {}
+  void add(double sec) {
+    long b = (long)sec;
+    if (b < 0) b = 0;
+    if (b > HIST_BINS) b = HIST_BINS;
+    bins[b]++;
+    count++;
+    sum += sec;
+  }
+  double percentile(double p) const {
+    if (count == 0) return 0;
+    uint64_t target = (uint64_t)ceil(p * count);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < bins.size(); i++) {
+      seen += bins[i];
+      if (seen >= target) return (double)i;
+    }
+    return HIST_BINS;
+  }
+};
+
+struct Counter {
+  uint64_t finishUs;   // NEVER = 비어 있음
+  int ticket;
+  uint64_t startUs;
+};
+
+// ===== 시뮬레이션 =====
+
+static FILE* traceIn = nullptr;
+
+// 다음 도착 시각과 (트레이스에 있으면) 처리시간을 읽음
+static bool nextArrival(const SimConfig& cfg, uint64_t nowUs, uint64_t& arrivalUs, double& traceServiceSec) {
+  traceServiceSec = -1;
+  if (traceIn) {
+    char line[128];
+    while (fgets(line, sizeof(line), traceIn)) {
+      double t, svc;
+      int n = sscanf(line, "%lf %lf", &t, &svc);
+      if (n < 1) continue;
+      arrivalUs = (uint64_t)(t * 1e6);
+      if (n == 2) traceServiceSec = svc;
+      return true;
+    }
+    return false;
+  }
+  double gapSec = -log(uniform01()) * 3600.0 / cfg.arrivalsPerHour;
+  arrivalUs = nowUs + (uint64_t)(gapSec * 1e6);
+  return true;
+}
+
+static double drawServiceSec(const SimConfig& cfg) {
+  double mean = (cfg.serviceMeanSec > 0) ? cfg.serviceMeanSec : cfg.processTimeSec;
+  switch (cfg.service) {
+    case SERVICE_EXP:
+      return -log(uniform01()) * mean;
+    case SERVICE_LOGNORMAL: {
+      double s2 = log(1 + cfg.serviceCv * cfg.serviceCv);
+      return exp(log(mean) - s2 / 2 + sqrt(s2) * gaussian());
+    }
+    default:
+      return mean;
+  }
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: qsim [--customers N] [--seed S] [--rate PER_HOUR] [--arrivals FILE]\n"
+          "            [--service firmware|fixed|exp|lognormal] [--service-mean SEC] [--service-cv CV]\n"
+          "            [--process-time SEC] [--counters N] [--capacity N] [--max-wait SEC]\n"
+          "            [--closing-after SEC]\n");
+  exit(2);
+}
+
+static void parseArgs(int argc, char** argv, SimConfig& cfg) {
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+    if (!v) usage();
+    if (!strcmp(a, "--customers")) cfg.customers = strtoull(v, nullptr, 10);
+    else if (!strcmp(a, "--seed")) cfg.seed = strtoull(v, nullptr, 10);
+    else if (!strcmp(a, "--rate")) cfg.arrivalsPerHour = atof(v);
+    else if (!strcmp(a, "--arrivals")) cfg.traceFile = v;
+    else if (!strcmp(a, "--service")) {
+      if (!strcmp(v, "firmware")) cfg.service = SERVICE_FIRMWARE;
+      else if (!strcmp(v, "fixed")) cfg.service = SERVICE_FIXED;
+      else if (!strcmp(v, "exp")) cfg.service = SERVICE_EXP;
+      else if (!strcmp(v, "lognormal")) cfg.service = SERVICE_LOGNORMAL;
+      else usage();
+    }
+    else if (!strcmp(a, "--service-mean")) cfg.serviceMeanSec = atof(v);
+    else if (!strcmp(a, "--service-cv")) cfg.serviceCv = atof(v);
+    else if (!strcmp(a, "--process-time")) cfg.processTimeSec = atoi(v);
+    else if (!strcmp(a, "--counters")) cfg.counters = atoi(v);
+    else if (!strcmp(a, "--capacity")) cfg.capacity = atoi(v);
+    else if (!strcmp(a, "--max-wait")) cfg.maxWaitSec = atoi(v);
+    else if (!strcmp(a, "--closing-after")) cfg.closingAfterSec = atol(v);
+    else usage();
+    i++;
+  }
+  if (cfg.counters < 1 || cfg.counters > MAX_COUNTERS) {
+    fprintf(stderr, "counters must be 1..%d\n", MAX_COUNTERS);
+    exit(2);
+  }
+  if (cfg.capacity < 1 || cfg.capacity > QUEUE_CAPACITY) {
+    fprintf(stderr, "capacity must be 1..%d (rebuild with -DQUEUE_CAPACITY=N for more)\n", QUEUE_CAPACITY);
+    exit(2);
+  }
+  if (cfg.service == SERVICE_FIRMWARE && cfg.counters != 1) {
+    fprintf(stderr, "firmware service model has a single counter\n");
+    exit(2);
+  }
+}
+
+int main(int argc, char** argv) {
+  SimConfig cfg;
+  parseArgs(argc, argv, cfg);
+  rngState = cfg.seed;
+  if (cfg.traceFile) {
+    traceIn = fopen(cfg.traceFile, "r");
+    if (!traceIn) {
+      perror(cfg.traceFile);
+      return 1;
+    }
+  }
+
+  userProcessTimeSec = cfg.processTimeSec;
+  ticketLog.begin(0);
+  AdmissionPolicy policy(cfg.capacity);
+  policy.setMaxWait(cfg.maxWaitSec);
+  if (cfg.closingAfterSec >= 0) {
+    policy.setClock(0, 0);
+    policy.setClosingTime(cfg.closingAfterSec);
+  }
+
+  Counter counters[MAX_COUNTERS];
+  for (int c = 0; c < cfg.counters; c++) counters[c].finishUs = NEVER;
+
+  // 티켓별 예상 대기시간 / 트레이스 처리시간 (티켓 번호 % 아레나 크기로 매핑)
+  static int predictedWait[TICKET_ARENA_SIZE];
+  static double traceService[TICKET_ARENA_SIZE];
+
+  Histogram waitHist, etaErrHist;
+  double etaErrSum = 0;
+  uint64_t arrivals = 0, admitted = 0, served = 0;
+  uint64_t rejected[4] = {0, 0, 0, 0};
+  double busySec = 0;
+  int ticketNum = 0;
+
+  uint64_t nowUs = 0;
+  uint64_t arrivalUs;
+  double arrivalService;
+  bool moreArrivals = nextArrival(cfg, 0, arrivalUs, arrivalService);
+
+  auto wallStart = std::chrono::steady_clock::now();
+
+  while (moreArrivals || queueCount > 0) {
+    // 다음 처리 완료 사건
+    int doneCounter = -1;
+    uint64_t doneUs = NEVER;
+    if (cfg.service == SERVICE_FIRMWARE) {
+      // 펌웨어 loop()와 동일: 맨 앞 사람은 lastProcessTime + 처리시간에 처리됨
+      if (queueCount > 0) {
+        doneUs = ((uint64_t)lastProcessTime + (uint64_t)userProcessTimeSec * 1000) * 1000;
+        if (doneUs < nowUs) doneUs = nowUs;
+        doneCounter = 0;
+      }
+    } else {
+      for (int c = 0; c < cfg.counters; c++) {
+        if (counters[c].finishUs < doneUs) {
+          doneUs = counters[c].finishUs;
+          doneCounter = c;
+        }
+      }
+    }
+
+    bool arrivalNext = moreArrivals && arrivals < cfg.customers && (doneCounter < 0 || arrivalUs < doneUs);
+    if (!arrivalNext && doneCounter < 0) break;
+
+    if (arrivalNext) {
+      nowUs = arrivalUs;
+      unsigned long nowMs = nowUs / 1000;
+      arrivals++;
+      AdmissionDecision d = policy.evaluate(nowMs, queueCount, remainingForCurrentSec(nowMs), userProcessTimeSec);
+      if (d.result == ADMIT_OK) {
+        ticketNum++;
+        addToQueue(ticketNum, nowMs);
+        predictedWait[(uint16_t)ticketNum % TICKET_ARENA_SIZE] = d.predictedWaitSec;
+        traceService[(uint16_t)ticketNum % TICKET_ARENA_SIZE] = arrivalService;
+        admitted++;
+      } else {
+        rejected[d.result]++;
+      }
+      moreArrivals = (arrivals < cfg.customers) && nextArrival(cfg, nowUs, arrivalUs, arrivalService);
+    } else {
+      nowUs = doneUs;
+      unsigned long nowMs = nowUs / 1000;
+      int ticket;
+      if (cfg.service == SERVICE_FIRMWARE) {
+        ticket = queueList[0];
+        busySec += userProcessTimeSec;
+        serveQueueHead(nowMs);
+      } else {
+        Counter& c = counters[doneCounter];
+        ticket = c.ticket;
+        busySec += (c.finishUs - c.startUs) / 1e6;
+        c.finishUs = NEVER;
+        int index = 0;
+        while (index < queueCount && queueList[index] != ticket) index++;
+        if (index == 0) {
+          serveQueueHead(nowMs);
+        } else {
+          ticketLog.serve(ticket, nowMs);
+          removeFromQueue(index, nowMs);
+        }
+      }
+      lastProcessTime = nowMs;
+      served++;
+
+      uint16_t id = (uint16_t)ticket;
+      double waitSec = (double)(ticketLog.calledAt(id) - ticketLog.issuedAt(id)) / 1000.0;
+      double err = waitSec - predictedWait[id % TICKET_ARENA_SIZE];
+      waitHist.add(waitSec);
+      etaErrHist.add(fabs(err));
+      etaErrSum += err;
+    }
+
+    // 빈 창구에 대기열 앞쪽 사람 배정
+    if (cfg.service != SERVICE_FIRMWARE) {
+      for (int i = 0; i < queueCount && i < cfg.counters; i++) {
+        int ticket = queueList[i];
+        bool busy = false;
+        int freeCounter = -1;
+        for (int c = 0; c < cfg.counters; c++) {
+          if (counters[c].finishUs != NEVER && counters[c].ticket == ticket) busy = true;
+          if (counters[c].finishUs == NEVER && freeCounter < 0) freeCounter = c;
+        }
+        if (busy || freeCounter < 0) continue;
+        double svc = traceService[(uint16_t)ticket % TICKET_ARENA_SIZE];
+        if (svc < 0) svc = drawServiceSec(cfg);
+        ticketLog.call(ticket, nowUs / 1000);
+        counters[freeCounter].ticket = ticket;
+        counters[freeCounter].startUs = nowUs;
+        counters[freeCounter].finishUs = nowUs + (uint64_t)(svc * 1e6);
+      }
+    }
+  }
+
+  double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+  double simSec = nowUs / 1e6;
+
+  printf("customers       : %llu arrived, %llu admitted, %llu served\n",
+         (unsigned long long)arrivals, (unsigned long long)admitted, (unsigned long long)served);
+  printf("simulated time  : %.1f h\n", simSec / 3600);
+  printf("utilization     : %.1f %%\n", simSec > 0 ? 100.0 * busySec / (simSec * cfg.counters) : 0.0);
+  printf("rejection rate  : %.2f %% (queue full %.2f %%, wait too long %.2f %%, closing %.2f %%)\n",
+         arrivals ? 100.0 * (arrivals - admitted) / arrivals : 0.0,
+         arrivals ? 100.0 * rejected[ADMIT_QUEUE_FULL] / arrivals : 0.0,
+         arrivals ? 100.0 * rejected[ADMIT_WAIT_TOO_LONG] / arrivals : 0.0,
+         arrivals ? 100.0 * rejected[ADMIT_CLOSING] / arrivals : 0.0);
+  printf("wait (s)        : p50 %.0f, p90 %.0f, p99 %.0f, mean %.1f\n", waitHist.percentile(0.5),
+         waitHist.percentile(0.9), waitHist.percentile(0.99), waitHist.count ? waitHist.sum / waitHist.count : 0.0);
+  printf("wait P2 est (s) : p50 %.1f, p90 %.1f (firmware TicketLog)\n", ticketLog.waitSecP50(), ticketLog.waitSecP90());
+  printf("service P2 (s)  : p50 %.1f, p90 %.1f\n", ticketLog.serviceSecP50(), ticketLog.serviceSecP90());
+  printf("ETA error (s)   : bias %+.1f, |err| p50 %.0f, p90 %.0f\n", etaErrHist.count ? etaErrSum / etaErrHist.count : 0.0,
+         etaErrHist.percentile(0.5), etaErrHist.percentile(0.9));
+  fprintf(stderr, "%.2f M customers/s (%.3f s wall)\n", wallSec > 0 ? arrivals / wallSec / 1e6 : 0.0, wallSec);
+
+  if (traceIn) fclose(traceIn);
+  return 0;
+}
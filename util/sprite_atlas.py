@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+"""
+UI 스프라이트 아틀라스 생성기
+- 여러 아이콘을 팔레트 인덱스(8비트 또는 4비트) 하나의 배열로 묶고 스프라이트 사각형 표를 만듦
+- 팔레트(RGB565 LUT)는 모든 스프라이트가 함께 쓰거나(shared) 스프라이트마다 따로(sprite)
+- 패널 색 반전을 미리 적용하고 팔레트는 패널 전송 순서(빅엔디언)로 저장
+- 색이 인덱스 비트 수보다 많으면 median cut 으로 줄임 (손실, 실행 시 표시)
+- include/sprite_atlas.h 의 SpriteAtlas 를 정의하는 C/C++ 헤더 파일 생성
+
+입력은 이미지 파일 또는 util/icon_input.py 가 읽는 헤더 (.h)
+"""
+
+import argparse
+import importlib.util
+import os
+import re
+import sys
+
+# 이미지/헤더 읽기는 util/icon_input.py
+_spec = importlib.util.spec_from_file_location(
+    "icon_input", os.path.join(os.path.dirname(os.path.abspath(__file__)), "icon_input.py"))
+icon_input = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(icon_input)
+
+
+def channels(color):
+    return (color >> 11) & 0x1F, (color >> 5) & 0x3F, color & 0x1F
+
+
+def median_cut(counts, limit):
+    """{색: 픽셀 수} 를 limit 색 이하로 - 각 색이 대응할 대표색 사전 반환"""
+    boxes = [sorted(counts)]
+    while len(boxes) < limit:
+        # 가장 넓은 채널 범위를 가진 상자를 픽셀 수 기준 중앙에서 나눔
+        best = None
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            for ch in range(3):
+                values = [channels(c)[ch] for c in box]
+                spread = max(values) - min(values)
+                if best is None or spread > best[0]:
+                    best = (spread, i, ch)
+        if best is None or best[0] == 0:
+            break
+        _, i, ch = best
+        box = sorted(boxes.pop(i), key=lambda c: channels(c)[ch])
+        total = sum(counts[c] for c in box)
+        acc = 0
+        cut = 1
+        for k, c in enumerate(box[:-1]):
+            acc += counts[c]
+            if acc * 2 >= total:
+                cut = k + 1
+                break
+        boxes += [box[:cut], box[cut:]]
+
+    mapping = {}
+    for box in boxes:
+        weight = sum(counts[c] for c in box)
+        mean = [round(sum(channels(c)[ch] * counts[c] for c in box) / weight) for ch in range(3)]
+        rep = (mean[0] << 11) | (mean[1] << 5) | mean[2]
+        for c in box:
+            mapping[c] = rep
+    return mapping
+
+
+def build_palette(pixel_lists, limit):
+    """픽셀 목록들이 함께 쓸 팔레트 (limit 색 이하) 와 색 → 인덱스, 손실 여부"""
+    counts = {}
+    for pixels in pixel_lists:
+        for p in pixels:
+            counts[p] = counts.get(p, 0) + 1
+    lossy = len(counts) > limit
+    mapping = median_cut(counts, limit) if lossy else {c: c for c in counts}
+    palette = sorted(set(mapping.values()), key=lambda c: -sum(n for k, n in counts.items() if mapping[k] == c))
+    index = {c: palette.index(mapping[c]) for c in counts}
+    return palette, index, lossy
+
+
+def pack_indices(indices, width, height, bits):
+    """줄마다 바이트 경계에 맞춰 인덱스를 묶음 (4비트는 앞 픽셀이 상위 니블)"""
+    if bits == 8:
+        return list(indices)
+    out = []
+    for row in range(height):
+        line = indices[row * width:(row + 1) * width]
+        for i in range(0, width, 2):
+            hi = line[i]
+            lo = line[i + 1] if i + 1 < width else 0
+            out.append((hi << 4) | lo)
+    return out
+
+
+def load_sprites(paths, size, invert):
+    """입력 파일들을 (이름, 픽셀, 너비, 높이) 목록으로 (invert 면 패널 색 반전 적용)"""
+    sprites = []
+    for path in paths:
+        if path.endswith('.h'):
+            pixels, width, height, _ = icon_input.load_header(path, size)
+        else:
+            pixels, width, height, _ = icon_input.load_image(path, size)
+        if width > 240:
+            raise ValueError(f"너비가 화면보다 큽니다: {path} ({width})")
+        if invert:
+            pixels = [p ^ 0xFFFF for p in pixels]
+        sprites.append((c_name(path), pixels, width, height))
+    return sprites
+
+
+def build_atlas(sprites, bits, mode):
+    """팔레트와 인덱스 배열, 사각형 (이름, 시작, 너비, 높이, 팔레트 시작) 목록"""
+    limit = 1 << bits
+    if mode == 'auto':
+        colors = len(set(p for s in sprites for p in s[1]))
+        mode = 'shared' if colors <= limit else 'sprite'
+
+    palette = []
+    data = []
+    rects = []
+    lossy_sprites = []
+    groups = [sprites] if mode == 'shared' else [[s] for s in sprites]
+    for group in groups:
+        lut, index, lossy = build_palette([s[1] for s in group], limit)
+        base = len(palette)
+        palette += lut
+        for name, pixels, width, height in group:
+            if lossy:
+                lossy_sprites.append(name)
+            rects.append((name, len(data), width, height, base))
+            data += pack_indices([index[p] for p in pixels], width, height, bits)
+    return mode, palette, data, rects, lossy_sprites
+
+
+def c_name(path):
+    base = os.path.splitext(os.path.basename(path))[0]
+    name = base.lower().replace(' ', '_').replace('-', '_')
+    return re.sub(r'_\d+x\d+$', '', name)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="아이콘들을 팔레트 인덱스 스프라이트 아틀라스 C 헤더 파일로 묶음",
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        epilog="""
+사용 예시:
+  python sprite_atlas.py ../util/image/GoAdminBtn.png ../util/image/GoUserBtn.png -s 32x32 -o ../include/ui_atlas.h
+  python sprite_atlas.py icons/*.png -s 32x32 -b 4 --palette sprite
+
+출력:
+  - 인덱스 배열 하나 (스프라이트 순서대로 이어 붙임) + 사각형 표 + RGB565 팔레트
+  - 스프라이트 id 는 입력 순서 (SPRITE_<이름> enum)
+        """
+    )
+    parser.add_argument('images', nargs='+', help='묶을 이미지 파일들 또는 헤더 (.h)')
+    parser.add_argument('-o', '--output', default='ui_atlas.h', help='출력 헤더 파일 경로')
+    parser.add_argument('-n', '--name', default=None, help='아틀라스 이름 (기본: 출력 파일명)')
+    parser.add_argument('-s', '--size', type=icon_input.parse_size, default=None,
+                        help='이미지 입력을 이 크기로 조정 WxH (기본: 원본 크기)')
+    parser.add_argument('-b', '--bits', type=int, choices=[4, 8], default=8, help='픽셀당 인덱스 비트 (기본 8)')
+    parser.add_argument('--palette', choices=['auto', 'shared', 'sprite'], default='auto',
+                        help='팔레트 공유 방식 (기본 auto: 공유 팔레트에 다 들어가면 shared)')
+    parser.add_argument('--no-invert', action='store_true', help='패널 색 반전을 적용하지 않음')
+    args = parser.parse_args()
+
+    try:
+        sprites = load_sprites(args.images, args.size, not args.no_invert)
+    except ValueError as e:
+        print(f"❌ {e}")
+        return 1
+    mode, palette, data, rects, lossy_sprites = build_atlas(sprites, args.bits, args.palette)
+
+    atlas = args.name or c_name(args.output)
+    guard = f"{atlas.upper()}_H"
+    raw_bytes = sum(s[2] * s[3] * 2 for s in sprites)
+    atlas_bytes = len(data) + len(palette) * 2 + len(rects) * 12
+    invert_note = '반전 적용' if not args.no_invert else '반전 없음'
+
+    lines = [
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#include \"sprite_atlas.h\"",
+        "",
+        f"// UI 스프라이트 아틀라스 ({args.bits}비트 인덱스, "
+        f"{'공유 팔레트' if mode == 'shared' else '스프라이트별 팔레트'} {len(palette)}색, {invert_note})",
+        f"// 인덱스 {len(data)}바이트 + 팔레트 {len(palette) * 2}바이트 + 사각형 표 {len(rects) * 12}바이트"
+        f" = {atlas_bytes}바이트 / RGB565 원본 {raw_bytes}바이트",
+        "// util/sprite_atlas.py 로 생성 - 직접 수정하지 말 것",
+        "",
+        "enum {",
+    ]
+    for i, (name, *_rest) in enumerate(rects):
+        lines.append(f"  SPRITE_{name.upper()}{' = 0' if i == 0 else ''},")
+    lines += [
+        f"  {atlas.upper()}_COUNT",
+        "};",
+        "",
+        f"// 스프라이트 이름 (에셋 파티션에서 같은 이름을 찾을 때)",
+        f"static const char* const {atlas}_names[] = {{",
+    ]
+    for name, *_rest in rects:
+        lines.append(f"    \"{name}\",")
+    lines += [
+        "};",
+        "",
+        "#if QMS_ASSET_BUILTIN",
+        f"// 팔레트 (패널 전송 순서, 픽셀마다 읽으므로 내부 RAM)",
+        f"static const uint16_t QMS_HOT_DATA {atlas}_palette[] = {{",
+    ]
+    for i in range(0, len(palette), 8):
+        row = ", ".join(f"0x{icon_input.swap_bytes(c):04X}" for c in palette[i:i + 8])
+        lines.append(f"    {row}{',' if i + 8 < len(palette) else ''}")
+    lines += [
+        "};",
+        "",
+        f"static const uint8_t PROGMEM {atlas}_pixels[] = {{",
+    ]
+    for i in range(0, len(data), 16):
+        row = ", ".join(f"0x{b:02X}" for b in data[i:i + 16])
+        lines.append(f"    {row}{',' if i + 16 < len(data) else ''}")
+    lines += [
+        "};",
+        "",
+        f"// 스프라이트 사각형 (인덱스 시작, 너비, 높이, 팔레트 시작)",
+        f"static const SpriteRect PROGMEM {atlas}_rects[] = {{",
+    ]
+    for name, offset, width, height, base in rects:
+        lines.append(f"    {{{offset}, {width}, {height}, {base}}},  // {name}")
+    lines += [
+        "};",
+        "",
+        f"static const SpriteAtlas {atlas} = {{{args.bits}, {atlas}_palette, {atlas}_pixels, "
+        f"{atlas}_rects, {atlas.upper()}_COUNT}};",
+        "#endif",
+        "",
+        f"#endif // {guard}",
+        "",
+    ]
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write("\n".join(lines))
+
+    print(f"✅ 아틀라스 생성: {args.output}")
+    print(f"   스프라이트 {len(rects)}개, {args.bits}비트 인덱스, "
+          f"{'공유' if mode == 'shared' else '스프라이트별'} 팔레트 {len(palette)}색")
+    print(f"   크기: {atlas_bytes}바이트 (RGB565 원본 {raw_bytes}바이트)")
+    if lossy_sprites:
+        print(f"⚠️  색 수를 줄임 (손실): {', '.join(lossy_sprites)}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""
+터치 트레이스(.qtt) 도구
+- capture : 시리얼에서 'trace start' ~ 'trace stop' 구간의 프레임을 받아 .qtt 로 저장
+- extract : 시리얼 캡처 파일(바이너리)에서 프레임을 골라 .qtt 로 저장
+- dump    : .qtt 내용을 텍스트로 출력
+- synth   : 스크립트(화면 좌표 기준)로 .qtt 생성 (재생 테스트용)
+
+포맷은 include/touch_trace.h 참고
+"""
+
+import argparse
+import sys
+import time
+
+MAGIC = b"QTT1"
+FRAME_SYNC = 0xA5
+FRAME_TYPE = ord('T')
+
+# include/touch.h 보정값과 동일
+RAW_X_MIN, RAW_X_MAX = 280, 3700
+RAW_Y_MIN, RAW_Y_MAX = 350, 3720
+TOUCH_WIDTH, TOUCH_HEIGHT = 320, 240  # TouchModule(SCREEN_HEIGHT, SCREEN_WIDTH)
+
+
+def crc8(data):
+    crc = 0
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def extract_frames(stream):
+    """디버그 텍스트가 섞인 바이트열에서 CRC가 맞는 프레임 페이로드만 추출"""
+    out = bytearray()
+    i = 0
+    while i + 4 <= len(stream):
+        if stream[i] == FRAME_SYNC and stream[i + 1] == FRAME_TYPE:
+            n = stream[i + 2]
+            end = i + 3 + n
+            if n > 0 and end < len(stream) and crc8(stream[i + 3:end]) == stream[end]:
+                out += stream[i + 3:end]
+                i = end + 1
+                continue
+        i += 1
+    return bytes(out)
+
+
+def varint(value):
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return out
+
+
+def encode(samples):
+    """samples: (dt_us, down, x, y, z) 목록"""
+    out = bytearray(MAGIC)
+    for dt, down, x, y, z in samples:
+        out += varint((dt << 1) | (1 if down else 0))
+        if down:
+            x, y, z = (max(0, min(4095, v)) for v in (x, y, z))
+            out += bytes([x & 0xFF, (x >> 8) | ((y & 0x0F) << 4), y >> 4, z & 0xFF, z >> 8])
+    return bytes(out)
+
+
+def decode(data):
+    if not data.startswith(MAGIC):
+        raise ValueError("not a QTT1 trace")
+    pos, t = len(MAGIC), 0
+    while pos < len(data):
+        value, shift = 0, 0
+        while True:
+            b = data[pos]
+            pos += 1
+            value |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                break
+        t += value >> 1
+        if value & 1:
+            r = data[pos:pos + 5]
+            pos += 5
+            yield t, True, r[0] | ((r[1] & 0x0F) << 8), (r[1] >> 4) | (r[2] << 4), r[3] | ((r[4] & 0x0F) << 8)
+        else:
+            yield t, False, 0, 0, 0
+
+
+def arduino_map(x, in_min, in_max, out_min, out_max):
+    # Arduino map(): 정수 나눗셈은 0 방향으로 절삭
+    num = (x - in_min) * (out_max - out_min)
+    den = in_max - in_min
+    q = abs(num) // abs(den)
+    return (q if (num >= 0) == (den >= 0) else -q) + out_min
+
+
+def screen_to_raw(sx, sy):
+    """TouchModule::toScreen 의 역변환 (정확히 같은 화면 좌표가 나오는 raw 값 탐색)"""
+    raw_y = RAW_Y_MIN + sx * (RAW_Y_MAX - RAW_Y_MIN) // TOUCH_HEIGHT
+    raw_x = RAW_X_MAX - sy * (RAW_X_MAX - RAW_X_MIN) // TOUCH_WIDTH
+    for dy in range(-20, 21):
+        if arduino_map(raw_y + dy, RAW_Y_MIN, RAW_Y_MAX, 0, TOUCH_HEIGHT) == sx:
+            raw_y += dy
+            break
+    for dx in range(-20, 21):
+        if arduino_map(raw_x + dx, RAW_X_MAX, RAW_X_MIN, 0, TOUCH_WIDTH) == sy:
+            raw_x += dx
+            break
+    return raw_x, raw_y
+
+
+def synth(script):
+    """
+    스크립트 문법 (한 줄에 한 명령, 시간 단위 ms):
+      period <ms>                 샘플 간격 (기본 1)
+      tap <x> <y> [samples]       같은 지점을 samples 회 누름 (기본 60) 후 펜업
+      drag <x0> <y0> <x1> <y1> <samples> [hold]
+                                  hold 회 시작점에 머문 뒤(누름 확정) samples 회에 걸쳐 이동
+      idle <ms>                   펜업 상태로 대기
+    """
+    period_us = 1000
+    samples = []
+    for raw in script.splitlines():
+        line = raw.split('#')[0].split()
+        if not line:
+            continue
+        cmd, args = line[0], [int(a) for a in line[1:]]
+        if cmd == 'period':
+            period_us = args[0] * 1000
+        elif cmd == 'tap':
+            count = args[2] if len(args) > 2 else 60
+            rx, ry = screen_to_raw(args[0], args[1])
+            samples += [(period_us, True, rx, ry, 1200)] * count
+            samples.append((period_us, False, 0, 0, 0))
+        elif cmd == 'drag':
+            x0, y0, x1, y1, count = args[:5]
+            hold = args[5] if len(args) > 5 else 0
+            rx, ry = screen_to_raw(x0, y0)
+            samples += [(period_us, True, rx, ry, 1200)] * hold
+            for i in range(count):
+                sx = x0 + (x1 - x0) * i // max(1, count - 1)
+                sy = y0 + (y1 - y0) * i // max(1, count - 1)
+                rx, ry = screen_to_raw(sx, sy)
+                samples.append((period_us, True, rx, ry, 1200))
+            samples.append((period_us, False, 0, 0, 0))
+        elif cmd == 'idle':
+            remaining = args[0] * 1000
+            while remaining > 0:
+                step = min(remaining, 100000)
+                samples.append((step, False, 0, 0, 0))
+                remaining -= step
+        else:
+            raise ValueError(f"알 수 없는 명령: {raw}")
+    return encode(samples)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="터치 트레이스(.qtt) 캡처/변환/생성")
+    sub = parser.add_subparsers(dest='cmd', required=True)
+
+    p = sub.add_parser('capture', help='시리얼에서 트레이스 캡처 (pyserial 필요)')
+    p.add_argument('--port', required=True)
+    p.add_argument('--baud', type=int, default=115200)
+    p.add_argument('--seconds', type=float, default=30)
+    p.add_argument('-o', '--output', required=True)
+
+    p = sub.add_parser('extract', help='캡처 파일에서 프레임 추출')
+    p.add_argument('capture')
+    p.add_argument('-o', '--output', required=True)
+
+    p = sub.add_parser('dump', help='.qtt 내용 출력')
+    p.add_argument('trace')
+
+    p = sub.add_parser('synth', help='스크립트로 .qtt 생성')
+    p.add_argument('script')
+    p.add_argument('-o', '--output', required=True)
+
+    args = parser.parse_args()
+
+    if args.cmd == 'capture':
+        import serial
+        with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+            port.write(b"trace start\n")
+            data = bytearray()
+            end = time.time() + args.seconds
+            while time.time() < end:
+                data += port.read(4096)
+            port.write(b"trace stop\n")
+            time.sleep(0.3)
+            data += port.read(65536)
+        trace = extract_frames(bytes(data))
+    elif args.cmd == 'extract':
+        with open(args.capture, 'rb') as f:
+            trace = extract_frames(f.read())
+    elif args.cmd == 'synth':
+        with open(args.script, encoding='utf-8') as f:
+            trace = synth(f.read())
+    else:
+        with open(args.trace, 'rb') as f:
+            for t, down, x, y, z in decode(f.read()):
+                print(f"{t:>12} {'D' if down else 'U'} {x:5} {y:5} {z:5}")
+        return 0
+
+    if not trace.startswith(MAGIC):
+        print("트레이스 시작(QTT1)을 찾지 못했습니다.", file=sys.stderr)
+        return 1
+    with open(args.output, 'wb') as f:
+        f.write(trace)
+    print(f"{args.output}: {len(trace)} bytes, {sum(1 for _ in decode(trace))} samples")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())